@@ -0,0 +1,189 @@
+/**
+ * @file admin_server.h
+ * @brief 지표와 진단 정보를 HTTP 로 내주는 관리용 TCP 서버
+ *
+ * 채팅 포트와 다른 포트에서 쓰레드 하나로 요청을 하나씩 처리한다. 요청마다 경로에 등록된 함수가
+ * 본문을 만들고, 응답을 보낸 뒤 연결을 닫는다 (HTTP/1.0). Prometheus 스크레이프나 curl 정도의 부하를 가정한다.
+ */
+
+#ifndef CHAT_SERVER_ADMIN_SERVER_H
+#define CHAT_SERVER_ADMIN_SERVER_H
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+
+/**
+ * @brief 경로별 본문 함수를 가진 최소한의 HTTP 서버
+ */
+class AdminServer {
+  public:
+    using Handler = std::function<std::string()>;
+
+  private:
+    /**
+     * @brief 경로 하나의 응답
+     */
+    struct Route {
+      std::string content_type;
+      Handler handler;
+    };
+
+    int listen_socket = -1;
+    std::atomic<bool> stopping {false};
+    std::map<std::string, Route> routes;
+    std::thread thread;
+
+    static void send_all(int sock, const std::string &data) {
+      size_t sent = 0;
+      while (sent < data.size()) {
+        ssize_t n = send(sock, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) {
+          return;
+        }
+        sent += n;
+      }
+    }
+
+    void serve(int sock) {
+      // 느린 클라이언트가 쓰레드를 붙잡지 않도록 요청을 기다리는 시간을 제한한다
+      timeval timeout = {1, 0};
+      setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+      std::string request;
+      char buffer[1024];
+      while (request.find("\r\n\r\n") == std::string::npos && request.find("\n\n") == std::string::npos && request.size() < 8192) {
+        ssize_t n = recv(sock, buffer, sizeof(buffer), 0);
+        if (n <= 0) {
+          break;
+        }
+        request.append(buffer, n);
+      }
+
+      // "GET /path?query HTTP/1.1"
+      std::string path;
+      size_t start = request.find(' ');
+      if (request.compare(0, 4, "GET ") == 0 && start != std::string::npos) {
+        size_t end = request.find_first_of(" ?\r\n", start + 1);
+        path = request.substr(start + 1, end == std::string::npos ? std::string::npos : end - start - 1);
+      }
+
+      auto route = routes.find(path);
+      std::string status = "200 OK";
+      std::string content_type = "text/plain; charset=utf-8";
+      std::string body;
+      if (route == routes.end()) {
+        status = "404 Not Found";
+        body = "not found\n";
+      } else {
+        content_type = route->second.content_type;
+        body = route->second.handler();
+      }
+      send_all(sock, "HTTP/1.0 " + status + "\r\nContent-Type: " + content_type + "\r\nContent-Length: " +
+                     std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body);
+    }
+
+    void run() {
+      while (!stopping.load()) {
+        int sock = accept(listen_socket, nullptr, nullptr);
+        if (sock < 0) {
+          if (!stopping.load() && errno != EINTR) {
+            std::cerr << "admin accept() failed: " << strerror(errno) << std::endl;
+          }
+          continue;
+        }
+        serve(sock);
+        close(sock);
+      }
+    }
+
+  public:
+    AdminServer() {}
+
+    AdminServer(const AdminServer &) = delete;
+    AdminServer &operator=(const AdminServer &) = delete;
+
+    ~AdminServer() {
+      stop();
+    }
+
+    /**
+     * @brief 경로에 본문 함수를 등록. start() 전에 불러야 한다.
+     *
+     * @param path 경로, 예) "/metrics"
+     * @param content_type 응답의 Content-Type
+     * @param handler 요청마다 불려 본문을 만든다
+     */
+    void add_route(const std::string &path, const std::string &content_type, Handler handler) {
+      routes[path] = Route {content_type, std::move(handler)};
+    }
+
+    /**
+     * @brief address:port 에서 요청을 받기 시작한다.
+     *
+     * 인증이 없으므로 address 는 믿을 수 있는 곳에서만 닿는 주소여야 한다.
+     *
+     * @param address 바인드할 IPv4 주소, 예) "127.0.0.1"
+     * @param port 포트 번호
+     * @return 주소가 잘못되었거나 소켓을 열지 못했으면 false
+     */
+    bool start(const std::string &address, int port) {
+      sockaddr_in sin;
+      memset(&sin, 0, sizeof(sin));
+      sin.sin_family = AF_INET;
+      sin.sin_port = htons(port);
+      if (inet_pton(AF_INET, address.c_str(), &sin.sin_addr) != 1) {
+        std::cerr << "admin bind address is not an IPv4 address: " << address << std::endl;
+        return false;
+      }
+
+      listen_socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+      if (listen_socket < 0) {
+        std::cerr << "admin socket() failed: " << strerror(errno) << std::endl;
+        return false;
+      }
+      int on = 1;
+      setsockopt(listen_socket, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+      if (bind(listen_socket, (sockaddr *) &sin, sizeof(sin)) < 0 || listen(listen_socket, 16) < 0) {
+        std::cerr << "admin bind() failed: " << strerror(errno) << std::endl;
+        close(listen_socket);
+        listen_socket = -1;
+        return false;
+      }
+
+      thread = std::thread([this]() {run();});
+      return true;
+    }
+
+    /**
+     * @brief 요청을 그만 받고 쓰레드를 멈춘다. 여러 번 불러도 된다.
+     */
+    void stop() {
+      stopping.store(true);
+      if (listen_socket >= 0) {
+        // 막혀 있는 accept() 를 깨운다
+        shutdown(listen_socket, SHUT_RDWR);
+      }
+      if (thread.joinable()) {
+        thread.join();
+      }
+      if (listen_socket >= 0) {
+        close(listen_socket);
+        listen_socket = -1;
+      }
+    }
+};
+
+#endif
@@ -0,0 +1,271 @@
+/**
+ * @file capture.h
+ * @brief 서버가 받은 프레임을 연결, 시각, 포맷과 함께 바이너리 파일로 남기는 캡처와 그 파일의 형식
+ *
+ * 파일은 CAPTURE_MAGIC 8바이트 뒤에 레코드가 이어진다. 레코드는 CAPTURE_RECORD_HEADER 바이트의 머리와 payload 이다.
+ *
+ *   kind(1) format(1) framing(1) 0(1) connection(4) time_ns(8) length(4) payload(length)
+ *
+ * 정수는 little-endian 이고 time_ns 는 캡처를 시작한 때부터의 ns 이다. format, framing 은 그 연결이 그때 쓰던
+ * MessageFormat, FramingMode 값이다. payload 는 길이 prefix 를 뗀 프레임 그대로이다.
+ *
+ * 쓰레드마다 자기 링 버퍼에 lock 없이 레코드를 넣고, 쓰기 쓰레드가 링들을 비워 파일에 쓴다. 그래서 파일 안의 레코드는
+ * 쓰레드 사이에서는 시각 순서가 아닐 수 있다. 읽는 쪽은 time_ns 로 (안정) 정렬해서 쓴다. 한 연결의 레코드는 시각 순서이다.
+ */
+
+#ifndef CHAT_SERVER_CAPTURE_H
+#define CHAT_SERVER_CAPTURE_H
+
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <iostream>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "metrics.h"
+
+static const char CAPTURE_MAGIC[8] = {'C', 'H', 'A', 'T', 'C', 'A', 'P', '1'};
+static const size_t CAPTURE_RECORD_HEADER = 20; ///< 레코드 머리의 바이트 수
+
+/**
+ * @brief 레코드의 종류
+ */
+enum class CaptureKind : uint8_t {
+  OPEN = 1, ///< 연결을 받았다, payload 없음
+  FRAME = 2, ///< 프레임 하나를 받았다
+  CLOSE = 3, ///< 연결을 닫았다, payload 없음
+};
+
+/**
+ * @brief 읽어 들인 레코드 하나
+ */
+struct CaptureRecord {
+  CaptureKind kind;
+  uint8_t format;
+  uint8_t framing;
+  uint32_t connection;
+  uint64_t time_ns;
+  std::string payload;
+};
+
+/**
+ * @brief 레코드 머리를 out 에 쓴다.
+ *
+ * @param out CAPTURE_RECORD_HEADER 바이트 이상의 버퍼
+ */
+inline void encode_capture_header(CaptureKind kind, uint8_t format, uint8_t framing, uint32_t connection, uint64_t time_ns,
+                                  uint32_t length, char *out) {
+  out[0] = static_cast<char>(kind);
+  out[1] = static_cast<char>(format);
+  out[2] = static_cast<char>(framing);
+  out[3] = 0;
+  for (int i = 0; i < 4; ++i) {
+    out[4 + i] = static_cast<char>(connection >> (8 * i));
+    out[16 + i] = static_cast<char>(length >> (8 * i));
+  }
+  for (int i = 0; i < 8; ++i) {
+    out[8 + i] = static_cast<char>(time_ns >> (8 * i));
+  }
+}
+
+/**
+ * @brief 레코드 하나를 읽는다.
+ *
+ * @return 파일 끝이거나 레코드가 잘렸으면 false
+ */
+inline bool read_capture_record(std::istream &in, CaptureRecord &record) {
+  unsigned char header[CAPTURE_RECORD_HEADER];
+  if (!in.read(reinterpret_cast<char *>(header), sizeof(header))) {
+    return false;
+  }
+  record.kind = static_cast<CaptureKind>(header[0]);
+  record.format = header[1];
+  record.framing = header[2];
+  record.connection = 0;
+  uint32_t length = 0;
+  for (int i = 0; i < 4; ++i) {
+    record.connection |= static_cast<uint32_t>(header[4 + i]) << (8 * i);
+    length |= static_cast<uint32_t>(header[16 + i]) << (8 * i);
+  }
+  record.time_ns = 0;
+  for (int i = 0; i < 8; ++i) {
+    record.time_ns |= static_cast<uint64_t>(header[8 + i]) << (8 * i);
+  }
+  record.payload.resize(length);
+  return length == 0 || static_cast<bool>(in.read(&record.payload[0], length));
+}
+
+/**
+ * @brief 받은 프레임을 캡처 파일에 쓰는 전역 캡처기
+ */
+class CaptureWriter {
+  private:
+    /**
+     * @brief 한 쓰레드가 넣고 쓰기 쓰레드가 꺼내는 바이트 링 버퍼. 넣는 쪽과 꺼내는 쪽이 하나씩이라 lock 이 없다.
+     */
+    struct Ring {
+      std::unique_ptr<char[]> data;
+      size_t capacity; ///< 2의 거듭제곱
+      std::atomic<uint64_t> head {0}; ///< 넣은 바이트 수, 넣는 쓰레드만 쓴다
+      std::atomic<uint64_t> tail {0}; ///< 꺼낸 바이트 수, 쓰기 쓰레드만 쓴다
+      std::atomic<uint64_t> records {0}; ///< 넣은 레코드 수, 넣는 쓰레드만 쓴다
+      std::atomic<uint64_t> dropped {0}; ///< 자리가 없어 버린 레코드 수, 넣는 쓰레드만 쓴다
+
+      explicit Ring(size_t capacity) : data(new char[capacity]), capacity(capacity) {}
+
+      void copy_in(uint64_t position, const char *bytes, size_t size) {
+        if (size == 0) {
+          return;
+        }
+        size_t offset = position & (capacity - 1);
+        size_t first = std::min(size, capacity - offset);
+        memcpy(&data[offset], bytes, first);
+        memcpy(&data[0], bytes + first, size - first);
+      }
+    };
+
+    std::atomic<bool> running {false};
+    size_t ring_bytes = 0;
+    uint64_t origin_ns = 0;
+    uint64_t written_bytes = 0;
+
+    std::mutex rings_mutex; ///< rings 에 쓰레드의 링을 더할 때만 잡는다
+    std::vector<std::unique_ptr<Ring>> rings;
+
+    std::mutex writer_mutex;
+    std::condition_variable writer_cv;
+    std::thread writer;
+    std::ofstream file;
+
+    CaptureWriter() {}
+
+    Ring &local_ring() {
+      thread_local Ring *ring = nullptr;
+      if (ring == nullptr) {
+        std::unique_lock<std::mutex> lock(rings_mutex);
+        rings.emplace_back(new Ring(ring_bytes));
+        ring = rings.back().get();
+      }
+      return *ring;
+    }
+
+    /**
+     * @brief 모든 링에 쌓인 레코드를 파일에 쓴다. 쓰기 쓰레드나 멈춘 뒤에만 부른다.
+     */
+    void drain() {
+      std::unique_lock<std::mutex> lock(rings_mutex);
+      for (auto &ring : rings) {
+        uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        while (tail < head) {
+          size_t offset = tail & (ring->capacity - 1);
+          size_t size = std::min<uint64_t>(head - tail, ring->capacity - offset);
+          file.write(&ring->data[offset], size);
+          tail += size;
+          written_bytes += size;
+        }
+        ring->tail.store(tail, std::memory_order_release);
+      }
+      file.flush();
+    }
+
+    void run() {
+      std::unique_lock<std::mutex> lock(writer_mutex);
+      while (running.load()) {
+        writer_cv.wait_for(lock, std::chrono::milliseconds(20));
+        drain();
+      }
+    }
+
+  public:
+    CaptureWriter(const CaptureWriter &) = delete;
+    CaptureWriter &operator=(const CaptureWriter &) = delete;
+
+    static CaptureWriter &instance() {
+      static CaptureWriter writer;
+      return writer;
+    }
+
+    /**
+     * @brief path 에 캡처를 쓰기 시작한다.
+     *
+     * @param path 캡처 파일 경로
+     * @param ring_bytes 쓰레드마다의 링 버퍼 크기, 2의 거듭제곱으로 올린다. 쓰기 쓰레드가 비우기 전에 차면 레코드를 버린다.
+     * @return 파일을 열지 못했으면 false
+     */
+    bool start(const std::string &path, size_t ring_bytes) {
+      file.open(path, std::ios::out | std::ios::trunc | std::ios::binary);
+      if (!file) {
+        std::cerr << "capture: " << path << " 을 열지 못했습니다" << std::endl;
+        return false;
+      }
+      file.write(CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC));
+      this->ring_bytes = 1024;
+      while (this->ring_bytes < ring_bytes) {
+        this->ring_bytes <<= 1;
+      }
+      origin_ns = metric_now_ns();
+      running.store(true);
+      writer = std::thread([this]() {run();});
+      return true;
+    }
+
+    /**
+     * @brief 남은 레코드를 쓰고 파일을 닫는다. 레코드를 넣는 쓰레드들이 멈춘 뒤에 부른다.
+     */
+    void stop() {
+      if (!writer.joinable()) {
+        return;
+      }
+      running.store(false);
+      writer_cv.notify_all();
+      writer.join();
+      drain();
+      file.close();
+      uint64_t records = 0, dropped = 0;
+      for (auto &ring : rings) {
+        records += ring->records.load();
+        dropped += ring->dropped.load();
+      }
+      std::cout << "capture: " << records << " records, " << written_bytes << " bytes written, " << dropped << " dropped" << std::endl;
+    }
+
+    bool enabled() const {return running.load(std::memory_order_relaxed);}
+
+    /**
+     * @brief 레코드 하나를 이 쓰레드의 링에 넣는다. 링에 자리가 없으면 버리고 센다.
+     *
+     * @param kind 레코드 종류
+     * @param connection 연결 번호
+     * @param format 연결의 MessageFormat 값
+     * @param framing 연결의 FramingMode 값
+     * @param payload 프레임, OPEN/CLOSE 이면 비어 있다
+     */
+    void record(CaptureKind kind, uint32_t connection, uint8_t format, uint8_t framing, std::string_view payload = std::string_view()) {
+      Ring &ring = local_ring();
+      size_t size = CAPTURE_RECORD_HEADER + payload.size();
+      uint64_t head = ring.head.load(std::memory_order_relaxed);
+      if (size > ring.capacity - (head - ring.tail.load(std::memory_order_acquire))) {
+        ring.dropped.store(ring.dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return;
+      }
+      char header[CAPTURE_RECORD_HEADER];
+      encode_capture_header(kind, format, framing, connection, metric_now_ns() - origin_ns, static_cast<uint32_t>(payload.size()), header);
+      ring.copy_in(head, header, sizeof(header));
+      ring.copy_in(head + sizeof(header), payload.data(), payload.size());
+      ring.head.store(head + size, std::memory_order_release);
+      ring.records.store(ring.records.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+};
+
+#endif
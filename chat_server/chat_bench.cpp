@@ -0,0 +1,841 @@
+/**
+ * @file chat_bench.cpp
+ * @brief chat_server 에 실제 TCP 연결로 부하를 주고 종단 간 지연과 처리량을 재는 부하 발생기
+ *
+ * 쓰레드마다 epoll 하나로 여러 클라이언트를 흉내 낸다. 클라이언트는 이름을 정하고 방에 들어간 뒤 채팅을 보낸다.
+ * 채팅 내용 앞에는 보낸 클라이언트, 순번, 보내기로 한 시각을 적어 두고, 받는 쪽은 받은 시각과의 차이를 지연으로 기록한다.
+ * 서버는 채팅을 보낸 사람에게도 돌려주므로 (echo) 보낸 사람이 받은 것과 다른 멤버가 받은 것 (delivery) 을 따로 센다.
+ *
+ * - closed loop: 클라이언트마다 자기 채팅의 echo 를 받은 뒤 (think time 이 지나면) 다음 채팅을 보낸다.
+ * - open loop: 클라이언트마다 정해진 평균 간격의 포아송 도착으로 보낸다. 서버가 밀려도 보낼 시각은 미뤄지지 않고,
+ *   지연은 실제로 보낸 시각이 아니라 보내기로 한 시각부터 잰다 (coordinated omission 을 피한다).
+ *
+ * 예) ./chat_bench --clients=200 --rooms=20 --room-dist=zipf --mode=open --rate=5 --duration=10
+ */
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+#include "json_scanner.h"
+#include "framing.h"
+#include "message.pb.h"
+
+using namespace std;
+using namespace mju;
+using json = nlohmann::json;
+
+string host = "127.0.0.1"; ///< 서버 주소 (IPv4)
+int port = 10221; ///< 서버 포트
+string format = "json"; ///< 클라이언트가 쓰는 포맷, json, protobuf, mixed (번갈아)
+size_t num_clients = 100; ///< 흉내 낼 클라이언트 수
+size_t num_threads = 2; ///< epoll 쓰레드 수
+size_t num_rooms = 10; ///< 방 수
+string room_dist = "uniform"; ///< 방 크기 분포, uniform 또는 zipf
+double zipf_s = 1.0; ///< zipf 분포의 지수, 클수록 큰 방에 몰린다
+string mode = "closed"; ///< closed 또는 open
+double rate = 10; ///< open loop 에서 클라이언트 하나가 초당 보내는 채팅 수
+double think_ms = 0; ///< closed loop 에서 echo 를 받고 다음 채팅을 보낼 때까지 쉬는 시간
+double rename_rate = 0; ///< 실행 중 클라이언트 하나가 초당 이름을 바꾸는 횟수
+size_t message_size = 64; ///< 채팅 내용의 최소 바이트 수
+size_t message_size_max = 0; ///< 채팅 내용의 최대 바이트 수, 0 이면 message_size 로 고정
+double duration = 10; ///< 측정 시간 (초)
+double warmup = 2; ///< 측정 전에 버리는 시간 (초)
+string name_prefix = "bench"; ///< 클라이언트 이름과 방 제목의 접두사
+unsigned seed = 1; ///< 방 배정과 도착 간격의 난수 씨앗
+
+static const size_t MAX_FRAME_SIZE = 16 * 1024 * 1024;
+static const uint64_t SETUP_TIMEOUT_NS = 60ull * 1000000000; ///< 방 만들기와 입장을 기다리는 최대 시간
+static const uint64_t DRAIN_NS = 2ull * 1000000000; ///< 보내기를 멈춘 뒤 늦게 오는 메시지를 기다리는 시간
+
+/**
+ * @brief 전체 진행 단계. 메인 쓰레드가 바꾸고 epoll 쓰레드들이 읽는다.
+ */
+enum class Phase {
+  CREATE, ///< 방마다 첫 클라이언트가 방을 만든다
+  JOIN, ///< 나머지 클라이언트가 방 ID 로 입장한다
+  RUN, ///< 채팅을 보낸다
+  DRAIN, ///< 보내기를 멈추고 남은 메시지를 받는다
+  STOP,
+};
+
+atomic<Phase> phase(Phase::CREATE);
+atomic<size_t> rooms_created(0);
+atomic<size_t> clients_joined(0);
+vector<int> room_ids; ///< 방 번호 -> 서버의 방 ID, JOIN 전에 메인 쓰레드가 채운다
+uint64_t measure_start_ns = 0; ///< 이 시각 이후에 보내기로 한 채팅만 잰다
+uint64_t measure_end_ns = 0; ///< 이 시각부터 보내지 않는다
+
+/**
+ * @brief CLOCK_MONOTONIC 시각 (ns). timerfd 와 같은 시계를 쓴다.
+ */
+static uint64_t now_ns() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+/**
+ * @brief 흉내 내는 클라이언트 하나
+ */
+struct BenchClient {
+  int id;
+  size_t slot = 0; ///< 맡은 쓰레드 안에서의 번호
+  int fd = -1;
+  bool protobuf;
+  size_t room; ///< 들어갈 방 번호
+  bool creator; ///< 방을 만드는 클라이언트
+  bool joined = false;
+  bool alive = true;
+  FrameReader reader {FramingMode::U16, MAX_FRAME_SIZE};
+  int pending_type = -1; ///< protobuf 에서 Type 프레임을 받고 본문을 기다리는 타입
+  string outbuf; ///< 소켓이 받아주지 않아 남은 보낼 데이터
+  bool want_write = false;
+  uint64_t seq = 0;
+  uint64_t renames = 0;
+
+  BenchClient(int id, bool protobuf, size_t room, bool creator) : id(id), protobuf(protobuf), room(room), creator(creator) {}
+};
+
+/**
+ * @brief 쓰레드 하나가 모은 결과
+ */
+struct BenchStats {
+  vector<uint64_t> echo_ns; ///< 보낸 사람이 자기 채팅을 돌려받기까지
+  vector<uint64_t> delivery_ns; ///< 다른 멤버가 받기까지
+  uint64_t sent = 0; ///< 측정 구간에 보내기로 한 채팅 수
+  uint64_t echoes = 0;
+  uint64_t deliveries = 0;
+  uint64_t renames = 0;
+  uint64_t bytes_in = 0;
+  uint64_t bytes_out = 0;
+  uint64_t disconnects = 0;
+};
+
+/**
+ * @brief 예약된 보내기. due 가 이른 것부터 꺼낸다.
+ */
+struct Scheduled {
+  uint64_t due;
+  size_t client; ///< 쓰레드 안의 클라이언트 번호
+  bool rename; ///< 채팅이 아니라 이름 바꾸기
+
+  bool operator>(const Scheduled &other) const {return due > other.due;}
+};
+
+/**
+ * @brief 프레임 하나에 framing 의 길이 prefix 를 붙여 out 에 덧붙인다.
+ */
+static void append_frame(string &out, const string &frame) {
+  char prefix[MAX_LENGTH_PREFIX];
+  size_t len = encode_length_prefix(FramingMode::U16, frame.size(), prefix);
+  out.append(prefix, len);
+  out += frame;
+}
+
+/**
+ * @brief 클라이언트 포맷으로 메시지 하나를 인코딩해 out 에 덧붙인다.
+ *
+ * @param out 보낼 버퍼
+ * @param protobuf protobuf 이면 Type 프레임과 본문 프레임, 아니면 JSON 프레임 하나
+ * @param type 메시지 타입
+ * @param body protobuf 본문
+ * @param message JSON 메시지, type 은 채워서 보낸다
+ */
+static void append_message(string &out, bool protobuf, Type_MessageType type, const google::protobuf::Message &body, json message) {
+  if (protobuf) {
+    Type envelope;
+    envelope.set_type(type);
+    append_frame(out, envelope.SerializeAsString());
+    append_frame(out, body.SerializeAsString());
+  } else {
+    append_frame(out, message.dump());
+  }
+}
+
+/**
+ * @brief epoll 쓰레드 하나. 맡은 클라이언트들의 입장부터 측정, 정리까지 진행한다.
+ */
+class BenchWorker {
+  private:
+    vector<unique_ptr<BenchClient>> clients;
+    BenchStats stats;
+    int epoll_fd = -1;
+    int timer_fd = -1;
+    mt19937_64 rng;
+    priority_queue<Scheduled, vector<Scheduled>, greater<Scheduled>> schedule;
+    bool join_sent = false;
+    bool run_started = false;
+
+    /**
+     * @brief 남은 데이터를 보내고, 다 못 보냈으면 EPOLLOUT 을 기다린다.
+     */
+    void flush(BenchClient &client) {
+      while (!client.outbuf.empty()) {
+        ssize_t n = send(client.fd, client.outbuf.data(), client.outbuf.size(), MSG_NOSIGNAL);
+        if (n > 0) {
+          stats.bytes_out += n;
+          client.outbuf.erase(0, n);
+          continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+          break;
+        }
+        disconnect(client, "send");
+        return;
+      }
+
+      bool want_write = !client.outbuf.empty();
+      if (want_write != client.want_write) {
+        epoll_event event {};
+        event.events = EPOLLIN | (want_write ? (uint32_t)EPOLLOUT : 0u);
+        event.data.ptr = &client;
+        epoll_ctl(epoll_fd, EPOLL_CTL_MOD, client.fd, &event);
+        client.want_write = want_write;
+      }
+    }
+
+    void disconnect(BenchClient &client, const char *where) {
+      if (!client.alive) {
+        return;
+      }
+      cerr << "client " << client.id << " disconnected (" << where << ")" << endl;
+      client.alive = false;
+      stats.disconnects++;
+      epoll_ctl(epoll_fd, EPOLL_CTL_DEL, client.fd, nullptr);
+      close(client.fd);
+    }
+
+    /**
+     * @brief 지수 분포를 따르는 다음 도착까지의 간격 (ns)
+     */
+    uint64_t next_interval(double per_second) {
+      exponential_distribution<double> interval(per_second);
+      return static_cast<uint64_t>(interval(rng) * 1e9);
+    }
+
+    void send_join(BenchClient &client) {
+      CSJoinRoom body;
+      body.set_roomid(room_ids[client.room]);
+      append_message(client.outbuf, client.protobuf, Type_MessageType_CS_JOIN_ROOM, body,
+                     {{"type", "CSJoinRoom"}, {"roomId", room_ids[client.room]}});
+      flush(client);
+    }
+
+    /**
+     * @brief 채팅 하나를 보낸다. 내용 앞에 "B<클라이언트>.<순번>.<보내기로 한 시각>|" 을 적는다.
+     *
+     * @param intended_ns 보내기로 한 시각, 지연은 이 시각부터 잰다
+     */
+    void send_chat(BenchClient &client, uint64_t intended_ns) {
+      char header[64];
+      int header_len = snprintf(header, sizeof(header), "B%d.%llu.%llu|", client.id,
+                                (unsigned long long) client.seq++, (unsigned long long) intended_ns);
+      size_t size = message_size;
+      if (message_size_max > message_size) {
+        size = uniform_int_distribution<size_t>(message_size, message_size_max)(rng);
+      }
+      string text(header, header_len);
+      if (text.size() < size) {
+        text.append(size - text.size(), 'x');
+      }
+
+      CSChat body;
+      body.set_text(text);
+      body.set_roomid(room_ids[client.room]);
+      append_message(client.outbuf, client.protobuf, Type_MessageType_CS_CHAT, body,
+                     {{"type", "CSChat"}, {"text", text}, {"roomId", room_ids[client.room]}});
+      if (intended_ns >= measure_start_ns) {
+        stats.sent++;
+      }
+      flush(client);
+    }
+
+    void send_rename(BenchClient &client) {
+      string name = name_prefix + "-" + to_string(client.id) + "-" + to_string(++client.renames);
+      CSName body;
+      body.set_name(name);
+      append_message(client.outbuf, client.protobuf, Type_MessageType_CS_NAME, body, {{"type", "CSName"}, {"name", name}});
+      stats.renames++;
+      flush(client);
+    }
+
+    /**
+     * @brief 받은 채팅의 내용에서 보낸 클라이언트와 보내기로 한 시각을 읽어 지연을 기록한다.
+     */
+    void on_chat(BenchClient &client, const string &text, uint64_t received_ns) {
+      int sender;
+      unsigned long long seq, intended_ns;
+      if (sscanf(text.c_str(), "B%d.%llu.%llu|", &sender, &seq, &intended_ns) != 3) {
+        return;
+      }
+      if (sender == client.id) {
+        if (intended_ns >= measure_start_ns && intended_ns < measure_end_ns) {
+          stats.echoes++;
+          stats.echo_ns.push_back(received_ns - intended_ns);
+        }
+        // closed loop 는 자기 채팅이 돌아와야 다음 채팅을 예약한다
+        if (mode == "closed" && phase.load() == Phase::RUN) {
+          schedule.push(Scheduled {received_ns + static_cast<uint64_t>(think_ms * 1e6), client.slot, false});
+        }
+      } else if (intended_ns >= measure_start_ns && intended_ns < measure_end_ns) {
+        stats.deliveries++;
+        stats.delivery_ns.push_back(received_ns - intended_ns);
+      }
+    }
+
+    void on_system_message(BenchClient &client, const string &text) {
+      // 방을 만들거나 들어가면 "방제[제목] 방에 입장했습니다." 를 받는다
+      if (client.joined || text.rfind("방제[", 0) != 0) {
+        return;
+      }
+      client.joined = true;
+      if (client.creator) {
+        rooms_created++;
+      }
+      clients_joined++;
+    }
+
+    /**
+     * @brief 읽을 수 있게 된 소켓에서 받아 완성된 프레임을 모두 처리한다.
+     */
+    void on_readable(BenchClient &client) {
+      ssize_t n = client.reader.read_from(client.fd);
+      if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+        disconnect(client, "recv");
+        return;
+      }
+      if (n < 0) {
+        return;
+      }
+      stats.bytes_in += n;
+      uint64_t received_ns = now_ns();
+
+      while (true) {
+        string_view frame;
+        FrameReader::Status status = client.reader.next(frame);
+        if (status == FrameReader::Status::INCOMPLETE) {
+          return;
+        } else if (status != FrameReader::Status::READY) {
+          disconnect(client, "framing");
+          return;
+        }
+
+        if (client.protobuf) {
+          string serialized(frame);
+          if (client.pending_type < 0) {
+            Type envelope;
+            envelope.ParseFromString(serialized);
+            client.pending_type = envelope.type();
+          } else {
+            if (client.pending_type == Type_MessageType_SC_CHAT) {
+              SCChat chat;
+              chat.ParseFromString(serialized);
+              on_chat(client, chat.text(), received_ns);
+            } else if (client.pending_type == Type_MessageType_SC_SYSTEM_MESSAGE) {
+              SCSystemMessage system;
+              system.ParseFromString(serialized);
+              on_system_message(client, system.text());
+            }
+            client.pending_type = -1;
+          }
+        } else {
+          json message;
+          if (!JsonScanner::parse_flat_object(frame, message)) {
+            message = json::parse(frame.begin(), frame.end(), nullptr, false);
+          }
+          if (message.is_object() && message.contains("type") && message.contains("text")) {
+            if (message["type"] == "SCChat") {
+              on_chat(client, message["text"], received_ns);
+            } else if (message["type"] == "SCSystemMessage") {
+              on_system_message(client, message["text"]);
+            }
+          }
+        }
+        client.reader.consume();
+      }
+    }
+
+    /**
+     * @brief 측정을 시작할 때 클라이언트마다 첫 보내기를 예약한다.
+     */
+    void start_run() {
+      run_started = true;
+      uint64_t start = now_ns();
+      for (size_t i = 0; i < clients.size(); ++i) {
+        if (mode == "open") {
+          schedule.push(Scheduled {start + next_interval(rate), i, false});
+        } else {
+          schedule.push(Scheduled {start, i, false});
+        }
+        if (rename_rate > 0) {
+          schedule.push(Scheduled {start + next_interval(rename_rate), i, true});
+        }
+      }
+    }
+
+    /**
+     * @brief 시각이 된 보내기를 모두 보낸다. open loop 에서 밀린 보내기는 원래 시각을 그대로 달고 한꺼번에 나간다.
+     */
+    void send_due() {
+      uint64_t now = now_ns();
+      while (!schedule.empty() && schedule.top().due <= now) {
+        Scheduled next = schedule.top();
+        schedule.pop();
+        if (next.due >= measure_end_ns) {
+          continue;
+        }
+        BenchClient &client = *clients[next.client];
+        if (!client.alive) {
+          continue;
+        }
+        if (next.rename) {
+          send_rename(client);
+          schedule.push(Scheduled {next.due + next_interval(rename_rate), next.client, true});
+        } else {
+          send_chat(client, next.due);
+          if (mode == "open") {
+            schedule.push(Scheduled {next.due + next_interval(rate), next.client, false});
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief 다음 예약 시각에 timerfd 를 맞춘다. 예약이 없으면 10 ms 뒤에 깨어나 단계가 바뀌었는지 본다.
+     */
+    void arm_timer() {
+      uint64_t due = now_ns() + 10000000;
+      if (!schedule.empty() && schedule.top().due < due) {
+        due = schedule.top().due;
+      }
+      itimerspec spec {};
+      spec.it_value.tv_sec = due / 1000000000;
+      spec.it_value.tv_nsec = due % 1000000000;
+      timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &spec, nullptr);
+    }
+
+  public:
+    explicit BenchWorker(unsigned worker_seed) : rng(worker_seed) {}
+
+    void add(unique_ptr<BenchClient> client) {
+      client->slot = clients.size();
+      clients.push_back(move(client));
+    }
+
+    /**
+     * @brief 방을 만들 클라이언트는 CSCreateRoom 을, 나머지는 CSName 만 보내고 epoll 에 등록한다.
+     */
+    void prepare() {
+      epoll_fd = epoll_create1(0);
+      timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+      epoll_event timer_event {};
+      timer_event.events = EPOLLIN;
+      timer_event.data.ptr = nullptr;
+      epoll_ctl(epoll_fd, EPOLL_CTL_ADD, timer_fd, &timer_event);
+
+      for (auto &client : clients) {
+        // 서버의 기본 포맷과 상관없이 포맷을 협상한다 (U16 프레이밍)
+        client->outbuf += static_cast<char>(0xFF);
+        client->outbuf += static_cast<char>(client->protobuf ? 1 : 0);
+
+        string name = name_prefix + "-" + to_string(client->id);
+        CSName cs_name;
+        cs_name.set_name(name);
+        append_message(client->outbuf, client->protobuf, Type_MessageType_CS_NAME, cs_name, {{"type", "CSName"}, {"name", name}});
+        if (client->creator) {
+          string title = name_prefix + "-" + to_string(getpid()) + "-" + to_string(client->room);
+          CSCreateRoom cs_create_room;
+          cs_create_room.set_title(title);
+          append_message(client->outbuf, client->protobuf, Type_MessageType_CS_CREATE_ROOM, cs_create_room,
+                         {{"type", "CSCreateRoom"}, {"title", title}});
+        }
+
+        epoll_event event {};
+        event.events = EPOLLIN;
+        event.data.ptr = client.get();
+        epoll_ctl(epoll_fd, EPOLL_CTL_ADD, client->fd, &event);
+        flush(*client);
+      }
+    }
+
+    /**
+     * @brief STOP 단계가 될 때까지 이벤트를 처리한다.
+     */
+    void run() {
+      vector<epoll_event> events(256);
+      while (phase.load() != Phase::STOP) {
+        Phase current = phase.load();
+        if (current == Phase::JOIN && !join_sent) {
+          join_sent = true;
+          for (auto &client : clients) {
+            if (!client->creator && client->alive) {
+              send_join(*client);
+            }
+          }
+        }
+        if (current == Phase::RUN && !run_started) {
+          start_run();
+        }
+        if (current == Phase::RUN) {
+          send_due();
+        }
+        arm_timer();
+
+        int n = epoll_wait(epoll_fd, events.data(), events.size(), -1);
+        for (int i = 0; i < n; ++i) {
+          if (events[i].data.ptr == nullptr) {
+            uint64_t expirations;
+            ssize_t ignored = read(timer_fd, &expirations, sizeof(expirations));
+            (void) ignored;
+            continue;
+          }
+          BenchClient &client = *static_cast<BenchClient *>(events[i].data.ptr);
+          if (!client.alive) {
+            continue;
+          }
+          if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP)) {
+            on_readable(client);
+          }
+          if (client.alive && (events[i].events & EPOLLOUT)) {
+            flush(client);
+          }
+        }
+      }
+
+      for (auto &client : clients) {
+        if (client->alive) {
+          close(client->fd);
+        }
+      }
+      close(timer_fd);
+      close(epoll_fd);
+    }
+
+    //getter
+    BenchStats &get_stats() {return stats;}
+};
+
+/**
+ * @brief 서버에 연결한다. 실패하면 프로그램을 끝낸다.
+ */
+static int connect_to_server() {
+  int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  sockaddr_in sin {};
+  sin.sin_family = AF_INET;
+  sin.sin_port = htons(port);
+  if (fd < 0 || inet_pton(AF_INET, host.c_str(), &sin.sin_addr) != 1 || connect(fd, (sockaddr *) &sin, sizeof(sin)) < 0) {
+    cerr << "connect() failed: " << strerror(errno) << endl;
+    exit(1);
+  }
+  int on = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+  return fd;
+}
+
+/**
+ * @brief 방 번호마다 클라이언트를 배정한다. 방 i 의 첫 클라이언트는 클라이언트 i 이고, 나머지는 분포를 따라 뽑는다.
+ */
+static vector<size_t> assign_rooms(mt19937_64 &rng) {
+  vector<double> weights(num_rooms, 1.0);
+  if (room_dist == "zipf") {
+    for (size_t i = 0; i < num_rooms; ++i) {
+      weights[i] = 1.0 / pow(i + 1, zipf_s);
+    }
+  }
+  discrete_distribution<size_t> pick(weights.begin(), weights.end());
+
+  vector<size_t> rooms(num_clients);
+  for (size_t i = 0; i < num_clients; ++i) {
+    if (i < num_rooms) {
+      rooms[i] = i;
+    } else if (room_dist == "zipf") {
+      rooms[i] = pick(rng);
+    } else {
+      rooms[i] = i % num_rooms;
+    }
+  }
+  return rooms;
+}
+
+/**
+ * @brief JSON 연결 하나로 방 제목 접두사를 검색해 방 번호 -> 방 ID 를 채운다.
+ */
+static bool find_room_ids() {
+  int fd = connect_to_server();
+  string prefix = name_prefix + "-" + to_string(getpid()) + "-";
+  string out;
+  out += static_cast<char>(0xFF);
+  out += static_cast<char>(0);
+  FrameReader reader(FramingMode::U16, MAX_FRAME_SIZE);
+  string cursor;
+  room_ids.assign(num_rooms, 0);
+
+  do {
+    json request = {{"type", "CSRooms"}, {"titlePrefix", prefix}, {"limit", 1000}};
+    if (!cursor.empty()) {
+      request["cursor"] = cursor;
+    }
+    append_frame(out, request.dump());
+    if (send(fd, out.data(), out.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(out.size())) {
+      close(fd);
+      return false;
+    }
+    out.clear();
+
+    json result;
+    while (true) {
+      string_view frame;
+      FrameReader::Status status = reader.next(frame);
+      if (status == FrameReader::Status::READY) {
+        result = json::parse(frame.begin(), frame.end(), nullptr, false);
+        reader.consume();
+        if (result.is_object() && result.value("type", "") == "SCRoomsResult") {
+          break;
+        }
+        continue;
+      }
+      // read_from 은 MSG_DONTWAIT 로 읽으므로 데이터가 올 때까지 poll 로 기다린다
+      pollfd readable {fd, POLLIN, 0};
+      if (status != FrameReader::Status::INCOMPLETE || poll(&readable, 1, 10000) != 1 || reader.read_from(fd) <= 0) {
+        close(fd);
+        return false;
+      }
+    }
+
+    for (auto &room : result["rooms"]) {
+      string title = room["title"];
+      size_t index = stoul(title.substr(prefix.size()));
+      if (index < num_rooms) {
+        room_ids[index] = room["roomId"];
+      }
+    }
+    cursor = result.value("nextCursor", "");
+  } while (!cursor.empty());
+
+  close(fd);
+  return count(room_ids.begin(), room_ids.end(), 0) == 0;
+}
+
+/**
+ * @brief 단계가 바뀔 조건을 기다린다. 시간 안에 되지 않으면 false.
+ */
+static bool wait_for(const function<bool()> &done) {
+  uint64_t deadline = now_ns() + SETUP_TIMEOUT_NS;
+  while (!done()) {
+    if (now_ns() > deadline) {
+      return false;
+    }
+    this_thread::sleep_for(chrono::milliseconds(10));
+  }
+  return true;
+}
+
+/**
+ * @brief 지연 분포 한 줄. 정렬해서 정확한 분위수를 구한다.
+ */
+static void print_latency(const string &label, vector<uint64_t> &samples, uint64_t count, double seconds) {
+  cout << left << setw(12) << label << right << setw(10) << count << " msgs" << setw(12) << fixed << setprecision(1)
+       << count / seconds << " msg/s";
+  if (samples.empty()) {
+    cout << endl;
+    return;
+  }
+  sort(samples.begin(), samples.end());
+  auto at = [&samples](double q) {
+    return samples[min(samples.size() - 1, static_cast<size_t>(q * samples.size()))] / 1000.0;
+  };
+  cout << setprecision(0) << "   p50 " << at(0.5) << " us  p90 " << at(0.9) << " us  p99 " << at(0.99)
+       << " us  p99.9 " << at(0.999) << " us  max " << samples.back() / 1000.0 << " us" << endl;
+}
+
+int main(int argc, char *argv[]) {
+  try {
+    for (int i = 1; i < argc; ++i) {
+      string arg = argv[i];
+      if (arg == "--help") {
+        cout << "USAGE: " << argv[0] << " [flags]" << endl
+             << "  --host, --port: 서버 주소 (default: 127.0.0.1:10221)" << endl
+             << "  --format: <json|protobuf|mixed> 클라이언트 포맷, mixed 는 번갈아 (default: json)" << endl
+             << "  --clients: 클라이언트 수 (default: 100)" << endl
+             << "  --threads: epoll 쓰레드 수 (default: 2)" << endl
+             << "  --rooms: 방 수 (default: 10)" << endl
+             << "  --room-dist: <uniform|zipf> 방 크기 분포 (default: uniform)" << endl
+             << "  --zipf-s: zipf 지수 (default: 1.0)" << endl
+             << "  --mode: <closed|open> (default: closed)" << endl
+             << "  --rate: open loop 에서 클라이언트당 초당 채팅 수 (default: 10)" << endl
+             << "  --think-ms: closed loop 에서 echo 뒤 쉬는 시간 (default: 0)" << endl
+             << "  --rename-rate: 클라이언트당 초당 이름 변경 수 (default: 0)" << endl
+             << "  --message-size, --message-size-max: 채팅 내용 바이트 수 범위 (default: 64, 고정)" << endl
+             << "  --duration, --warmup: 측정 시간과 버리는 시간, 초 (default: 10, 2)" << endl
+             << "  --name-prefix: 이름과 방 제목 접두사 (default: bench)" << endl
+             << "  --seed: 난수 씨앗 (default: 1)" << endl;
+        return 0;
+      } else if (arg.rfind("--host=", 0) == 0) {
+        host = arg.substr(7);
+      } else if (arg.rfind("--port=", 0) == 0) {
+        port = stoi(arg.substr(7));
+      } else if (arg.rfind("--format=", 0) == 0) {
+        format = arg.substr(9);
+        if (format != "json" && format != "protobuf" && format != "mixed") {
+          throw invalid_argument(arg);
+        }
+      } else if (arg.rfind("--clients=", 0) == 0) {
+        num_clients = stoull(arg.substr(10));
+      } else if (arg.rfind("--threads=", 0) == 0) {
+        num_threads = stoull(arg.substr(10));
+      } else if (arg.rfind("--rooms=", 0) == 0) {
+        num_rooms = stoull(arg.substr(8));
+      } else if (arg.rfind("--room-dist=", 0) == 0) {
+        room_dist = arg.substr(12);
+        if (room_dist != "uniform" && room_dist != "zipf") {
+          throw invalid_argument(arg);
+        }
+      } else if (arg.rfind("--zipf-s=", 0) == 0) {
+        zipf_s = stod(arg.substr(9));
+      } else if (arg.rfind("--mode=", 0) == 0) {
+        mode = arg.substr(7);
+        if (mode != "closed" && mode != "open") {
+          throw invalid_argument(arg);
+        }
+      } else if (arg.rfind("--rate=", 0) == 0) {
+        rate = stod(arg.substr(7));
+      } else if (arg.rfind("--think-ms=", 0) == 0) {
+        think_ms = stod(arg.substr(11));
+      } else if (arg.rfind("--rename-rate=", 0) == 0) {
+        rename_rate = stod(arg.substr(14));
+      } else if (arg.rfind("--message-size=", 0) == 0) {
+        message_size = stoull(arg.substr(15));
+      } else if (arg.rfind("--message-size-max=", 0) == 0) {
+        message_size_max = stoull(arg.substr(19));
+      } else if (arg.rfind("--duration=", 0) == 0) {
+        duration = stod(arg.substr(11));
+      } else if (arg.rfind("--warmup=", 0) == 0) {
+        warmup = stod(arg.substr(9));
+      } else if (arg.rfind("--name-prefix=", 0) == 0) {
+        name_prefix = arg.substr(14);
+      } else if (arg.rfind("--seed=", 0) == 0) {
+        seed = stoul(arg.substr(7));
+      } else {
+        throw invalid_argument(arg);
+      }
+    }
+    if (num_clients == 0 || num_threads == 0 || num_rooms == 0 || num_rooms > num_clients || (mode == "open" && rate <= 0)) {
+      throw invalid_argument("clients >= rooms >= 1, threads >= 1, rate > 0");
+    }
+  } catch (const exception &e) {
+    cerr << "Error: " << e.what() << endl;
+    return 1;
+  }
+
+  mt19937_64 rng(seed);
+  vector<size_t> rooms = assign_rooms(rng);
+  vector<size_t> room_sizes(num_rooms);
+  for (size_t room : rooms) {
+    room_sizes[room]++;
+  }
+
+  vector<unique_ptr<BenchWorker>> workers;
+  for (size_t i = 0; i < num_threads; ++i) {
+    workers.emplace_back(new BenchWorker(seed * 7919 + i));
+  }
+  size_t protobuf_clients = 0;
+  for (size_t i = 0; i < num_clients; ++i) {
+    bool protobuf = format == "protobuf" || (format == "mixed" && i % 2 == 1);
+    protobuf_clients += protobuf;
+    unique_ptr<BenchClient> client(new BenchClient(static_cast<int>(i), protobuf, rooms[i], i < num_rooms));
+    client->fd = connect_to_server();
+    workers[i % num_threads]->add(move(client));
+  }
+  for (auto &worker : workers) {
+    worker->prepare();
+  }
+  vector<thread> threads;
+  for (auto &worker : workers) {
+    threads.emplace_back([&worker]() {worker->run();});
+  }
+
+  cout << "chat_bench: " << num_clients << " clients (json " << num_clients - protobuf_clients << ", protobuf " << protobuf_clients
+       << "), " << num_rooms << " rooms (" << room_dist << ", largest " << *max_element(room_sizes.begin(), room_sizes.end())
+       << "), " << mode << " loop";
+  if (mode == "open") {
+    cout << " " << rate << " msg/s/client";
+  } else {
+    cout << " think " << think_ms << " ms";
+  }
+  cout << ", " << message_size << "-" << max(message_size, message_size_max) << " bytes, " << num_threads << " threads" << endl;
+
+  // 방을 만들고 ID 를 찾은 뒤 나머지가 입장한다
+  bool ready = wait_for([]() {return rooms_created.load() == num_rooms;}) && find_room_ids();
+  if (ready) {
+    phase.store(Phase::JOIN);
+    ready = wait_for([]() {return clients_joined.load() == num_clients;});
+  }
+  if (!ready) {
+    cerr << "Error: setup timed out (rooms " << rooms_created.load() << "/" << num_rooms << ", joined "
+         << clients_joined.load() << "/" << num_clients << ")" << endl;
+    phase.store(Phase::STOP);
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    return 1;
+  }
+
+  uint64_t start = now_ns();
+  measure_start_ns = start + static_cast<uint64_t>(warmup * 1e9);
+  measure_end_ns = measure_start_ns + static_cast<uint64_t>(duration * 1e9);
+  phase.store(Phase::RUN);
+  this_thread::sleep_for(chrono::nanoseconds(measure_end_ns - start));
+  phase.store(Phase::DRAIN);
+  this_thread::sleep_for(chrono::nanoseconds(DRAIN_NS));
+  phase.store(Phase::STOP);
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  BenchStats total;
+  for (auto &worker : workers) {
+    BenchStats &stats = worker->get_stats();
+    total.echo_ns.insert(total.echo_ns.end(), stats.echo_ns.begin(), stats.echo_ns.end());
+    total.delivery_ns.insert(total.delivery_ns.end(), stats.delivery_ns.begin(), stats.delivery_ns.end());
+    total.sent += stats.sent;
+    total.echoes += stats.echoes;
+    total.deliveries += stats.deliveries;
+    total.renames += stats.renames;
+    total.bytes_in += stats.bytes_in;
+    total.bytes_out += stats.bytes_out;
+    total.disconnects += stats.disconnects;
+  }
+
+  vector<uint64_t> none;
+  print_latency("sent", none, total.sent, duration);
+  print_latency("echo", total.echo_ns, total.echoes, duration);
+  print_latency("delivered", total.delivery_ns, total.deliveries, duration);
+  cout << "not echoed  " << setw(10) << total.sent - min(total.sent, total.echoes) << " msgs" << endl;
+  cout << "renames " << total.renames << ", bytes in " << total.bytes_in << ", bytes out " << total.bytes_out
+       << ", disconnects " << total.disconnects << endl;
+  return total.disconnects == 0 ? 0 : 1;
+}
@@ -0,0 +1,376 @@
+/**
+ * @file chat_replay.cpp
+ * @brief chat_server --capture-file 로 남긴 트래픽을 서버에 같은 시간 간격 (또는 N 배 빠르게) 으로 다시 보내는 재생기
+ *
+ * 캡처의 연결마다 TCP 연결을 하나 열고, 레코드의 시각에 맞춰 연결을 열고 프레임을 보내고 연결을 닫는다.
+ * 프레임은 캡처된 바이트 그대로 보내고, 연결의 첫 프레임 앞에는 캡처된 포맷과 프레이밍으로 협상 바이트를 붙인다.
+ * 서버가 보내는 것은 읽어서 버리기만 한다. 방 ID 는 서버가 만든 순서로 정해지므로 캡처를 시작할 때와 같은 (빈) 상태의
+ * 서버에 재생해야 같은 방으로 들어간다.
+ *
+ * 쓰레드 하나가 epoll 로 모든 연결을 다룬다. 보내기로 한 시각보다 늦게 보낸 정도를 lag 로 재서, 재생기가 원래 속도를
+ * 따라가지 못한 것인지 (lag 가 큼) 서버가 느려진 것인지 구분할 수 있게 한다.
+ *
+ * 예) ./chat_replay --file=/tmp/chat.cap --speed=4
+ */
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "framing.h"
+#include "capture.h"
+
+using namespace std;
+
+string host = "127.0.0.1"; ///< 서버 주소 (IPv4)
+int port = 10221; ///< 서버 포트
+string capture_path; ///< 재생할 캡처 파일
+double speed = 1; ///< 재생 속도 배수, 0 이면 기다리지 않고 최대한 빨리
+double drain = 1; ///< 다 보낸 뒤 서버의 응답을 더 읽는 시간 (초)
+
+static const uint8_t HANDSHAKE_MAGIC = 0xFF; ///< chat_server.cpp 와 같은 값
+
+/**
+ * @brief CLOCK_MONOTONIC 시각 (ns)
+ */
+static uint64_t now_ns() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+/**
+ * @brief 재생 중인 연결 하나
+ */
+struct ReplayConnection {
+  int fd = -1;
+  string outbuf; ///< 소켓이 받아주지 않아 남은 보낼 데이터
+  bool want_write = false;
+  bool handshake_sent = false;
+  bool closing = false; ///< 남은 데이터를 다 보내면 쓰기 쪽을 닫는다
+  bool shut = false; ///< 쓰기 쪽을 닫고 서버가 닫기를 기다린다
+  bool dead = false; ///< 서버가 끊었거나 닫았다, 이후 레코드는 건너뛴다
+};
+
+/**
+ * @brief 재생 결과
+ */
+struct ReplayStats {
+  uint64_t connections = 0;
+  uint64_t frames = 0;
+  uint64_t bytes_out = 0;
+  uint64_t bytes_in = 0;
+  uint64_t skipped = 0; ///< 끊긴 연결로 가는 프레임이라 보내지 못한 수
+  uint64_t server_closed = 0; ///< 캡처에서 닫기 전에 서버가 끊은 연결 수
+  vector<uint64_t> lag_ns; ///< 레코드마다 보내기로 한 시각보다 늦은 정도
+};
+
+unordered_map<uint32_t, ReplayConnection> connections;
+ReplayStats stats;
+int epoll_fd = -1;
+size_t open_connections = 0;
+
+/**
+ * @brief 서버에 연결하고 논블로킹으로 바꾼다.
+ *
+ * @return 연결하지 못했으면 -1
+ */
+static int connect_to_server() {
+  int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  sockaddr_in sin {};
+  sin.sin_family = AF_INET;
+  sin.sin_port = htons(port);
+  if (fd < 0 || inet_pton(AF_INET, host.c_str(), &sin.sin_addr) != 1 || connect(fd, (sockaddr *) &sin, sizeof(sin)) < 0) {
+    cerr << "connect() failed: " << strerror(errno) << endl;
+    if (fd >= 0) {
+      close(fd);
+    }
+    return -1;
+  }
+  int on = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  return fd;
+}
+
+static void close_connection(ReplayConnection &connection) {
+  epoll_ctl(epoll_fd, EPOLL_CTL_DEL, connection.fd, nullptr);
+  close(connection.fd);
+  connection.fd = -1;
+  connection.dead = true;
+  open_connections--;
+}
+
+static void watch(uint32_t id, ReplayConnection &connection) {
+  epoll_event event {};
+  event.events = EPOLLIN;
+  event.data.u64 = id;
+  epoll_ctl(epoll_fd, EPOLL_CTL_ADD, connection.fd, &event);
+}
+
+/**
+ * @brief 남은 데이터를 소켓이 받는 만큼 보낸다. 다 보냈고 닫기로 했으면 쓰기 쪽을 닫는다.
+ *
+ * 읽지 않은 응답이 남은 소켓을 바로 close 하면 RST 가 가서 서버가 아직 읽지 않은 프레임을 잃으므로,
+ * shutdown 으로 EOF 를 보내고 서버가 남은 프레임을 처리한 뒤 닫을 때까지 읽는다.
+ */
+static void flush_output(uint32_t id, ReplayConnection &connection) {
+  while (!connection.outbuf.empty()) {
+    ssize_t n = send(connection.fd, connection.outbuf.data(), connection.outbuf.size(), MSG_NOSIGNAL);
+    if (n < 0) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        break;
+      }
+      stats.server_closed++;
+      close_connection(connection);
+      return;
+    }
+    stats.bytes_out += n;
+    connection.outbuf.erase(0, n);
+  }
+
+  if (connection.outbuf.empty() && connection.closing) {
+    if (!connection.shut) {
+      shutdown(connection.fd, SHUT_WR);
+      connection.shut = true;
+    }
+  } else if (connection.outbuf.empty() == connection.want_write) {
+    epoll_event event {};
+    event.events = EPOLLIN | (connection.outbuf.empty() ? 0u : (uint32_t)EPOLLOUT);
+    event.data.u64 = id;
+    epoll_ctl(epoll_fd, EPOLL_CTL_MOD, connection.fd, &event);
+    connection.want_write = !connection.outbuf.empty();
+  }
+}
+
+/**
+ * @brief 서버가 보낸 것을 읽어 버린다. 서버가 끊었으면 연결을 닫는다.
+ */
+static void drain_input(ReplayConnection &connection) {
+  char buffer[65536];
+  while (true) {
+    ssize_t n = recv(connection.fd, buffer, sizeof(buffer), 0);
+    if (n > 0) {
+      stats.bytes_in += n;
+      continue;
+    }
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      return;
+    }
+    if (!connection.closing) {
+      stats.server_closed++;
+    }
+    close_connection(connection);
+    return;
+  }
+}
+
+/**
+ * @brief 레코드 하나를 재생한다.
+ *
+ * @return 서버에 연결하지 못했으면 false
+ */
+static bool apply(const CaptureRecord &record) {
+  ReplayConnection &connection = connections[record.connection];
+  if (record.kind == CaptureKind::OPEN || (record.kind == CaptureKind::FRAME && connection.fd < 0 && !connection.dead)) {
+    if (connection.fd >= 0) {
+      return true;
+    }
+    connection.fd = connect_to_server();
+    if (connection.fd < 0) {
+      return false;
+    }
+    stats.connections++;
+    open_connections++;
+    watch(record.connection, connection);
+  }
+
+  if (record.kind == CaptureKind::FRAME) {
+    if (connection.dead) {
+      stats.skipped++;
+      return true;
+    }
+    if (!connection.handshake_sent) {
+      connection.outbuf += static_cast<char>(HANDSHAKE_MAGIC);
+      connection.outbuf += static_cast<char>(record.format | (record.framing << 4));
+      connection.handshake_sent = true;
+    }
+    char prefix[MAX_LENGTH_PREFIX];
+    size_t len = encode_length_prefix(static_cast<FramingMode>(record.framing), record.payload.size(), prefix);
+    connection.outbuf.append(prefix, len);
+    connection.outbuf += record.payload;
+    stats.frames++;
+    flush_output(record.connection, connection);
+  } else if (record.kind == CaptureKind::CLOSE && connection.fd >= 0) {
+    connection.closing = true;
+    flush_output(record.connection, connection);
+  }
+  return true;
+}
+
+/**
+ * @brief 소켓 이벤트를 timeout_ms 동안 기다려 처리한다.
+ */
+static void poll_events(int timeout_ms) {
+  epoll_event events[256];
+  int n = epoll_wait(epoll_fd, events, 256, timeout_ms);
+  for (int i = 0; i < n; ++i) {
+    uint32_t id = static_cast<uint32_t>(events[i].data.u64);
+    ReplayConnection &connection = connections[id];
+    if (connection.fd < 0) {
+      continue;
+    }
+    if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+      drain_input(connection);
+    }
+    if (connection.fd >= 0 && (events[i].events & EPOLLOUT)) {
+      flush_output(id, connection);
+    }
+  }
+}
+
+static uint64_t percentile(const vector<uint64_t> &sorted, double q) {
+  return sorted.empty() ? 0 : sorted[static_cast<size_t>(q * (sorted.size() - 1))];
+}
+
+int main(int argc, char *argv[]) {
+  try {
+    for (int i = 1; i < argc; ++i) {
+      string arg = argv[i];
+      if (arg == "--help") {
+        cout << "USAGE: " << argv[0] << " --file=CAPTURE [flags]" << endl
+             << "  --file: chat_server --capture-file 로 남긴 캡처 파일" << endl
+             << "  --host, --port: 서버 주소 (default: 127.0.0.1:10221)" << endl
+             << "  --speed: 재생 속도 배수, 0 이면 기다리지 않고 최대한 빨리 (default: 1)" << endl
+             << "  --drain: 다 보낸 뒤 응답을 더 읽는 시간, 초 (default: 1)" << endl;
+        return 0;
+      } else if (arg.rfind("--file=", 0) == 0) {
+        capture_path = arg.substr(7);
+      } else if (arg.rfind("--host=", 0) == 0) {
+        host = arg.substr(7);
+      } else if (arg.rfind("--port=", 0) == 0) {
+        port = stoi(arg.substr(7));
+      } else if (arg.rfind("--speed=", 0) == 0) {
+        speed = stod(arg.substr(8));
+      } else if (arg.rfind("--drain=", 0) == 0) {
+        drain = stod(arg.substr(8));
+      } else {
+        throw invalid_argument(arg);
+      }
+    }
+    if (capture_path.empty() || speed < 0) {
+      throw invalid_argument("--file is required, speed >= 0");
+    }
+  } catch (const exception &e) {
+    cerr << "Error: " << e.what() << endl;
+    return 1;
+  }
+
+  ifstream in(capture_path, ios::binary);
+  char magic[sizeof(CAPTURE_MAGIC)];
+  if (!in.read(magic, sizeof(magic)) || memcmp(magic, CAPTURE_MAGIC, sizeof(magic)) != 0) {
+    cerr << "Error: " << capture_path << " is not a chat_server capture" << endl;
+    return 1;
+  }
+  vector<CaptureRecord> records;
+  CaptureRecord record;
+  while (read_capture_record(in, record)) {
+    records.push_back(move(record));
+  }
+  if (records.empty()) {
+    cerr << "Error: " << capture_path << " has no records" << endl;
+    return 1;
+  }
+  // 쓰레드마다의 버퍼에서 온 레코드는 시각이 섞여 있다. 한 연결의 순서는 그대로 두고 시각으로 줄 세운다
+  stable_sort(records.begin(), records.end(), [](const CaptureRecord &a, const CaptureRecord &b) {return a.time_ns < b.time_ns;});
+  uint64_t base_ns = records.front().time_ns;
+  double span = (records.back().time_ns - base_ns) / 1e9;
+
+  size_t capture_connections = 0, capture_frames = 0, capture_bytes = 0;
+  for (auto &entry : records) {
+    capture_connections += entry.kind == CaptureKind::OPEN;
+    capture_frames += entry.kind == CaptureKind::FRAME;
+    capture_bytes += entry.payload.size();
+  }
+  cout << "chat_replay: " << records.size() << " records (" << capture_connections << " connections, " << capture_frames << " frames, "
+       << capture_bytes << " bytes) spanning " << fixed << setprecision(2) << span << " s, speed ";
+  if (speed == 0) {
+    cout << "max" << endl;
+  } else {
+    cout << speed << "x" << endl;
+  }
+
+  epoll_fd = epoll_create1(0);
+  uint64_t start = now_ns();
+  for (size_t next = 0; next < records.size();) {
+    uint64_t now = now_ns();
+    // 최대 속도에서도 응답을 읽으며 보내도록 한 번에 64 개까지만 재생한다
+    for (size_t batch = 0; batch < 64 && next < records.size(); ++batch) {
+      uint64_t due = start + (speed == 0 ? 0 : static_cast<uint64_t>((records[next].time_ns - base_ns) / speed));
+      if (due > now) {
+        break;
+      }
+      stats.lag_ns.push_back(now - due);
+      if (!apply(records[next])) {
+        return 1;
+      }
+      ++next;
+    }
+    int timeout_ms = 0;
+    if (next < records.size() && speed != 0) {
+      uint64_t due = start + static_cast<uint64_t>((records[next].time_ns - base_ns) / speed);
+      timeout_ms = static_cast<int>(min<uint64_t>((due - min(due, now_ns()) + 999999) / 1000000, 100));
+    }
+    poll_events(timeout_ms);
+  }
+  uint64_t sent_at = now_ns();
+
+  // 남은 데이터를 보내고 늦게 오는 응답을 읽는다. 캡처에서 닫힌 연결은 서버가 닫을 때까지 기다린다
+  uint64_t drain_end = sent_at + static_cast<uint64_t>(drain * 1e9);
+  uint64_t give_up = drain_end + 30ull * 1000000000;
+  auto shutting = []() {
+    for (auto &entry : connections) {
+      if (entry.second.fd >= 0 && entry.second.closing) {
+        return true;
+      }
+    }
+    return false;
+  };
+  while (now_ns() < drain_end || (shutting() && now_ns() < give_up)) {
+    poll_events(10);
+  }
+  for (auto &entry : connections) {
+    if (entry.second.fd >= 0) {
+      close(entry.second.fd);
+    }
+  }
+
+  double elapsed = (sent_at - start) / 1e9;
+  sort(stats.lag_ns.begin(), stats.lag_ns.end());
+  cout << "replayed " << stats.frames << " frames on " << stats.connections << " connections in " << elapsed << " s (target "
+       << (speed == 0 ? 0 : span / speed) << " s), " << setprecision(1) << (elapsed > 0 ? stats.frames / elapsed : 0) << " frames/s" << endl;
+  // 최대 속도에서는 모든 레코드를 시작할 때 보낼 것으로 치므로 lag 가 뜻이 없다
+  if (speed != 0) {
+    cout << "lag p50/p99/max us: " << percentile(stats.lag_ns, 0.5) / 1000 << "/" << percentile(stats.lag_ns, 0.99) / 1000 << "/"
+         << stats.lag_ns.back() / 1000 << endl;
+  }
+  cout << "bytes out " << stats.bytes_out << ", in " << stats.bytes_in << ", server closed " << stats.server_closed
+       << " connections, skipped " << stats.skipped << " frames" << endl;
+  return 0;
+}
@@ -5,9 +5,12 @@
 
 #include <arpa/inet.h>
 #include <errno.h>
+#include <limits.h>
 #include <string.h>
 #include <sys/socket.h>
 #include <sys/select.h>
+#include <sys/uio.h>
+#include <signal.h>
 #include <unistd.h>
 #include "message.pb.h"
 
@@ -19,14 +22,36 @@
 #include <string>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
+#include <memory>
 #include <queue>
 #include <vector>
 #include <set>
 #include <functional>
 #include <atomic>
 #include <stdexcept>
+#include <string_view>
+#include <algorithm>
+#include <charconv>
 
 #include </home/students/2024-2/u60182195/git/mju_backend_60182195/chat_server/nlohmann/json.hpp>
+#include "json_scanner.h"
+#include "flat_message.h"
+#include "server_message.h"
+#include "framing.h"
+#include "room_table.h"
+#include "member_list.h"
+#include "name_table.h"
+#include "room_search.h"
+#include "fanout.h"
+#include "presence.h"
+#include "outbound.h"
+#include "metrics.h"
+#include "admin_server.h"
+#include "trace.h"
+#include "lock_profile.h"
+#include "capture.h"
+#include "sampler.h"
 
 using namespace std;
 using namespace mju;
@@ -34,17 +59,275 @@ using json = nlohmann::json;
 using Index = int;
 
 static const uint16_t PORT = 10221; ///< 서버 포트 번호
-string format = "json"; ///< 기본 메시지 포맷
+static const uint8_t HANDSHAKE_MAGIC = 0xFF; ///< 연결 직후 이 바이트가 오면 다음 바이트가 그 연결의 메시지 포맷
+static const size_t LEGACY_MAX_FRAME_SIZE = 0xFEFF; ///< 협상하지 않은 연결이 보낼 수 있는 가장 긴 프레임, 길이 prefix 가 HANDSHAKE_MAGIC 으로 시작하지 않는다
+string format = "json"; ///< 기본 메시지 포맷, 포맷 협상을 하지 않은 연결이 쓴다
+size_t max_frame_size = 16 * 1024 * 1024; ///< 받을 수 있는 가장 큰 프레임의 길이
+size_t fanout_threads = 2; ///< 큰 방의 브로드캐스트를 나눠 보낼 쓰레드(샤드) 수, 0 이면 쓰지 않는다
+size_t fanout_threshold = 1024; ///< 멤버가 이만큼 모이면 방의 브로드캐스트를 fan-out 쓰레드로 넘긴다
+size_t max_outbound_bytes = 16 * 1024 * 1024; ///< 클라이언트 하나에게 보내지 못하고 쌓아 둘 수 있는 바이트 수, 넘으면 연결을 끊는다
+int admin_port = 0; ///< 지표를 내주는 관리용 HTTP 포트, 0 이면 열지 않는다
+string admin_bind = "127.0.0.1"; ///< 관리용 HTTP 서버가 바인드할 주소, 인증이 없으므로 기본은 loopback 이다
+int latency_log_interval = 60; ///< 핸들러 지연 요약을 로그에 남기는 주기 (초), 0 이면 남기지 않는다
+string trace_file; ///< 뽑힌 메시지의 단계별 span 을 쓸 Chrome trace-event 파일, 비어 있으면 추적하지 않는다
+uint64_t trace_sample = 100; ///< 메시지 이만큼에 하나를 추적한다
+size_t trace_rotate_bytes = 64 * 1024 * 1024; ///< 추적 파일이 이만큼 커지면 회전한다, 0 이면 회전하지 않는다
+bool lock_profile = false; ///< room_mutex 와 queue_mutex 의 경합과 잡은 시간을 기록할지
+string capture_file; ///< 받은 프레임을 모두 남길 캡처 파일, 비어 있으면 캡처하지 않는다
+size_t capture_buffer_bytes = 8 * 1024 * 1024; ///< 캡처할 때 쓰레드마다 두는 링 버퍼 크기
+int profile_hz = 0; ///< 쓰레드마다 CPU 시간 1초에 뜰 스택 샘플 수, 0 이면 샘플링하지 않는다
+int profile_window = 60; ///< /profile 과 SIGUSR2 가 내는 최근 샘플의 기간 (초)
+string profile_file = "chat_server.folded"; ///< SIGUSR2 를 받으면 folded stack 을 쓸 파일
 
 // 프로그램 종료를 위한 atomic flag
 atomic<bool> quit(false);
 
 // 클라이언트 메시지를 처리하기 위한 큐
-queue<int> task_queue;
-mutex queue_mutex;
-condition_variable task_cv;
+/**
+ * @brief 워커를 기다리는 소켓 하나
+ */
+struct Task {
+  int sock;
+  uint64_t enqueued_ns; ///< 큐에 넣은 시각, metric_now_ns()
+  uint32_t enqueue_thread; ///< 큐에 넣은 쓰레드의 Tracer::thread_id()
+};
+queue<Task> task_queue;
+ProfiledMutex queue_mutex("queue");
+condition_variable_any task_cv;
+
+ProfiledMutex room_mutex("room"); // 방의 원자성을 위한 뮤텍스
+
+// SIGUSR1 을 받으면 메인 루프가 락 프로파일을 로그에 남긴다
+atomic<bool> lock_report_requested(false);
+
+/**
+ * @brief room_mutex 와 queue_mutex 의 호출 위치별 통계
+ */
+string lock_report() {
+  if (!ProfiledMutex::enabled()) {
+    return "lock profiling is disabled, run with --lock-profile=1\n";
+  }
+  return room_mutex.report() + queue_mutex.report();
+}
+
+/**
+ * @brief 워커가 처리 중인 소켓 읽기의 시각들. 추적으로 뽑힌 메시지가 핸들러 앞 단계의 span 을 남길 때 쓴다.
+ *
+ * 워커 밖에서 부른 핸들러 (벤치마크 등) 에서는 모두 0 이고 그 span 들은 남지 않는다.
+ */
+struct FrameTrace {
+  uint32_t enqueue_thread = 0; ///< 소켓을 큐에 넣은 쓰레드의 Tracer::thread_id()
+  uint64_t enqueued_ns = 0; ///< 큐에 넣은 시각
+  uint64_t dequeued_ns = 0; ///< 워커가 꺼낸 시각
+  uint64_t recv_start_ns = 0; ///< recv 를 시작한 시각, 추적 중이 아니면 0
+  uint64_t recv_end_ns = 0; ///< recv 가 끝난 시각, 추적 중이 아니면 0
+};
+thread_local FrameTrace frame_trace;
+
+/**
+ * @brief protobuf 메시지 타입의 지표 라벨. JSON 의 type 과 같은 이름을 쓴다. 예) SC_ROOMS_RESULT -> SCRoomsResult
+ */
+string message_type_label(int type) {
+  string name = Type_MessageType_Name(static_cast<Type_MessageType>(type));
+  string label = name.substr(0, 2);
+  bool upper = true;
+  for (size_t i = 3; i < name.size(); ++i) {
+    if (name[i] == '_') {
+      upper = true;
+      continue;
+    }
+    label += upper ? name[i] : (char)tolower(name[i]);
+    upper = false;
+  }
+  return label;
+}
+
+/**
+ * @brief 서버가 핫패스에서 기록하는 지표들. 처음 쓸 때 레지스트리에 한 번 등록된다.
+ */
+struct ServerMetrics {
+  Counter &connections_accepted;
+  Counter &connections_closed;
+  Gauge &connections_open;
+  Counter &bytes_in;
+  Counter &bytes_out;
+  Counter *frames_out[Type_MessageType_MessageType_ARRAYSIZE] = {}; ///< SC_ 타입별 보낸 프레임 수
+  Gauge &task_queue_depth;
+  Histogram &task_queue_depth_at_enqueue; ///< 넣을 때마다 본 큐 길이, 스크레이프 사이의 순간적인 쌓임도 남긴다
+  Histogram &task_queue_delay; ///< 큐에 넣고 워커가 꺼낼 때까지 (ns)
+  Counter &worker_busy; ///< 워커가 소켓을 처리한 시간 (ns)
+  Counter &worker_idle; ///< 워커가 일을 기다린 시간 (ns)
+  Counter &worker_wakeups; ///< task_cv 에서 깨어난 횟수, 깨어났는데 큐가 비어 있던 경우 포함
+  Counter &worker_tasks; ///< 워커가 꺼낸 소켓 수
+  Counter &worker_frames; ///< 워커가 처리한 프레임 수
+
+  ServerMetrics()
+    : connections_accepted(MetricsRegistry::instance().counter("chat_connections_accepted_total", "받아들인 연결 수")),
+      connections_closed(MetricsRegistry::instance().counter("chat_connections_closed_total", "닫힌 연결 수")),
+      connections_open(MetricsRegistry::instance().gauge("chat_connections_open", "열려 있는 연결 수")),
+      bytes_in(MetricsRegistry::instance().counter("chat_bytes_in_total", "클라이언트에게서 받은 바이트 수")),
+      bytes_out(MetricsRegistry::instance().counter("chat_bytes_out_total", "클라이언트에게 보낸 바이트 수")),
+      task_queue_depth(MetricsRegistry::instance().gauge("chat_task_queue_depth", "워커를 기다리는 소켓 수")),
+      task_queue_depth_at_enqueue(MetricsRegistry::instance().histogram("chat_task_queue_depth_at_enqueue", "소켓을 넣은 직후의 큐 길이")),
+      task_queue_delay(MetricsRegistry::instance().histogram("chat_task_queue_delay_seconds", "소켓이 큐에서 워커를 기다린 시간", "", 1e-9)),
+      worker_busy(MetricsRegistry::instance().counter("chat_worker_busy_seconds_total", "워커가 소켓을 처리한 시간", "", 1e-9)),
+      worker_idle(MetricsRegistry::instance().counter("chat_worker_idle_seconds_total", "워커가 일을 기다린 시간", "", 1e-9)),
+      worker_wakeups(MetricsRegistry::instance().counter("chat_worker_wakeups_total", "워커가 task_cv 에서 깨어난 횟수")),
+      worker_tasks(MetricsRegistry::instance().counter("chat_worker_tasks_total", "워커가 큐에서 꺼낸 소켓 수")),
+      worker_frames(MetricsRegistry::instance().counter("chat_worker_frames_total", "워커가 처리한 프레임 수")) {
+    for (int type = 0; type < Type_MessageType_MessageType_ARRAYSIZE; ++type) {
+      if (Type_MessageType_IsValid(type) && Type_MessageType_Name(static_cast<Type_MessageType>(type)).rfind("SC_", 0) == 0) {
+        frames_out[type] = &MetricsRegistry::instance().counter("chat_frames_out_total", "보낸 메시지 프레임 수",
+                                                                "type=\"" + message_type_label(type) + "\"");
+      }
+    }
+  }
+
+  static ServerMetrics &instance() {
+    static ServerMetrics metrics;
+    return metrics;
+  }
 
-mutex room_mutex; // 방의 원자성을 위한 뮤텍스
+  /**
+   * @brief 지난 요약 뒤로의 큐 대기 시간, 큐 길이, 워커 사용률을 한 줄로 만든다. 한 쓰레드에서만 부른다.
+   *
+   * @param interval 요약 주기 (초)
+   * @return 요약 한 줄, 그 사이 꺼낸 소켓이 없으면 빈 문자열
+   */
+  string queue_summary(int interval) {
+    HistogramSnapshot delay = task_queue_delay.snapshot();
+    HistogramSnapshot depth = task_queue_depth_at_enqueue.snapshot();
+    uint64_t busy = worker_busy.value(), idle = worker_idle.value();
+    uint64_t wakeups = worker_wakeups.value(), frames = worker_frames.value();
+
+    HistogramSnapshot recent_delay = delay, recent_depth = depth;
+    recent_delay.subtract(last_delay);
+    recent_depth.subtract(last_depth);
+    uint64_t recent_busy = busy - last_busy, recent_idle = idle - last_idle;
+    uint64_t recent_wakeups = wakeups - last_wakeups, recent_frames = frames - last_frames;
+    last_delay = move(delay);
+    last_depth = move(depth);
+    last_busy = busy;
+    last_idle = idle;
+    last_wakeups = wakeups;
+    last_frames = frames;
+
+    if (recent_delay.count == 0) {
+      return "";
+    }
+    char line[256];
+    snprintf(line, sizeof(line), "task queue last %ds: tasks=%llu delay p50/p99 us=%llu/%llu, depth max=%llu, worker busy %.1f%%, wakeups/frame %.2f",
+             interval, (unsigned long long) recent_delay.count, (unsigned long long) (recent_delay.quantile(0.5) / 1000),
+             (unsigned long long) (recent_delay.quantile(0.99) / 1000), (unsigned long long) recent_depth.quantile(1),
+             recent_busy + recent_idle == 0 ? 0.0 : 100.0 * recent_busy / (recent_busy + recent_idle),
+             recent_frames == 0 ? 0.0 : (double) recent_wakeups / recent_frames);
+    return line;
+  }
+
+  HistogramSnapshot last_delay; ///< 지난 요약 때의 값들, queue_summary() 만 쓴다
+  HistogramSnapshot last_depth;
+  uint64_t last_busy = 0;
+  uint64_t last_idle = 0;
+  uint64_t last_wakeups = 0;
+  uint64_t last_frames = 0;
+};
+
+/**
+ * @brief 포맷과 메시지 타입 하나의 처리 지연 히스토그램들 (ns)
+ *
+ * 한 메시지의 처리 시간을 파싱, 핸들러 로직, 전송/브로드캐스트 세 단계로 나눠 기록한다.
+ * 단계별 분위수는 더해지지 않으므로 세 단계를 합친 시간도 따로 기록한다.
+ */
+class HandlerLatency {
+  private:
+    static map<string, unique_ptr<HandlerLatency>> &all() {
+      static map<string, unique_ptr<HandlerLatency>> latencies;
+      return latencies;
+    }
+
+    static mutex &all_mutex() {
+      static mutex latencies_mutex;
+      return latencies_mutex;
+    }
+
+    static Histogram &phase_histogram(const string &format, const string &type, const string &phase) {
+      return MetricsRegistry::instance().histogram("chat_handler_latency_seconds", "메시지 하나의 단계별 처리 시간",
+                                                   "format=\"" + format + "\",type=\"" + type + "\",phase=\"" + phase + "\"", 1e-9);
+    }
+
+    /**
+     * @brief 지난 요약 뒤로 기록된 값의 "p50/p99" (us)
+     */
+    static string recent_quantiles(const Histogram &histogram, HistogramSnapshot &last) {
+      HistogramSnapshot current = histogram.snapshot();
+      HistogramSnapshot recent = current;
+      recent.subtract(last);
+      last = move(current);
+      return to_string(recent.quantile(0.5) / 1000) + "/" + to_string(recent.quantile(0.99) / 1000);
+    }
+
+    string format;
+    string type;
+    HistogramSnapshot last_total; ///< 지난 요약 로그 때의 스냅샷들, 요약을 만드는 쓰레드만 쓴다
+    HistogramSnapshot last_parse;
+    HistogramSnapshot last_logic;
+    HistogramSnapshot last_send;
+
+  public:
+    Histogram &parse; ///< 프레임을 메시지로 해석하는 시간
+    Histogram &logic; ///< 핸들러에서 파싱과 전송을 뺀 시간
+    Histogram &send; ///< 응답 전송과 브로드캐스트 (인코딩 포함) 시간
+    Histogram &total; ///< 세 단계를 합친 시간
+
+    /**
+     * @brief 생성자, 레지스트리에 단계별 히스토그램을 등록.
+     * 
+     * @param format 메시지 포맷 라벨
+     * @param type 메시지 타입 라벨
+     */
+    HandlerLatency(const string &format, const string &type)
+      : format(format), type(type),
+        parse(phase_histogram(format, type, "parse")), logic(phase_histogram(format, type, "handler")),
+        send(phase_histogram(format, type, "send")), total(phase_histogram(format, type, "total")) {}
+
+    /**
+     * @brief 포맷과 타입의 히스토그램들. 처음 부를 때 만들고 이후로는 같은 것을 돌려준다.
+     */
+    static HandlerLatency &get(const string &format, const string &type) {
+      lock_guard<mutex> lock(all_mutex());
+      auto &slot = all()[format + "/" + type];
+      if (slot == nullptr) {
+        slot.reset(new HandlerLatency(format, type));
+      }
+      return *slot;
+    }
+
+    /**
+     * @brief 지난 요약 뒤로 처리된 메시지들의 p50/p99 를 타입과 포맷마다, 단계마다 한 줄에 적는다.
+     *
+     * @param interval 요약 주기 (초)
+     * @return 요약 한 줄, 그 사이 처리한 메시지가 없으면 빈 문자열
+     */
+    static string summary(int interval) {
+      string line;
+      lock_guard<mutex> lock(all_mutex());
+      for (auto &entry : all()) {
+        HandlerLatency &latency = *entry.second;
+        uint64_t count = latency.total.snapshot().count - latency.last_total.count;
+        string total = recent_quantiles(latency.total, latency.last_total);
+        string parse = recent_quantiles(latency.parse, latency.last_parse);
+        string logic = recent_quantiles(latency.logic, latency.last_logic);
+        string send = recent_quantiles(latency.send, latency.last_send);
+        if (count == 0) {
+          continue;
+        }
+        line += line.empty() ? "" : "; ";
+        line += latency.type + "/" + latency.format + " n=" + to_string(count) + " total " + total +
+                " (parse " + parse + " handler " + logic + " send " + send + ")";
+      }
+      return line.empty() ? line : "handler latency p50/p99 us, last " + to_string(interval) + "s: " + line;
+    }
+};
 
 
 /**
@@ -65,18 +348,38 @@ class UnknownTypeInMessage : public runtime_error {
 };
 
 
+/**
+ * @brief flat 메시지의 헤더나 문자열 길이가 프레임 크기와 맞지 않을 때 발생하는 예외 클래스
+ */
+class MalformedFlatMessage : public runtime_error {
+  public:
+    MalformedFlatMessage() : runtime_error("Malformed flat message") {}
+};
+
+/**
+ * @brief CSBatch 안에 다시 CSBatch 가 들어 있을 때 발생하는 예외 클래스
+ */
+class NestedBatchInMessage : public runtime_error {
+  public:
+    NestedBatchInMessage() : runtime_error("CSBatch cannot contain another CSBatch") {}
+};
+
 /**
  * @brief 클라이언트 정보를 저장하는 클래스
  */
 class Client {
   private:
     int client_fd; ///< 클라이언트의 소켓 파일 디스크립터
-    string client_name; ///< 클라이언트 이름
-    int entered_room_id; ///< 클라이언트가 속한 방 ID
+    uint32_t connection_id; ///< 서버가 받은 순서대로 붙이는 연결 번호, 소켓 번호와 달리 다시 쓰이지 않는다
+    NamePtr client_name; ///< 클라이언트 이름, NameTable 이 intern 한 것
+    int entered_room_id; ///< roomId 없이 보낸 CSChat, CSLeaveRoom 이 향하는 방 (마지막으로 들어간 방), 없으면 0
+    vector<int> joined_rooms; ///< 들어가 있는 모든 방 ID, 오름차순. room_mutex 안에서 바꾼다
 
-    int current_message_len; ///< 현재 처리 중인 메시지의 길이.
-    string socket_buffer; ///< 소켓에서 수신한 데이터를 저장하는 버퍼.
+    FrameReader frame_reader; ///< 소켓에서 수신한 데이터를 프레임 단위로 재조립하는 버퍼.
     string current_protobuf_type; ///< 현재 처리 중인 Protobuf 메시지의 타입.
+    MessageFormat format; ///< 이 연결이 쓰는 메시지 포맷
+    bool handshake_checked; ///< 포맷 협상 바이트를 확인했는지 여부
+    bool batch_replies; ///< CSBatch 를 보낸 적이 있어 SCBatch 로 응답받을 수 있는지 여부
 
     bool is_waiting; ///< 클라이언트가 task queue에서 대기 중인지 여부
 
@@ -90,46 +393,100 @@ class Client {
      * @brief 클라이언트 정보를 초기화하는 생성자
      *  
      * @param client_fd 클라이언트 소켓 파일 디스크립터
+     * @param connection_id 연결 번호
      * @param client_name 클라이언트의 (ip, port) 로 이루어진 클라이언트 이름
+     * @param format 포맷 협상 전까지 쓸 메시지 포맷
+     * @param max_frame_size 받을 수 있는 가장 큰 프레임의 길이
      */
-    Client(int client_fd, const string &client_name) 
-    : client_fd(client_fd), entered_room_id(0) ,client_name(client_name), is_waiting(false), current_message_len(0) {}
+    Client(int client_fd, uint32_t connection_id, NamePtr client_name, MessageFormat format, size_t max_frame_size) 
+    : client_fd(client_fd), connection_id(connection_id), entered_room_id(0) ,client_name(client_name), is_waiting(false),
+      frame_reader(FramingMode::U16, max_frame_size), format(format), handshake_checked(false), batch_replies(false) {}
 
     
 
     //setter
-    void set_client_name(string name) {client_name = name;}
+    void set_client_name(NamePtr name) {client_name = move(name);}
     void set_entered_room_id(int room_id) {entered_room_id = room_id;}
-    void set_current_message_len(int current_message_len) {this->current_message_len = current_message_len;}
-    void append_socket_buffer(char message[], int size) {this->socket_buffer.append(message, size);}
-    void erase_socket_buffer(int start, int end) {this->socket_buffer.erase(start, end);}
+
+    /**
+     * @brief 들어간 방을 추가하고 기본 방으로 삼는다.
+     * 
+     * @param room_id 방 ID
+     */
+    void add_joined_room(int room_id) {
+      auto it = lower_bound(joined_rooms.begin(), joined_rooms.end(), room_id);
+      if (it == joined_rooms.end() || *it != room_id) {
+        joined_rooms.insert(it, room_id);
+      }
+      entered_room_id = room_id;
+    }
+
+    /**
+     * @brief 나온 방을 뺀다. 기본 방에서 나왔으면 남은 방 중 ID 가 가장 큰 방이 기본 방이 된다.
+     * 
+     * @param room_id 방 ID
+     */
+    void remove_joined_room(int room_id) {
+      auto it = lower_bound(joined_rooms.begin(), joined_rooms.end(), room_id);
+      if (it != joined_rooms.end() && *it == room_id) {
+        joined_rooms.erase(it);
+      }
+      if (entered_room_id == room_id) {
+        entered_room_id = joined_rooms.empty() ? 0 : joined_rooms.back();
+      }
+    }
     void set_current_protobuf_type(string current_protobuf_type) {this->current_protobuf_type = current_protobuf_type;}
     void set_is_waiting(bool is_waiting) {this->is_waiting = is_waiting;}
+    void set_format(MessageFormat format) {this->format = format;}
+    void set_handshake_checked(bool handshake_checked) {this->handshake_checked = handshake_checked;}
+    void set_batch_replies(bool batch_replies) {this->batch_replies = batch_replies;}
 
     //getter
     const int &get_client_fd() {return client_fd;}
-    const string &get_client_name() {return client_name;}
+    uint32_t get_connection_id() {return connection_id;}
+    const string &get_client_name() {return client_name->get();}
+    const NamePtr &get_name() {return client_name;}
     const int &get_entered_room_id() {return entered_room_id;}
-    const int &get_current_message_len() {return current_message_len;}
-    const string &get_socket_buffer() {return socket_buffer;}
-    string substr_socket_buffer(int start, int end) {return socket_buffer.substr(start, end);}
+    const vector<int> &get_joined_rooms() {return joined_rooms;}
+    bool is_in_room(int room_id) {return binary_search(joined_rooms.begin(), joined_rooms.end(), room_id);}
+    FrameReader &get_frame_reader() {return frame_reader;}
+    FramingMode get_framing() {return frame_reader.get_mode();}
     const string &get_current_protobuf_type() {return current_protobuf_type;}
     const bool &get_is_waiting() {return is_waiting;}
+    const MessageFormat &get_format() {return format;}
+    const bool &get_handshake_checked() {return handshake_checked;}
+    const bool &get_batch_replies() {return batch_replies;}
 };
 
 /**
  * @brief 채팅방 정보를 저장하는 클래스
  */
 class Room {
-  private:
-    using MemberMap = map<Index, Client*>;
+  public:
+    /**
+     * @brief 방 멤버 하나. 브로드캐스트에 필요한 값을 Client 를 거치지 않고 바로 읽도록 복사해 둔다.
+     */
+    struct Member {
+      int fd; ///< 클라이언트 소켓
+      uint32_t connection_id; ///< 클라이언트의 연결 번호, 스냅샷이 닫힌 뒤 다시 쓰인 소켓 번호로 보내지 않게 한다
+      MessageFormat format; ///< 클라이언트의 메시지 포맷
+      FramingMode framing; ///< 클라이언트의 프레이밍
+      Client *client;
+    };
+    using MemberList = DenseMemberList<Member>;
+    using Shard = vector<Member>;
+    using ShardPtr = shared_ptr<const Shard>;
 
+  private:
     int room_id;
     string title;
-    MemberMap members; ///< 방에 속한 클라이언트들
+    MemberList members; ///< 방에 속한 클라이언트들
+    bool fanout = false; ///< 큰 방이 되어 브로드캐스트를 fan-out 쓰레드로 넘기는지
+    vector<ShardPtr> shards; ///< fan-out 샤드별 멤버 스냅샷, 멤버가 바뀌면 비우고 다음 브로드캐스트에서 다시 만든다
+    unsigned shard_formats = 0; ///< shards 의 멤버들이 쓰는 MessageFormat 들, 1 << format 의 합
+    PresenceCoalescer presence; ///< 입장/퇴장 알림을 모으는 창
 
   public:
-    static int next_room_id; ///< 다음에 만들어질 방 ID
     /**
      * @brief 기본 생성자
      */
@@ -138,11 +495,10 @@ class Room {
     /**
      * @brief 방 정보를 초기화하는 생성자
      * 
+     * @param room_id RoomTable::allocate_key() 로 받은 방 ID
      * @param title 방 제목
      */
-    Room(string title) : title(title) {
-      room_id = next_room_id;
-      next_room_id++;
+    Room(int room_id, string title) : room_id(room_id), title(title) {
       cout << "방[" << room_id << "] 생성. 방제 " << title << endl;
     }
 
@@ -154,10 +510,20 @@ class Room {
      * @param room_id 방 ID
      */
     void join_client(int sock, Client *Client, int room_id) {
-      {
-        unique_lock<mutex> lock(room_mutex);
-        members.insert({sock, Client});
-        members[sock]->set_entered_room_id(room_id);
+      ProfiledLock lock(room_mutex);
+      join_client_locked(sock, Client, room_id);
+    }
+
+    /**
+     * @brief join_client() 와 같지만 room_mutex 를 잡은 채로 부른다.
+     */
+    void join_client_locked(int sock, Client *Client, int room_id) {
+      members.insert(sock, Member {sock, Client->get_connection_id(), Client->get_format(), Client->get_framing(), Client});
+      Client->add_joined_room(room_id);
+      shards.clear();
+      // 한 번 큰 방이 되면 계속 fan-out 한다. 작아졌다고 바로 보내기 시작하면 큐에 남은 이전 메시지를 앞지를 수 있다
+      if (members.size() >= fanout_threshold) {
+        fanout = true;
       }
     }
 
@@ -167,52 +533,366 @@ class Room {
      * @param sock 클라이언트 소켓
      */
     void leave_client(int sock) {
-      {
-        unique_lock<mutex> lock(room_mutex);
-        members[sock]->set_entered_room_id(0);
+      ProfiledLock lock(room_mutex);
+      leave_client_locked(sock);
+    }
+
+    /**
+     * @brief leave_client() 와 같지만 room_mutex 를 잡은 채로 부른다.
+     */
+    void leave_client_locked(int sock) {
+      Member *member = members.find(sock);
+      if (member != nullptr) {
+        member->client->remove_joined_room(room_id);
         members.erase(sock);
+        shards.clear();
       }
     }
 
     //getter
-    json get_room() {
-      json room {
-        {"roomId", room_id},
-        {"title", title},
-        {"members", json::array()},
-      };
-
+    RoomInfo get_room_info() {
+      RoomInfo room_info {room_id, title, {}};
       for (auto it = members.begin() ; it != members.end() ; ++it) {
-        auto &member = it->second;
-        room["members"].push_back(member->get_client_name());
+        room_info.members.push_back(it->client->get_name());
       }
-      
-      return room;
+      return room_info;
     }
     const int &get_room_id() {return room_id;}
     const string &get_title() {return title;}
-    const MemberMap &get_members() {return members;}
-};
-int Room::next_room_id = 1;
+    const MemberList &get_members() {return members;}
+    const bool &get_fanout() {return fanout;}
+    PresenceCoalescer &get_presence() {return presence;}
 
-using RoomMap = map<Index, Room>;
+    /**
+     * @brief 멤버를 소켓 번호로 나눈 샤드별 스냅샷. room_mutex 를 잡은 채로 불러야 한다.
+     *
+     * 스냅샷은 멤버가 바뀔 때까지 재사용되므로 브로드캐스트마다 멤버 전체를 복사하지 않는다.
+     *
+     * @param pool 샤드를 나눌 fan-out 풀
+     */
+    const vector<ShardPtr> &get_shards(const FanoutPool &pool) {
+      if (shards.size() != pool.size()) {
+        vector<Shard> split(pool.size());
+        shard_formats = 0;
+        for (auto it = members.begin() ; it != members.end() ; ++it) {
+          split[pool.shard_of(it->fd)].push_back(*it);
+          shard_formats |= 1u << static_cast<int>(it->format);
+        }
+        shards.clear();
+        for (auto &shard : split) {
+          shards.push_back(make_shared<const Shard>(move(shard)));
+        }
+      }
+      return shards;
+    }
+
+    /**
+     * @brief get_shards() 가 돌려준 스냅샷의 멤버들이 쓰는 MessageFormat 들, 1 << format 의 합
+     */
+    unsigned get_shard_formats() const {return shard_formats;}
+};
+using RoomMap = RoomTable<Room>;
 using ClientMap = unordered_map<Index, Client>;
 
+/**
+ * @brief CSRooms 의 정렬 기준. 값은 protobuf 의 CSRooms::Sort, flat 의 sort 필드와 같다.
+ */
+enum class RoomSort {
+  ID = 0,       ///< 방 ID 오름차순
+  MEMBERS = 1,  ///< 멤버 수 내림차순, 같으면 방 ID 오름차순
+  ACTIVITY = 2, ///< 최근 활동 순, 같으면 방 ID 오름차순
+};
+
+static const int ROOM_SORT_COUNT = 3; ///< RoomSort 값의 개수
+static const size_t DEFAULT_ROOMS_PAGE = 100; ///< limit 없이 페이지를 요청했을 때 한 페이지의 방 개수
+static const size_t MAX_ROOMS_PAGE = 1000; ///< 한 페이지의 최대 방 개수
+
+/**
+ * @brief 정렬 인덱스의 키. (정렬 값, 방 ID) 순서로 비교하며 내림차순 기준은 값의 부호를 바꿔 넣는다.
+ */
+using RoomSortKey = pair<int64_t, Index>;
+
+/**
+ * @brief 페이지 단위 방 목록 요청
+ */
+struct RoomQuery {
+  RoomSort sort = RoomSort::ID;
+  bool has_cursor = false; ///< false 면 처음부터
+  RoomSortKey after; ///< 이 키 다음부터
+  size_t limit = DEFAULT_ROOMS_PAGE;
+  string title_prefix; ///< 비어 있지 않으면 제목이 이것으로 시작하는 방만
+};
+
+/**
+ * @brief CSRooms 에 보낼 방 목록을 방이 바뀔 때마다 조금씩 고쳐 두는 클래스
+ *
+ * 방마다 RoomFragment 를 하나씩 들고 있고, 방이 만들어지거나 멤버가 바뀌면 그 방의 조각만 새로 만든다.
+ * 목록이 바뀐 뒤 처음 요청이 오면 조각들을 모아 SCRoomsResult 를 한 번 만들고,
+ * 그 다음 요청부터는 같은 ServerMessage (포맷별 인코딩 캐시 포함) 를 그대로 돌려준다.
+ *
+ * 페이지 요청을 위해 정렬 기준마다 (키, 방 ID) 의 정렬된 인덱스를 같이 고쳐 두므로,
+ * 한 페이지는 전체 방 개수와 상관없이 커서 위치에서 페이지 크기만큼만 읽는다.
+ */
+class RoomListing {
+  private:
+    /**
+     * @brief 방 하나의 목록 정보와 정렬 키
+     */
+    struct Entry {
+      RoomFragmentPtr fragment;
+      RoomSortKey members_key;
+      RoomSortKey activity_key;
+    };
+
+    mutex listing_mutex;
+    map<Index, Entry> entries; ///< 방 ID 순서의 방 조각들, ID 기준 인덱스를 겸한다
+    set<RoomSortKey> by_members; ///< (-멤버 수, 방 ID)
+    set<RoomSortKey> by_activity; ///< (-마지막 활동 순번, 방 ID)
+    int64_t activity_clock = 0; ///< 활동이 있을 때마다 증가
+    uint64_t version = 0; ///< 목록이 바뀔 때마다 증가
+    ServerMessagePtr snapshot; ///< snapshot_version 시점의 SCRoomsResult
+    uint64_t snapshot_version = 0;
+
+    /**
+     * @brief 방의 활동 키를 새로 매긴다. listing_mutex 를 잡은 채로 부른다.
+     */
+    void touch_locked(Index room_id, Entry &entry) {
+      by_activity.erase(entry.activity_key);
+      entry.activity_key = RoomSortKey(-(++activity_clock), room_id);
+      by_activity.insert(entry.activity_key);
+    }
+
+    static string make_cursor(const RoomSortKey &key) {
+      return to_string(key.first) + ":" + to_string(key.second);
+    }
+
+  public:
+    /**
+     * @brief 방의 현재 상태로 조각을 새로 만든다. 방 생성, 입장, 퇴장, 멤버 이름 변경 후에 부른다.
+     *
+     * 오래된 상태가 나중에 덮어쓰지 않도록 room_mutex 를 잡은 채로 읽고 바꾼다. room_mutex 를 잡은 채로 부르면 안 된다.
+     * 
+     * @param room 바뀐 방
+     */
+    void update(Room &room) {
+      ProfiledLock room_lock(room_mutex);
+      update_locked(room);
+    }
+
+    /**
+     * @brief update() 와 같지만 room_mutex 를 잡은 채로 부른다. 방을 찾고 바꾼 뒤 lock 을 놓기 전에 조각을 만들 때 쓴다.
+     * 
+     * @param room 바뀐 방
+     */
+    void update_locked(Room &room) {
+      Index room_id = room.get_room_id();
+      RoomFragmentPtr fragment = make_shared<const RoomFragment>(room.get_room_info());
+      RoomSortKey members_key(-static_cast<int64_t>(room.get_members().size()), room_id);
+      {
+        unique_lock<mutex> lock(listing_mutex);
+        auto result = entries.emplace(room_id, Entry {nullptr, members_key, RoomSortKey(0, room_id)});
+        Entry &entry = result.first->second;
+        if (!result.second) {
+          by_members.erase(entry.members_key);
+        }
+        entry.fragment = move(fragment);
+        entry.members_key = members_key;
+        by_members.insert(members_key);
+        touch_locked(room_id, entry);
+        ++version;
+      }
+    }
+
+    /**
+     * @brief 방에 채팅이 오갔음을 기록한다. 활동 순 정렬에만 영향을 준다.
+     * 
+     * @param room_id 방 ID
+     */
+    void touch(Index room_id) {
+      unique_lock<mutex> lock(listing_mutex);
+      auto it = entries.find(room_id);
+      if (it != entries.end()) {
+        touch_locked(room_id, it->second);
+      }
+    }
+
+    /**
+     * @brief 사라진 방을 목록에서 뺀다.
+     * 
+     * @param room_id 방 ID
+     */
+    void remove(Index room_id) {
+      unique_lock<mutex> lock(listing_mutex);
+      auto it = entries.find(room_id);
+      if (it != entries.end()) {
+        by_members.erase(it->second.members_key);
+        by_activity.erase(it->second.activity_key);
+        entries.erase(it);
+        ++version;
+      }
+    }
+
+    /**
+     * @brief 현재 방 목록의 SCRoomsResult. 방이 하나도 없으면 nullptr.
+     */
+    ServerMessagePtr get() {
+      unique_lock<mutex> lock(listing_mutex);
+      if (entries.empty()) {
+        return nullptr;
+      }
+      if (snapshot == nullptr || snapshot_version != version) {
+        vector<RoomFragmentPtr> rooms;
+        rooms.reserve(entries.size());
+        for (auto it = entries.begin() ; it != entries.end() ; ++it) {
+          rooms.push_back(it->second.fragment);
+        }
+        snapshot = ServerMessage::rooms_result(move(rooms));
+        snapshot_version = version;
+      }
+      return snapshot;
+    }
+
+    /**
+     * @brief 방 목록의 한 페이지. 다음 페이지가 있으면 마지막 방의 키를 nextCursor 로 담는다.
+     *
+     * 정렬 인덱스에서 커서 다음 위치부터 읽으므로 제목 필터가 없으면 페이지 크기만큼만 읽는다.
+     * 제목 필터가 있으면 걸러진 방만큼 더 읽는다.
+     * 
+     * @param query 요청
+     */
+    ServerMessagePtr page(const RoomQuery &query) {
+      unique_lock<mutex> lock(listing_mutex);
+      vector<RoomFragmentPtr> rooms;
+      RoomSortKey last_key;
+      string next_cursor;
+
+      // 조건에 맞으면 담고, 페이지가 찬 뒤에 조건에 맞는 방이 하나 더 있으면 커서를 남기고 멈춘다
+      auto visit = [&](const RoomSortKey &key, const RoomFragmentPtr &fragment) {
+        const string &title = fragment->get_info().title;
+        if (title.compare(0, query.title_prefix.size(), query.title_prefix) != 0) {
+          return true;
+        }
+        if (rooms.size() == query.limit) {
+          next_cursor = make_cursor(last_key);
+          return false;
+        }
+        rooms.push_back(fragment);
+        last_key = key;
+        return true;
+      };
+
+      if (query.sort == RoomSort::ID) {
+        auto it = query.has_cursor ? entries.upper_bound(query.after.second) : entries.begin();
+        for (; it != entries.end() && visit(RoomSortKey(it->first, it->first), it->second.fragment); ++it) {}
+      } else {
+        set<RoomSortKey> &index = query.sort == RoomSort::MEMBERS ? by_members : by_activity;
+        auto it = query.has_cursor ? index.upper_bound(query.after) : index.begin();
+        for (; it != index.end() && visit(*it, entries[it->second].fragment); ++it) {}
+      }
+
+      return ServerMessage::rooms_result(move(rooms), move(next_cursor));
+    }
+
+    /**
+     * @brief 주어진 방들의 SCRoomsResult. 목록에 없는 방은 건너뛴다.
+     * 
+     * @param room_ids 방 ID 들, 이 순서대로 담는다
+     */
+    ServerMessagePtr select(const vector<Index> &room_ids) {
+      unique_lock<mutex> lock(listing_mutex);
+      vector<RoomFragmentPtr> rooms;
+      rooms.reserve(room_ids.size());
+      for (Index room_id : room_ids) {
+        auto it = entries.find(room_id);
+        if (it != entries.end()) {
+          rooms.push_back(it->second.fragment);
+        }
+      }
+      return ServerMessage::rooms_result(move(rooms));
+    }
+
+    /**
+     * @brief nextCursor 문자열을 정렬 키로 바꾼다.
+     *
+     * @param cursor 커서 문자열
+     * @param key 결과
+     * @return 올바른 커서이면 true
+     */
+    static bool parse_cursor(const string &cursor, RoomSortKey &key) {
+      size_t colon = cursor.find(':');
+      if (colon == string::npos) {
+        return false;
+      }
+      const char *begin = cursor.data();
+      const char *end = begin + cursor.size();
+      auto first = from_chars(begin, begin + colon, key.first);
+      auto second = from_chars(begin + colon + 1, end, key.second);
+      return first.ec == errc() && first.ptr == begin + colon && second.ec == errc() && second.ptr == end;
+    }
+
+    //getter
+    uint64_t get_version() {
+      unique_lock<mutex> lock(listing_mutex);
+      return version;
+    }
+};
+
 /**
  * @brief MessageHandlers 클래스는 다양한 유형의 메시지 처리를 담당.
  * 
+ * 수신 메시지는 Format 에 맞게 해석하고, 보낼 메시지는 포맷에 독립적인 ServerMessage 로 만든다.
+ * ServerMessage 는 받는 클라이언트가 쓰는 포맷으로 처음 필요할 때 한 번만 인코딩된다.
+ * 
  * @tparam Format JSON 또는 Protobuf 등 메시지 포맷을 나타내는 타입.
  */
 template <typename Format>
 class MessageHandlers {
   private:
     using MessageHandler = function<void(int, Format)>;
-    using HandlerMap = unordered_map<string, MessageHandler>;
-    using MessageList = vector<Format>;
+
+    /**
+     * @brief 메시지 타입 하나의 핸들러와 그 타입의 지표
+     */
+    struct Handler {
+      MessageHandler handler;
+      Counter *frames_in; ///< 받은 프레임 수
+      HandlerLatency *latency; ///< 단계별 처리 시간
+    };
+    using HandlerMap = unordered_map<string, Handler>;
+    using MessageList = vector<ServerMessagePtr>;
+
+    /**
+     * @brief 배치를 처리하는 동안 한 클라이언트에게 보낼 메시지들
+     */
+    struct Outgoing {
+      uint32_t connection_id;
+      MessageFormat format;
+      FramingMode framing;
+      bool batch_replies;
+      MessageList messages;
+    };
+
+    /**
+     * @brief 배치를 처리하는 동안 보낼 메시지를 목적지별로 모아두는 곳. 처음 보낸 순서대로 flush 한다.
+     */
+    struct Outbox {
+      vector<int> order;
+      unordered_map<int, Outgoing> pending;
+    };
 
     HandlerMap handlers;
     ClientMap *client_sockets;
     RoomMap *rooms; 
+    RoomListing *room_listing;
+    NameTable *names;
+    RoomSearchIndex *search_index;
+    FanoutPool *fanout;
+    PresenceScheduler *presence;
+    OutboundQueues *outbound;
+
+    static thread_local Outbox *outbox; ///< 이 쓰레드가 처리 중인 배치의 outbox, 배치 밖에서는 nullptr
+    static thread_local uint64_t parse_clock; ///< 이 쓰레드가 핸들러 안에서 메시지 본문을 파싱하는 데 쓴 시간의 누적 (ns)
+    static thread_local uint64_t send_clock; ///< 이 쓰레드가 전송과 브로드캐스트에 쓴 시간의 누적 (ns)
 
 
     /**
@@ -220,21 +900,55 @@ class MessageHandlers {
      * 각 메시지 타입에 맞는 핸들러 함수를 설정.
      */
     void init_message_handlers() {
-      handlers["CSName"] = [this](int sock, Format argv) {on_cs_name(sock, argv);};
-      handlers["CSRooms"] = [this](int sock, Format argv) {on_cs_rooms(sock, argv);};
-      handlers["CSCreateRoom"] = [this](int sock, Format argv) {on_cs_create_room(sock, argv);};
-      handlers["CSJoinRoom"] = [this](int sock, Format argv) {on_cs_join_room(sock, argv);};
-      handlers["CSLeaveRoom"] = [this](int sock, Format argv) {on_cs_leave_room(sock, argv);};
-      handlers["CSChat"] = [this](int sock, Format argv) {on_cs_chat(sock, argv);};
-      handlers["CSShutdown"] = [this](int sock, Format argv) {on_cs_shutdown(sock, argv);};
-
-      handlers[to_string(Type_MessageType_CS_NAME)] = [this](int sock, Format argv) {on_cs_name(sock, argv);};
-      handlers[to_string(Type_MessageType_CS_ROOMS)] = [this](int sock, Format argv) {on_cs_rooms(sock, argv);};
-      handlers[to_string(Type_MessageType_CS_CREATE_ROOM)] = [this](int sock, Format argv) {on_cs_create_room(sock, argv);};
-      handlers[to_string(Type_MessageType_CS_JOIN_ROOM)] = [this](int sock, Format argv) {on_cs_join_room(sock, argv);};
-      handlers[to_string(Type_MessageType_CS_LEAVE_ROOM)] = [this](int sock, Format argv) {on_cs_leave_room(sock, argv);};
-      handlers[to_string(Type_MessageType_CS_CHAT)] = [this](int sock, Format argv) {on_cs_chat(sock, argv);};
-      handlers[to_string(Type_MessageType_CS_SHUTDOWN)] = [this](int sock, Format argv) {on_cs_shutdown(sock, argv);};
+      add_handler("CSName", Type_MessageType_CS_NAME, [this](int sock, Format argv) {on_cs_name(sock, argv);});
+      add_handler("CSRooms", Type_MessageType_CS_ROOMS, [this](int sock, Format argv) {on_cs_rooms(sock, argv);});
+      add_handler("CSSearchRooms", Type_MessageType_CS_SEARCH_ROOMS, [this](int sock, Format argv) {on_cs_search_rooms(sock, argv);});
+      add_handler("CSCreateRoom", Type_MessageType_CS_CREATE_ROOM, [this](int sock, Format argv) {on_cs_create_room(sock, argv);});
+      add_handler("CSJoinRoom", Type_MessageType_CS_JOIN_ROOM, [this](int sock, Format argv) {on_cs_join_room(sock, argv);});
+      add_handler("CSLeaveRoom", Type_MessageType_CS_LEAVE_ROOM, [this](int sock, Format argv) {on_cs_leave_room(sock, argv);});
+      add_handler("CSChat", Type_MessageType_CS_CHAT, [this](int sock, Format argv) {on_cs_chat(sock, argv);});
+      add_handler("CSShutdown", Type_MessageType_CS_SHUTDOWN, [this](int sock, Format argv) {on_cs_shutdown(sock, argv);});
+      add_handler("CSBatch", Type_MessageType_CS_BATCH, [this](int sock, Format argv) {on_cs_batch(sock, argv);});
+    }
+
+    /**
+     * @brief JSON 타입 이름과 protobuf/flat 타입 번호 두 키로 핸들러를 등록하고, 포맷과 타입별 지표를 만든다.
+     * 
+     * @param name JSON 의 type 값
+     * @param type protobuf 메시지 타입
+     * @param handler 핸들러
+     */
+    void add_handler(const string &name, Type_MessageType type, MessageHandler handler) {
+      string labels = "format=\"" + string(format_label()) + "\",type=\"" + name + "\"";
+      Counter *frames_in = &MetricsRegistry::instance().counter("chat_frames_in_total", "받은 메시지 프레임 수", labels);
+      HandlerLatency *latency = &HandlerLatency::get(format_label(), name);
+      handlers[name] = Handler {handler, frames_in, latency};
+      handlers[to_string(type)] = Handler {handler, frames_in, latency};
+    }
+
+    /**
+     * @brief 이 핸들러가 처리하는 포맷의 지표 라벨
+     */
+    static const char *format_label() {
+      if constexpr (is_same<Format, json>::value) {
+        return "json";
+      } else if constexpr (is_same<Format, string>::value) {
+        return "protobuf";
+      } else {
+        return "flat";
+      }
+    }
+
+    /**
+     * @brief protobuf 메시지 본문을 파싱하고 그 시간을 파싱 단계로 센다.
+     * 
+     * @param message 파싱 결과를 담을 메시지
+     * @param argv 직렬화된 본문
+     */
+    template <typename Message>
+    void parse_body(Message &message, const string &argv) {
+      ScopedTimer timer(parse_clock);
+      message.ParseFromString(argv);
     }
     /**
      * @brief 클라이언트의 이름을 설정하는 메시지를 처리.
@@ -243,46 +957,51 @@ class MessageHandlers {
      * @param argv 메시지 데이터
      */
     void on_cs_name(int sock, Format argv) {
-      MessageList messages; ///< 보낼 메시지 리스트
       auto &client_socket = (*client_sockets)[sock];
+      string name; ///< 새 이름
+      string shown_name; ///< 시스템 메시지에 표시할 새 이름
 
       if constexpr (is_same<Format, json>::value) {
         //json 메시지 처리
-        json message = {
-          {"type", "SCSystemMessage"},
-          {"text", client_socket.get_client_name() +  " 의 이름이 " + argv["name"].dump() + " 으로 변경되었습니다"},
-        };
-
-        client_socket.set_client_name(argv["name"]);
-        
-        messages.push_back(message);
-
-      } else {
+        name = argv["name"];
+        shown_name = argv["name"].dump();
+      } else if constexpr (is_same<Format, string>::value) {
         //protobuf 메시지 처리
-        Type *message_type = new Type;
-        SCSystemMessage *message_sys = new SCSystemMessage;
-        CSName *cs_name = new CSName;
-        cs_name->ParseFromString(argv);
-
-        //메시지 세팅
-        message_type->set_type(Type_MessageType_SC_SYSTEM_MESSAGE);
-        messages.push_back(message_type->SerializeAsString());
-
-        message_sys->set_text(client_socket.get_client_name() +  " 의 이름이 " + cs_name->name() + " 으로 변경되었습니다");
-        messages.push_back(message_sys->SerializeAsString());
+        CSName cs_name;
+        parse_body(cs_name, argv);
+        name = cs_name.name();
+        shown_name = name;
+      } else {
+        //flat 메시지 처리
+        name = string(argv.name());
+        shown_name = name;
+      }
 
-        //이름 세팅
-        client_socket.set_client_name(cs_name->name());
+      MessageList messages; ///< 보낼 메시지 리스트
+      messages.push_back(ServerMessage::system_message(client_socket.get_client_name() +  " 의 이름이 " + shown_name + " 으로 변경되었습니다"));
 
-        delete(message_type);
-        delete(message_sys);
-        delete(cs_name);
+      //이름 세팅, 방 목록을 만드는 다른 쓰레드가 이름을 읽고 있을 수 있으므로 room_mutex 안에서 바꾼다
+      NamePtr old_name = client_socket.get_name();
+      NamePtr new_name = names->bind(sock, name);
+      {
+        ProfiledLock lock(room_mutex);
+        client_socket.set_client_name(move(new_name));
+      }
+      names->unbind(sock, old_name);
+      {
+        ProfiledLock lock(room_mutex);
+        for (int room_id : client_socket.get_joined_rooms()) {
+          Room *room = (*rooms).find(room_id);
+          if (room != nullptr) {
+            room_listing->update_locked(*room);
+          }
+        }
       }
 
       send_messages_to_client(sock, messages);
-      //방에 있을 시 브로드캐스트
-      if (client_socket.get_entered_room_id() != 0) {  
-        broadcast(sock, messages);
+      //들어가 있는 방들에 브로드캐스트
+      if (!client_socket.get_joined_rooms().empty()) {
+        broadcast(sock, client_socket.get_joined_rooms(), messages);
       }
 
       return;
@@ -296,71 +1015,147 @@ class MessageHandlers {
      */
     void on_cs_rooms(int sock, Format argv) {
       MessageList messages; ///< 보낼 메시지 리스트
+      bool paged = false; ///< 옵션이 하나라도 있으면 페이지 요청
+      string cursor; ///< 이전 페이지의 nextCursor
+      int64_t limit = 0; ///< 페이지 크기, 0 이하면 기본값
+      int sort = 0; ///< RoomSort 값, 알 수 없으면 -1
+      RoomQuery query;
 
       if constexpr (is_same<Format, json>::value) {
         //json 메시지 처리
-        if (!(*rooms).empty()) {
-          json message {
-            {"type", "SCRoomsResult"},
-            {"rooms", json::array()},
-          };
-
-          //방 목록 추가
-          for (auto it = (*rooms).begin() ; it != (*rooms).end() ; ++it) {
-            auto &room = it->second;
-            message["rooms"].push_back(room.get_room());
-          }
+        paged = argv.contains("cursor") || argv.contains("limit") || argv.contains("titlePrefix") || argv.contains("sort");
+        if (argv.contains("cursor")) cursor = argv["cursor"];
+        if (argv.contains("limit")) limit = argv["limit"];
+        if (argv.contains("titlePrefix")) query.title_prefix = argv["titlePrefix"];
+        if (argv.contains("sort")) {
+          string sort_name = argv["sort"];
+          sort = sort_name == "id" ? 0 : sort_name == "members" ? 1 : sort_name == "activity" ? 2 : -1;
+        }
+      } else if constexpr (is_same<Format, string>::value) {
+        //protobuf 메시지 처리
+        CSRooms cs_rooms;
+        parse_body(cs_rooms, argv);
+        paged = cs_rooms.has_cursor() || cs_rooms.has_limit() || cs_rooms.has_titleprefix() || cs_rooms.has_sort();
+        cursor = cs_rooms.cursor();
+        limit = cs_rooms.limit();
+        query.title_prefix = cs_rooms.titleprefix();
+        sort = cs_rooms.sort();
+      } else {
+        //flat 메시지 처리
+        cursor = string(argv.cursor());
+        limit = argv.limit();
+        query.title_prefix = string(argv.title_prefix());
+        sort = argv.sort();
+        paged = !cursor.empty() || limit != 0 || !query.title_prefix.empty() || sort != 0;
+      }
 
-          messages.push_back(message);
+      if (!paged) {
+        // 방 목록은 방이 바뀔 때마다 미리 고쳐 두므로 여기서는 캐시된 메시지를 가져오기만 한다
+        ServerMessagePtr listing = room_listing->get();
+        if (listing != nullptr) {
+          messages.push_back(move(listing));
         } else {
-          json message = {
-            {"type", "SCSystemMessage"},
-            {"text", "개설된 방이 없습니다."},
-          };
-          messages.push_back(message);
+          messages.push_back(ServerMessage::system_message("개설된 방이 없습니다."));
         }
-
+      } else if (sort < 0 || sort >= ROOM_SORT_COUNT) {
+        messages.push_back(ServerMessage::system_message("알 수 없는 정렬 기준입니다."));
+      } else if (!cursor.empty() && !RoomListing::parse_cursor(cursor, query.after)) {
+        messages.push_back(ServerMessage::system_message("잘못된 cursor 입니다."));
       } else {
-        //protobuf 메시지 처리
-        Type *message_type = new Type;
-        
-        if (!(*rooms).empty()) {
-          SCRoomsResult *message_room_result = new SCRoomsResult;
-          SCRoomsResult::RoomInfo *room_info;
+        query.sort = static_cast<RoomSort>(sort);
+        query.has_cursor = !cursor.empty();
+        query.limit = limit <= 0 ? DEFAULT_ROOMS_PAGE : min(static_cast<size_t>(limit), MAX_ROOMS_PAGE);
+        messages.push_back(room_listing->page(query));
+      }
 
-          message_type->set_type(Type_MessageType_SC_ROOMS_RESULT);
-          messages.push_back(message_type->SerializeAsString());
+      send_messages_to_client(sock, messages);
 
-          //방 목록 추가
-          for (auto it = (*rooms).begin() ; it != (*rooms).end() ; ++it) {
-            auto &room = it->second;
+      return;
+    }
 
-            room_info = message_room_result->add_rooms();
-            room_info->set_roomid(room.get_room_id());
-            room_info->set_title(room.get_title());
+    /**
+     * @brief 방 제목 검색 메시지를 처리.
+     * 
+     * @param sock 클라이언트 소켓 번호
+     * @param argv 메시지 데이터
+     */
+    void on_cs_search_rooms(int sock, Format argv) {
+      MessageList messages; ///< 보낼 메시지 리스트
+      string query; ///< 검색어
+      int64_t limit = 0; ///< 최대 결과 수, 0 이하면 기본값
 
-            auto members = room.get_members();
-            for (auto i = members.begin() ; i != members.end() ; ++i) {
-              auto &member = i->second;
-              room_info->add_members(member->get_client_name());
-            }
-          }
-          messages.push_back(message_room_result->SerializeAsString());
+      if constexpr (is_same<Format, json>::value) {
+        //json 메시지 처리
+        query = argv["query"];
+        if (argv.contains("limit")) limit = argv["limit"];
+      } else if constexpr (is_same<Format, string>::value) {
+        //protobuf 메시지 처리
+        CSSearchRooms cs_search_rooms;
+        parse_body(cs_search_rooms, argv);
+        query = cs_search_rooms.query();
+        limit = cs_search_rooms.limit();
+      } else {
+        //flat 메시지 처리
+        query = string(argv.str1());
+        limit = argv.count();
+      }
 
-          delete(message_room_result);
-        } else {
-          SCSystemMessage *message_sys = new SCSystemMessage;
+      if (query.empty()) {
+        messages.push_back(ServerMessage::system_message("검색어가 비어 있습니다."));
+      } else {
+        vector<Index> room_ids;
+        search_index->search(query, limit <= 0 ? DEFAULT_ROOMS_PAGE : min(static_cast<size_t>(limit), MAX_ROOMS_PAGE), room_ids);
+        messages.push_back(room_listing->select(room_ids));
+      }
 
-          message_type->set_type(Type_MessageType_SC_SYSTEM_MESSAGE);
-          messages.push_back(message_type->SerializeAsString());
+      send_messages_to_client(sock, messages);
 
-          message_sys->set_text("개설된 방이 없습니다.");
-          messages.push_back(message_sys->SerializeAsString());
+      return;
+    }
 
-          delete(message_sys);
+    /**
+     * @brief 방 생성 메시지를 처리.
+     * 
+     * @param sock 클라이언트 소켓 번호
+     * @param argv 메시지 데이터
+     */
+    void on_cs_create_room(int sock, Format argv) {
+      MessageList messages; ///< 보낼 메시지 리스트
+
+      {
+        string title; ///< 방 제목
+
+        if constexpr (is_same<Format, json>::value) {
+          //json 메시지 처리
+          title = argv["title"];
+        } else if constexpr (is_same<Format, string>::value) {
+          //protobuf 메시지 처리
+          CSCreateRoom cs_create_room;
+          parse_body(cs_create_room, argv);
+          title = cs_create_room.title();
+        } else {
+          //flat 메시지 처리
+          title = string(argv.title());
         }
 
-        delete(message_type);
+        //방 ID 는 lock 없이 받고, 테이블의 그 슬롯에 바로 만든다
+        int room_id = (*rooms).allocate_key();
+        if (room_id == 0) {
+          messages.push_back(ServerMessage::system_message("방을 더 만들 수 없습니다."));
+          send_messages_to_client(sock, messages);
+          return;
+        }
+        //ID 를 예측한 다른 클라이언트가 입장 후 퇴장해 방을 지우지 못하도록 생성, 입장, 목록 갱신을 한 번의 lock 안에서 한다
+        {
+          ProfiledLock lock(room_mutex);
+          Room &room = (*rooms).get((*rooms).emplace(room_id, room_id, title));
+          room.join_client_locked(sock, &(*client_sockets)[sock], room_id);
+          room_listing->update_locked(room);
+          title = room.get_title();
+        }
+        search_index->add(room_id, title);
+
+        messages.push_back(ServerMessage::system_message("방제[" + title + "] 방에 입장했습니다."));
       }
 
       send_messages_to_client(sock, messages);
@@ -369,73 +1164,124 @@ class MessageHandlers {
     }
 
     /**
-     * @brief 방 생성 메시지를 처리.
+     * @brief 방 입장 메시지를 처리.
      * 
      * @param sock 클라이언트 소켓 번호
      * @param argv 메시지 데이터
      */
-    void on_cs_create_room(int sock, Format argv) {
+    void on_cs_join_room(int sock, Format argv) {
       MessageList messages; ///< 보낼 메시지 리스트
-      int client_room_id = (*client_sockets)[sock].get_entered_room_id(); // 클라이언트가 현재 들어가 있는 방 ID, 없다면 0
+      int room_id; ///< 들어갈 방 ID
 
       if constexpr (is_same<Format, json>::value) {
         //json 메시지 처리
-        if (client_room_id != 0) {
-          json message = {
-            {"type", "SCSystemMessage"},
-            {"text", "대화 방에 있을 때는 방을 개설 할 수 없습니다."},
-          };
-          messages.push_back(message);
-        } else {
-          int room_id = Room::next_room_id;
-          
-          //방 생성
-          Room room(argv["title"]);
-          {
-            unique_lock<mutex> lock(room_mutex);
-            (*rooms)[room_id] = room;
-          }
-          (*rooms)[room_id].join_client(sock, &(*client_sockets)[sock], room_id);
+        room_id = argv["roomId"];
+      } else if constexpr (is_same<Format, string>::value) {
+        //protobuf 메시지 처리
+        CSJoinRoom cs_join_room;
+        parse_body(cs_join_room, argv);
+        room_id = cs_join_room.roomid();
+      } else {
+        //flat 메시지 처리
+        room_id = argv.room_id();
+      }
+
+      auto &client_socket = (*client_sockets)[sock];
+      if (client_socket.is_in_room(room_id)) {
+        messages.push_back(ServerMessage::system_message("이미 들어가 있는 방입니다."));
+        send_messages_to_client(sock, messages);
+        return;
+      }
 
-          json message = {
-            {"type", "SCSystemMessage"},
-            {"text", "방제[" + (*rooms)[room_id].get_title() + "] 방에 입장했습니다."},
-          };
-          messages.push_back(message);
+      //마지막 멤버가 나가며 방을 지우는 것과 엇갈리지 않도록 찾기와 입장을 한 번의 lock 안에서 한다
+      string title; ///< 들어간 방 제목, 방이 없으면 비어 있다
+      bool joined = false;
+      {
+        ProfiledLock lock(room_mutex);
+        Room *room = (*rooms).find(room_id);
+        if (room != nullptr) {
+          room->join_client_locked(sock, &client_socket, room_id); // 방 입장
+          room_listing->update_locked(*room);
+          title = room->get_title();
+          joined = true;
         }
+      }
 
+      if (!joined) {
+        messages.push_back(ServerMessage::system_message("대화방이 존재하지 않습니다."));
       } else {
+        announce_presence(sock, room_id, client_socket.get_name(), true);
+
+        messages.push_back(ServerMessage::system_message("방제[" + title + "] 방에 입장했습니다."));
+      }
+
+      send_messages_to_client(sock, messages);
+
+      return;
+    }
+
+    /**
+     * @brief 방 퇴장 메시지를 처리.
+     * 
+     * @param sock 클라이언트 소켓 번호
+     * @param argv 메시지 데이터
+     */
+    void on_cs_leave_room(int sock, Format argv) {
+      MessageList messages; ///< 보낼 메시지 리스트
+      int client_room_id = 0; ///< 나갈 방 ID, 0 이면 기본 방
+
+      if constexpr (is_same<Format, json>::value) {
+        //json 메시지 처리
+        if (argv.contains("roomId")) client_room_id = argv["roomId"];
+      } else if constexpr (is_same<Format, string>::value) {
         //protobuf 메시지 처리
-        Type *message_type = new Type;
-        SCSystemMessage *message_sys = new SCSystemMessage;
+        CSLeaveRoom cs_leave_room;
+        parse_body(cs_leave_room, argv);
+        client_room_id = cs_leave_room.roomid();
+      } else {
+        //flat 메시지 처리
+        client_room_id = argv.room_id();
+      }
+      if (client_room_id == 0) {
+        client_room_id = (*client_sockets)[sock].get_entered_room_id();
+      }
 
-        message_type->set_type(Type_MessageType_SC_SYSTEM_MESSAGE);
-        messages.push_back(message_type->SerializeAsString());
+      if (client_room_id == 0) {
+        messages.push_back(ServerMessage::system_message("현재 대화방에 들어가 있지 않습니다."));
+      } else if (!(*client_sockets)[sock].is_in_room(client_room_id)) {
+        messages.push_back(ServerMessage::system_message("들어가 있지 않은 방입니다."));
+      } else {
+        auto &client_socket = (*client_sockets)[sock];
 
-        if (client_room_id != 0) {
-          message_sys->set_text("대화 방에 있을 때는 방을 개설 할 수 없습니다.");
-          messages.push_back(message_sys->SerializeAsString());
-        } else {
-          int room_id = Room::next_room_id;
-          CSCreateRoom *cs_create_room = new CSCreateRoom;
-          cs_create_room->ParseFromString(argv);
-
-          //방 생성
-          Room room(cs_create_room->title());
-          {
-            unique_lock<mutex> lock(room_mutex);
-            (*rooms)[room_id] = room;
-          }
-          (*rooms)[room_id].join_client(sock, &(*client_sockets)[sock], room_id);
-          
-          message_sys->set_text("방제[" + (*rooms)[room_id].get_title() + "] 방에 입장했습니다.");
-          messages.push_back(message_sys->SerializeAsString());
+        announce_presence(sock, client_room_id, client_socket.get_name(), false);
 
-          delete(cs_create_room);
+        //방 퇴장, 퇴장 후 방에 멤버가 아무도 없다면 방폭. 다른 쓰레드의 입장과 엇갈리지 않도록 한 번의 lock 안에서 한다
+        string title; ///< 나간 방 제목
+        bool erased = false;
+        {
+          ProfiledLock lock(room_mutex);
+          Room *room = (*rooms).find(client_room_id);
+          if (room == nullptr) {
+            // 방이 없으면 들어가 있다는 기록만 지운다
+            client_socket.remove_joined_room(client_room_id);
+          } else {
+            title = room->get_title();
+            room->leave_client_locked(sock);
+            if (room->get_members().size() == 0) {
+              cout << "방[" << client_room_id << "] 명시적 /leave로 인해 삭제"<< endl;
+              (*rooms).erase(client_room_id);
+              erased = true;
+            } else {
+              room_listing->update_locked(*room);
+            }
+          }
+        }
+        if (erased) {
+          room_listing->remove(client_room_id);
+          search_index->remove(client_room_id);
         }
 
-        delete(message_type);
-        delete(message_sys);
+        messages.push_back(ServerMessage::system_message("방제[" + title + "] 대화 방에서 퇴장했습니다."));
       }
 
       send_messages_to_client(sock, messages);
@@ -444,330 +1290,464 @@ class MessageHandlers {
     }
 
     /**
-     * @brief 방 입장 메시지를 처리.
+     * @brief 채팅 메시지를 처리.
      * 
      * @param sock 클라이언트 소켓 번호
      * @param argv 메시지 데이터
      */
-    void on_cs_join_room(int sock, Format argv) {
-      MessageList messages; ///< 보낼 메시지 리스트
-      int client_room_id = (*client_sockets)[sock].get_entered_room_id(); // 클라이언트가 현재 들어가 있는 방 ID, 없다면 0
+    void on_cs_chat(int sock, Format argv) {
+      int client_room_id = 0; ///< 채팅을 보낼 방 ID, 0 이면 기본 방
+      string text; ///< json, protobuf 의 채팅 내용, 메시지가 가져간다
+      string_view text_view; ///< flat 의 채팅 내용, 수신 버퍼를 그대로 가리킨다
 
       if constexpr (is_same<Format, json>::value) {
         //json 메시지 처리
-        if (client_room_id != 0) {
-          json message = {
-            {"type", "SCSystemMessage"},
-            {"text", "대화 방에 있을 때는 다른 방에 들어갈 수 없습니다."},
-          };
-          messages.push_back(message);
-        } else if ((*rooms).find(argv["roomId"]) == (*rooms).end()){
-          json message = {
-            {"type", "SCSystemMessage"},
-            {"text", "대화방이 존재하지 않습니다."},
-          };
-          messages.push_back(message);
-        } else {
-          auto &room = (*rooms)[argv["roomId"]];
-          auto &client_socket = (*client_sockets)[sock];
-
-          room.join_client(sock, &client_socket, argv["roomId"]); // 방 입장
-
-          json message = {
-            {"type", "SCSystemMessage"},
-            {"text", "[" + client_socket.get_client_name() + "] 님이 입장했습니다."},
-          };
-          messages.push_back(message);
-          
-          broadcast(sock, messages);
-          messages.pop_back();
-
-          message = {
-            {"type", "SCSystemMessage"},
-            {"text", "방제[" + room.get_title() + "] 방에 입장했습니다."},
-          };
-          messages.push_back(message);
-        }
+        text = argv["text"];
+        if (argv.contains("roomId")) client_room_id = argv["roomId"];
+      } else if constexpr (is_same<Format, string>::value) {
+        //protobuf 메시지 처리
+        CSChat cs_chat;
+        parse_body(cs_chat, argv);
+        text = move(*cs_chat.mutable_text());
+        client_room_id = cs_chat.roomid();
+      } else {
+        //flat 메시지 처리
+        text_view = argv.text();
+        client_room_id = argv.room_id();
+      }
+      if (client_room_id == 0) {
+        client_room_id = (*client_sockets)[sock].get_entered_room_id();
+      }
 
+      MessageList messages; ///< 보낼 메시지 리스트
+      bool delivered = false; ///< 방에 보냈는지 여부
+      if (client_room_id == 0) {
+        messages.push_back(ServerMessage::system_message("현재 대화방에 들어가 있지 않습니다."));
+      } else if (!(*client_sockets)[sock].is_in_room(client_room_id)) {
+        messages.push_back(ServerMessage::system_message("들어가 있지 않은 방입니다."));
+      } else if constexpr (is_same<Format, FlatMessage>::value) {
+        messages.push_back(ServerMessage::borrowed_chat((*client_sockets)[sock].get_name(), text_view, client_room_id));
+        delivered = true;
       } else {
-        //protobuf 메시지 처리
-        Type *message_type = new Type;
-        SCSystemMessage *message_sys = new SCSystemMessage;
-        CSJoinRoom *cs_join_room = new CSJoinRoom;
-        cs_join_room->ParseFromString(argv);
+        messages.push_back(ServerMessage::chat((*client_sockets)[sock].get_name(), move(text), client_room_id));
+        delivered = true;
+      }
 
-        message_type->set_type(Type_MessageType_SC_SYSTEM_MESSAGE);
-        messages.push_back(message_type->SerializeAsString());
+      send_messages_to_client(sock, messages);
+      if (delivered) {
+        broadcast(sock, client_room_id, messages);
+        room_listing->touch(client_room_id);
+      }
 
-        if (client_room_id != 0) {
-          message_sys->set_text("대화 방에 있을 때는 다른 방에 들어갈 수 없습니다.");
-          messages.push_back(message_sys->SerializeAsString());
+      return;
+    }
 
-        } else if ((*rooms).find(cs_join_room->roomid()) == (*rooms).end()){
-          message_sys->set_text("대화방이 존재하지 않습니다.");
-          messages.push_back(message_sys->SerializeAsString());
+    /**
+     * @brief 서버 종료 메시지를 처리.
+     * 
+     * @param sock 클라이언트 소켓 번호
+     * @param argv 메시지 데이터
+     */
+    void on_cs_shutdown(int sock, Format message) {
+      quit.store("true");
+      cout << "shutdown" << endl;
 
-        } else {      
-          auto &room = (*rooms)[cs_join_room->roomid()];
-          auto &client_socket = (*client_sockets)[sock];
+      return;
+    }
 
-          room.join_client(sock, &client_socket, cs_join_room->roomid()); // 방 입장
-          
-          message_sys->set_text("[" + client_socket.get_client_name() + "] 님이 입장했습니다.");
-          messages.push_back(message_sys->SerializeAsString());
+    /**
+     * @brief 여러 메시지를 담은 배치 메시지를 처리.
+     *
+     * 안쪽 메시지는 일반 핸들러로 차례대로 처리하고, 그 동안 보내는 메시지는 목적지별로 모았다가
+     * 배치가 끝난 뒤 목적지마다 한 번만 전송한다.
+     * 
+     * @param sock 클라이언트 소켓 번호
+     * @param argv 메시지 데이터
+     */
+    void on_cs_batch(int sock, Format argv) {
+      run_batch(sock, [&]() {
+        if constexpr (is_same<Format, json>::value) {
+          //json 메시지 처리
+          for (auto &entry : argv["messages"]) {
+            if (!entry.contains("type")) {
+              throw NoTypeFieldInMessage();
+            }
+            handle_message(sock, entry["type"], entry);
+          }
+        } else if constexpr (is_same<Format, string>::value) {
+          //protobuf 메시지 처리
+          CSBatch cs_batch;
+          parse_body(cs_batch, argv);
+          for (auto &entry : cs_batch.messages()) {
+            handle_message(sock, to_string(entry.type()), entry.body());
+          }
+        } else {
+          //flat 메시지 처리
+          vector<string_view> entries;
+          if (!argv.batch_entries(entries)) {
+            throw MalformedFlatMessage();
+          }
+          for (auto &entry : entries) {
+            FlatMessage msg(entry);
+            if (!msg.valid()) {
+              throw MalformedFlatMessage();
+            }
+            handle_message(sock, to_string(msg.type()), msg);
+          }
+        }
+      });
+    }
+
+    /**
+     * @brief outbox 를 켜고 dispatch 로 배치 안의 메시지들을 처리한 뒤, 모인 메시지를 목적지별로 전송.
+     * 
+     * @param sock 배치를 보낸 클라이언트 소켓 번호
+     * @param dispatch 안쪽 메시지를 handle_message 로 넘기는 함수
+     */
+    template <typename Dispatch>
+    void run_batch(int sock, Dispatch dispatch) {
+      if (outbox != nullptr) {
+        throw NestedBatchInMessage();
+      }
+      (*client_sockets)[sock].set_batch_replies(true);
+
+      Outbox batch_outbox;
+      outbox = &batch_outbox;
+      try {
+        dispatch();
+      } catch (...) {
+        //오류 전까지 처리한 메시지의 응답은 보낸다
+        outbox = nullptr;
+        flush_outbox(batch_outbox);
+        throw;
+      }
+      outbox = nullptr;
+      flush_outbox(batch_outbox);
+    }
 
-          broadcast(sock, messages);
-          messages.pop_back();
+    /**
+     * @brief 배치 중에 보낼 메시지를 목적지의 outbox 에 넣는다.
+     * 
+     * @param sock 목적지 소켓 번호
+     * @param client 목적지 클라이언트
+     * @param messages 보낼 메시지 리스트
+     */
+    void enqueue_outbox(int sock, Client &client, const MessageList &messages) {
+      auto it = outbox->pending.find(sock);
+      if (it == outbox->pending.end()) {
+        outbox->order.push_back(sock);
+        it = outbox->pending.emplace(sock, Outgoing {client.get_connection_id(), client.get_format(), client.get_framing(), client.get_batch_replies(), {}}).first;
+      }
+      auto &pending = it->second.messages;
+      pending.insert(pending.end(), messages.begin(), messages.end());
+    }
 
-          message_sys->set_text("방제[" + room.get_title() + "] 방에 입장했습니다.");
-          messages.push_back(message_sys->SerializeAsString());
+    /**
+     * @brief outbox 에 모인 메시지를 목적지마다 한 번씩 전송.
+     *
+     * CSBatch 를 보낸 적이 있는 클라이언트는 SCBatch 프레임 하나로, 그렇지 않은 클라이언트는 개별 프레임들을 writev 한 번으로 받는다.
+     * 
+     * @param batch_outbox 전송할 outbox
+     */
+    void flush_outbox(Outbox &batch_outbox) {
+      ScopedTimer timer(send_clock);
+      for (int sock : batch_outbox.order) {
+        auto &outgoing = batch_outbox.pending[sock];
+        if (outgoing.batch_replies && outgoing.messages.size() > 1) {
+          EncodedFrame batch = encode_batch(outgoing.format, outgoing.messages);
+          if (batch.frame_size(batch.frames.size() - 1) <= max_frame_length(outgoing.framing)) {
+            ServerMetrics::instance().frames_out[Type_MessageType_SC_BATCH]->inc();
+            send_encoded_frames(sock, outgoing.connection_id, outgoing.framing, {&batch});
+            continue;
+          }
         }
-
-        delete(message_type);
-        delete(message_sys);
-        delete(cs_join_room);
+        send_encoded_messages(sock, outgoing.connection_id, outgoing.format, outgoing.framing, outgoing.messages);
       }
-
-      send_messages_to_client(sock, messages);
-
-      return;
     }
 
     /**
-     * @brief 방 퇴장 메시지를 처리.
+     * @brief 특정 클라이언트에게 메시지 리스트를 전송.
      * 
      * @param sock 클라이언트 소켓 번호
-     * @param argv 메시지 데이터
+     * @param messages 전송할 메시지 리스트
      */
-    void on_cs_leave_room(int sock, Format argv) {
-      MessageList messages; ///< 보낼 메시지 리스트
-      int client_room_id = (*client_sockets)[sock].get_entered_room_id(); // 클라이언트가 현재 들어가 있는 방 ID, 없다면 0
+    void send_messages_to_client(int sock, const MessageList &messages) {
+      ScopedTimer timer(send_clock);
+      auto &client_socket = (*client_sockets)[sock];
+      if (outbox != nullptr) {
+        enqueue_outbox(sock, client_socket, messages);
+        return;
+      }
+      send_encoded_messages(sock, client_socket.get_connection_id(), client_socket.get_format(), client_socket.get_framing(), messages);
+    }
 
-      if constexpr (is_same<Format, json>::value) {
-        //json 메시지 처리
-        if (client_room_id == 0) {
-          json message = {
-            {"type", "SCSystemMessage"},
-            {"text", "현재 대화방에 들어가 있지 않습니다."},
-          };
-          messages.push_back(message);
-        } else {
-          auto &client_socket = (*client_sockets)[sock];
-          auto &room = (*rooms)[client_room_id];
-
-          json message = {
-            {"type", "SCSystemMessage"},
-            {"text", "[" + client_socket.get_client_name() + "] 님이 퇴장했습니다."}
-          };
-          messages.push_back(message);
-          broadcast(sock, messages);
-          messages.pop_back();
-
-          //방 퇴장, 퇴장 후 방에 멤버가 아무도 없다면 방폭
-          room.leave_client(sock);
-          if (room.get_members().size() == 0) {
-            cout << "방[" << client_room_id << "] 명시적 /leave로 인해 삭제"<< endl;
-            {
-              unique_lock<mutex> lock(room_mutex);
-              (*rooms).erase(client_room_id);
-            }
-          }
+    /**
+     * @brief 프레이밍이 표현할 수 없을 만큼 큰 메시지 대신 보낼 안내 메시지.
+     */
+    static const ServerMessagePtr &too_large_notice() {
+      static const ServerMessagePtr notice = ServerMessage::system_message(
+        "메시지가 너무 커서 전송하지 못했습니다. 큰 메시지를 받으려면 U32 또는 VARINT 프레이밍을 협상해야 합니다.");
+      return notice;
+    }
 
-          message = {
-            {"type", "SCSystemMessage"},
-            {"text", "방제[" + room.get_title() + "] 대화 방에서 퇴장했습니다."},
-          };
-          messages.push_back(message);
+    /**
+     * @brief 메시지 리스트를 format 으로 인코딩하고 framing 에 맞는 길이 prefix 를 붙여 writev 한 번으로 전송.
+     *
+     * 인코딩 결과는 메시지에 캐시되므로 같은 포맷의 다른 클라이언트에게 보낼 때는 다시 인코딩하지 않는다.
+     * 프레이밍이 표현할 수 없는 길이의 메시지는 잘라 보내지 않고 안내 메시지로 대신한다.
+     * 
+     * @param sock 클라이언트 소켓 번호
+     * @param connection 클라이언트의 연결 번호, 소켓을 그새 다른 연결이 쓰고 있으면 보내지 않는다
+     * @param format 클라이언트의 메시지 포맷
+     * @param framing 클라이언트의 프레이밍 모드
+     * @param messages 전송할 메시지 리스트
+     */
+    void send_encoded_messages(int sock, uint32_t connection, MessageFormat format, FramingMode framing, const MessageList &messages) {
+      vector<const EncodedFrame *> encoded;
+      uint64_t trace = TraceScope::current();
+      for (auto message = messages.begin(); message != messages.end(); ++message) {
+        uint64_t encode_start = trace != 0 ? metric_now_ns() : 0;
+        const EncodedFrame *frame = &(*message)->encode(format);
+        // 캐시된 인코딩을 꺼낸 경우도 짧은 span 으로 남는다
+        if (trace != 0 && TraceScope::take_span()) {
+          Tracer::instance().complete(trace, "serialize", encode_start, metric_now_ns(),
+                                      "\"format\":" + to_string(static_cast<int>(format)) + ",\"type\":\"" + message_type_label((*message)->get_type()) + "\"");
         }
-      } else {
-        //protobuf 메시지 처리
-        Type *message_type = new Type;
-        SCSystemMessage *message_sys = new SCSystemMessage;
-
-        message_type->set_type(Type_MessageType_SC_SYSTEM_MESSAGE);
-        messages.push_back(message_type->SerializeAsString());
-
-        if (client_room_id == 0) {
-          message_sys->set_text("현재 대화방에 들어가 있지 않습니다.");
-          messages.push_back(message_sys->SerializeAsString());
-
-        } else {
-          auto &client_socket = (*client_sockets)[sock];
-          auto &room = (*rooms)[client_room_id];
-
-          message_sys->set_text("[" + client_socket.get_client_name() + "] 님이 퇴장했습니다.");
-          messages.push_back(message_sys->SerializeAsString());
-
-          broadcast(sock, messages);
-          messages.pop_back();
-          
-          //방 퇴장, 퇴장 후 방에 멤버가 아무도 없다면 방폭
-          room.leave_client(sock);
-          if (room.get_members().size() == 0) {
-            cout << "방[" << client_room_id << "] 명시적 /leave로 인해 삭제"<< endl;
-            {
-              unique_lock<mutex> lock(room_mutex);
-              (*rooms).erase(client_room_id);
-            }
+        for (size_t i = 0; i < frame->frames.size(); ++i) {
+          if (frame->frame_size(i) > max_frame_length(framing)) {
+            cerr << "Error: Message of " << frame->frame_size(i) << " bytes does not fit in the framing, clientSock: " << sock << endl;
+            frame = &too_large_notice()->encode(format);
+            break;
           }
-
-          message_sys->set_text("방제[" + room.get_title() + "] 대화 방에서 퇴장했습니다.");
-          messages.push_back(message_sys->SerializeAsString());
         }
-
-        delete(message_type);
-        delete(message_sys);
+        ServerMetrics::instance().frames_out[(*message)->get_type()]->inc();
+        encoded.push_back(frame);
       }
 
-      send_messages_to_client(sock, messages);
-
-      return;
+      send_encoded_frames(sock, connection, framing, encoded);
     }
 
     /**
-     * @brief 채팅 메시지를 처리.
+     * @brief 인코딩된 프레임들에 framing 에 맞는 길이 prefix 를 붙여 writev 한 번으로 전송.
+     *
+     * 전송은 막히지 않는다. 소켓 버퍼가 받지 못한 나머지는 OutboundQueues 에 쌓여 메인 루프가 나중에 보낸다.
      * 
      * @param sock 클라이언트 소켓 번호
-     * @param argv 메시지 데이터
+     * @param connection 클라이언트의 연결 번호
+     * @param framing 클라이언트의 프레이밍 모드
+     * @param encoded 전송할 프레임들, 길이가 framing 으로 표현 가능해야 한다
      */
-    void on_cs_chat(int sock, Format argv) {
-      MessageList messages; ///< 보낼 메시지 리스트
-      int client_room_id = (*client_sockets)[sock].get_entered_room_id(); // 클라이언트가 현재 들어가 있는 방 ID, 없다면 0
+    void send_encoded_frames(int sock, uint32_t connection, FramingMode framing, const vector<const EncodedFrame *> &encoded) {
+      size_t num_frames = 0;
+      for (const EncodedFrame *frame : encoded) {
+        num_frames += frame->frames.size();
+      }
 
-      if constexpr (is_same<Format, json>::value) {
-        //json 메시지 처리
-        if (client_room_id == 0) {
-          json message = {
-            {"type", "SCSystemMessage"},
-            {"text", "현재 대화방에 들어가 있지 않습니다."},
-          };
-          messages.push_back(message);
-        } else {
-          json message = {
-            {"type", "SCChat"},
-            {"member", (*client_sockets)[sock].get_client_name()},
-            {"text", argv["text"]},
-          };
-          messages.push_back(message);
+      vector<char> prefixes(num_frames * MAX_LENGTH_PREFIX);
+      vector<iovec> iov;
+      char *prefix = prefixes.data();
+      for (const EncodedFrame *frame : encoded) {
+        for (size_t i = 0; i < frame->frames.size(); ++i) {
+          size_t prefix_len = encode_length_prefix(framing, frame->frame_size(i), prefix);
+          iov.push_back({prefix, prefix_len});
+          prefix += prefix_len;
+          iov.push_back({const_cast<char *>(frame->frames[i].data()), frame->frames[i].size()});
         }
+        if (!frame->tail.empty()) {
+          iov.push_back({const_cast<char *>(frame->tail.data()), frame->tail.size()});
+        }
+      }
 
-      } else {
-        //protobuf 메시지 처리
-        Type *message_type = new Type;
-        
-        if (client_room_id == 0) {
-          SCSystemMessage *message_sys = new SCSystemMessage;
-
-          message_type->set_type(Type_MessageType_SC_SYSTEM_MESSAGE);
-          messages.push_back(message_type->SerializeAsString());
-
-          message_sys->set_text("현재 대화방에 들어가 있지 않습니다.");
-          messages.push_back(message_sys->SerializeAsString());
-
-          delete(message_sys);
-        } else {
-          SCChat *sc_chat = new SCChat;
-          CSChat *cs_chat = new CSChat;
-          cs_chat->ParseFromString(argv);
-
-          message_type->set_type(Type_MessageType_SC_CHAT);
-          messages.push_back(message_type->SerializeAsString());
+      // 소켓 버퍼가 차 있으면 막히지 않고 클라이언트의 송신 큐에 넣는다
+      size_t num_bytes = 0;
+      for (auto &buffer : iov) {
+        num_bytes += buffer.iov_len;
+      }
+      uint64_t trace = TraceScope::current();
+      uint64_t send_start = trace != 0 ? metric_now_ns() : 0;
+      OutboundQueues::Result result = outbound->send(sock, connection, iov.data(), iov.size());
+      if (result != OutboundQueues::Result::CLOSED) {
+        ServerMetrics::instance().bytes_out.inc(num_bytes);
+      }
+      if (trace != 0 && TraceScope::take_span()) {
+        static const char *const result_names[] = {"sent", "queued", "closed"};
+        Tracer::instance().complete(trace, "send", send_start, metric_now_ns(), "\"sock\":" + to_string(sock) + ",\"bytes\":" +
+                                    to_string(num_bytes) + ",\"result\":\"" + result_names[static_cast<int>(result)] + "\"");
+      }
 
-          sc_chat->set_member((*client_sockets)[sock].get_client_name());
-          sc_chat->set_text(cs_chat->text());
-          messages.push_back(sc_chat->SerializeAsString());
+      return;
+    }
 
-          delete(sc_chat);
-          delete(cs_chat);
+    /**
+     * @brief 입장 또는 퇴장을 방의 다른 멤버에게 알린다.
+     *
+     * 드나듦이 잦은 큰 방에서는 바로 보내지 않고 방의 coalescing 창에 모은다.
+     * 창을 새로 열었으면 창이 닫힐 때 flush_presence() 가 불리도록 예약한다.
+     * 
+     * @param sock 들어오거나 나가는 클라이언트 소켓 번호
+     * @param room_id 방 ID
+     * @param name 들어오거나 나가는 클라이언트 이름
+     * @param is_join 입장이면 true
+     */
+    void announce_presence(int sock, int room_id, const NamePtr &name, bool is_join) {
+      PresenceCoalescer::Decision decision;
+      {
+        ProfiledLock lock(room_mutex);
+        Room *room = (*rooms).find(room_id);
+        if (room == nullptr) {
+          return;
         }
-
-        delete(message_type);
+        decision = room->get_presence().record(name, is_join, room->get_members().size(), PresenceCoalescer::Clock::now());
       }
 
-      send_messages_to_client(sock, messages);
-      if (client_room_id != 0) {
-        broadcast(sock, messages);
+      if (decision.immediate) {
+        broadcast(sock, room_id, MessageList {ServerMessage::system_message(PresenceCoalescer::single(name, is_join))});
+      } else if (decision.schedule) {
+        presence->schedule(room_id, decision.deadline);
       }
+    }
 
-      return;
+    /**
+     * @brief 방에 있는 송신 클라이언트 외의 모든 클라이언트에게 메시지를 브로드캐스트.
+     *
+     * 방의 멤버 목록만 훑으므로 비용은 전체 클라이언트 수가 아니라 그 방의 멤버 수에 비례한다.
+     * 각 멤버는 자기 포맷의 인코딩을 받으며, 인코딩은 포맷마다 한 번만 일어난다.
+     * 
+     * @param sock 송신 클라이언트 소켓 번호
+     * @param room_id 방 ID
+     * @param messages 브로드캐스트할 메시지 리스트
+     */
+    void broadcast(int sock, int room_id, const MessageList &messages) {
+      broadcast(sock, vector<int> {room_id}, messages);
     }
 
     /**
-     * @brief 서버 종료 메시지를 처리.
+     * @brief 여러 방에 브로드캐스트. 여러 방에 함께 있는 멤버도 한 번만 받는다.
+     *
+     * 큰 방은 멤버를 직접 훑지 않고 fan-out 풀에 넘긴다. 큰 방에는 배치 중에도 outbox 를 거치지 않고 넘겨서
+     * 같은 방에 먼저 넘긴 메시지를 앞지르지 않게 한다.
      * 
-     * @param sock 클라이언트 소켓 번호
-     * @param argv 메시지 데이터
+     * @param sock 송신 클라이언트 소켓 번호
+     * @param room_ids 방 ID 들
+     * @param messages 브로드캐스트할 메시지 리스트
      */
-    void on_cs_shutdown(int sock, Format message) {
-      quit.store("true");
-      cout << "shutdown" << endl;
+    void broadcast(int sock, const vector<int> &room_ids, const MessageList &messages) {
+      ScopedTimer timer(send_clock);
+      //브로드 캐스트 중에 방 멤버가 바뀌거나 방이 사라지지 않도록 mutex로 보호
+      ProfiledLock lock(room_mutex);
+      unordered_set<int> sent; ///< 방이 둘 이상일 때 이미 보냈거나 fan-out 에 넘긴 멤버
+      shared_ptr<const MessageList> shared_messages; ///< fan-out 쓰레드에 넘기는 메시지, 처음 필요할 때 만든다
+      for (int room_id : room_ids) {
+        Room *room = (*rooms).find(room_id);
+        if (room == nullptr) {
+          continue;
+        }
+        auto &members = room->get_members();
+        if (room->get_fanout() && fanout->size() > 0) {
+          if (shared_messages == nullptr) {
+            auto owned = make_shared<MessageList>();
+            for (auto &message : messages) {
+              owned->push_back(ServerMessage::owning(message));
+            }
+            shared_messages = move(owned);
+          }
+          shared_ptr<const unordered_set<int>> skip;
+          if (room_ids.size() > 1) {
+            skip = make_shared<const unordered_set<int>>(sent);
+            for (auto it = members.begin() ; it != members.end() ; ++it) {
+              sent.insert(it->fd);
+            }
+          }
+          post_fanout(sock, *room, shared_messages, skip);
+          continue;
+        }
+        // 멤버 배열을 순서대로 훑으며 Client 는 배치 처리 중에만 들여다본다
+        for (auto it = members.begin() ; it != members.end() ; ++it) {
+          if (it->fd == sock) continue;
+          if (room_ids.size() > 1 && !sent.insert(it->fd).second) continue;
+          if (outbox != nullptr) {
+            enqueue_outbox(it->fd, *it->client, messages);
+            continue;
+          }
+          send_encoded_messages(it->fd, it->connection_id, it->format, it->framing, messages);
+        }
+      }
 
       return;
     }
 
     /**
-     * @brief 특정 클라이언트에게 메시지 리스트를 전송.
+     * @brief 추적으로 뽑힌 메시지의 파싱과 핸들러 span 을 남긴다. 새로 뽑힌 메시지이면 워커가 꺼내기 전의 단계도 남긴다.
      * 
+     * @param trace trace id
+     * @param trace_root 이 메시지에서 새로 뽑혔는지, 배치 안쪽 메시지이면 false
      * @param sock 클라이언트 소켓 번호
-     * @param messages 전송할 메시지 리스트
+     * @param type 메시지 타입
+     * @param parse_start 프레임 해석을 시작한 시각
+     * @param start 핸들러를 시작한 시각
+     * @param end 핸들러가 끝난 시각
      */
-    void send_messages_to_client(int sock, MessageList messages){
-      for (auto message = messages.begin(); message != messages.end(); ++message) {
-        string serialized;
-        if constexpr (is_same<Format, json>::value) {
-          serialized = (*message).dump(); //json
-        } else {
-          serialized = (*message); //protobuf
-        }
-        
-        // 어디까지 읽어야 되는지 message boundary 추가
-        uint16_t to_send = htons(serialized.length());
-        char to_send_big_endian[2];
-        memcpy(to_send_big_endian, &to_send, 2);
-        serialized = string(to_send_big_endian, 2) + serialized;
-
-        int offset = 0;
-        while (offset < serialized.length()) {
-          int num_sent = send(sock, serialized.data() + offset, serialized.length() - offset, 0);
-          if (num_sent <= 0) {
-            cerr << "send() failed: " << strerror(errno) << ", clientSock: " << sock << endl;
-            return;
-          } 
-          // cout << "Sent: " << num_sent << " bytes, clientSock: " << sock << endl;
-          offset += num_sent;
+    void trace_handler(uint64_t trace, bool trace_root, int sock, const string &type, uint64_t parse_start, uint64_t start, uint64_t end) {
+      Tracer &tracer = Tracer::instance();
+      string args = "\"sock\":" + to_string(sock) + ",\"type\":\"" + type + "\"";
+      if (trace_root && frame_trace.enqueued_ns != 0) {
+        tracer.instant(trace, "enqueue", frame_trace.enqueued_ns, args, frame_trace.enqueue_thread);
+        tracer.complete(trace, "dequeue", frame_trace.enqueued_ns, frame_trace.dequeued_ns, args);
+        if (frame_trace.recv_start_ns != 0) {
+          tracer.complete(trace, "recv", frame_trace.recv_start_ns, frame_trace.recv_end_ns, args);
         }
       }
-
-      return;
+      if (parse_start < start) {
+        tracer.complete(trace, "parse", parse_start, start, args);
+      }
+      tracer.complete(trace, "handler", start, end, args);
     }
 
     /**
-     * @brief 송신 클라이언트의 방에 있는 모든 클라이언트에게 메시지를 브로드캐스트.
+     * @brief 큰 방의 브로드캐스트를 샤드마다 하나씩 fan-out 풀에 넘긴다. room_mutex 를 잡은 채로 불러야 한다.
+     *
+     * 멤버는 소켓 번호로 샤드가 정해지고 샤드의 작업은 넘긴 순서대로 실행되므로,
+     * 한 송신자의 메시지는 받는 쪽에 보낸 순서대로 도착한다.
      * 
      * @param sock 송신 클라이언트 소켓 번호
-     * @param messages 브로드캐스트할 메시지 리스트
+     * @param room 방
+     * @param messages 수신 버퍼를 빌리지 않는 메시지 리스트
+     * @param skip 다른 방에서 이미 받은 멤버, 없으면 nullptr
      */
-    void broadcast(int sock, MessageList messages) {
-      int client_room_id = (*client_sockets)[sock].get_entered_room_id();
-
-      if (client_room_id == 0) {
-        cout << "broadcast failed" << endl;
-        return;
-
-      } else {
-        auto members = (*rooms)[client_room_id].get_members();
-        {
-          //브로드 캐스트 중에 방 멤버가 바뀌거나 방이 사라지지 않도록 mutex로 보호
-          unique_lock<mutex> lock(room_mutex);
-          for (auto it = members.begin() ; it != members.end() ; ++it) {
-            auto &member = it->second;
-            if (member->get_client_fd() == sock) continue;
-            send_messages_to_client(member->get_client_fd() , messages);
+    void post_fanout(int sock, Room &room, const shared_ptr<const MessageList> &messages, const shared_ptr<const unordered_set<int>> &skip) {
+      auto &shards = room.get_shards(*fanout);
+      // 멤버들이 쓰는 포맷으로 미리 인코딩해 두어 인코딩 오류가 fan-out 쓰레드가 아니라 이 워커에서 나게 한다.
+      // 인코딩은 메시지에 캐시되므로 fan-out 쓰레드는 꺼내 쓰기만 한다
+      for (int format = 0; format < MESSAGE_FORMAT_COUNT; ++format) {
+        if (room.get_shard_formats() & (1u << format)) {
+          for (auto &message : *messages) {
+            message->encode(static_cast<MessageFormat>(format));
           }
         }
       }
-
-      return;
+      uint64_t trace = TraceScope::current();
+      for (size_t i = 0; i < shards.size(); ++i) {
+        if (shards[i]->empty()) {
+          continue;
+        }
+        // 추적 중이면 fan-out 쓰레드의 span 까지 화살표로 잇는다
+        uint64_t flow = trace != 0 ? Tracer::instance().flow_start(trace, metric_now_ns()) : 0;
+        fanout->post(i, [this, sock, shard = shards[i], messages, skip, trace, flow, i]() {
+          TraceScope trace_scope(trace);
+          uint64_t start = trace != 0 ? metric_now_ns() : 0;
+          if (trace != 0) {
+            Tracer::instance().name_thread("fanout " + to_string(i));
+            Tracer::instance().flow_end(trace, flow, start);
+          }
+          for (auto &member : *shard) {
+            if (member.fd == sock || (skip != nullptr && skip->count(member.fd) > 0)) continue;
+            send_encoded_messages(member.fd, member.connection_id, member.format, member.framing, *messages);
+          }
+          if (trace != 0) {
+            Tracer::instance().complete(trace, "fanout", start, metric_now_ns(), "\"members\":" + to_string(shard->size()));
+          }
+        });
+      }
     }
 
 
@@ -777,28 +1757,136 @@ class MessageHandlers {
      * 
      * @param client_sockets 클라이언트 소켓 관리 포인터
      * @param rooms 채팅 방 관리 포인터
+     * @param room_listing 방 목록 캐시 포인터
+     * @param names 이름 intern 테이블 포인터
+     * @param search_index 방 제목 검색 인덱스 포인터
+     * @param fanout 큰 방의 브로드캐스트를 나눠 보낼 fan-out 풀 포인터
+     * @param presence 입장/퇴장 요약을 보낼 시각을 예약하는 타이머 포인터
+     * @param outbound 클라이언트별 송신 큐 포인터
      */
-    MessageHandlers(ClientMap *client_sockets, RoomMap *rooms) 
-      : client_sockets(client_sockets), rooms(rooms) {
+    MessageHandlers(ClientMap *client_sockets, RoomMap *rooms, RoomListing *room_listing, NameTable *names, RoomSearchIndex *search_index,
+                    FanoutPool *fanout, PresenceScheduler *presence, OutboundQueues *outbound) 
+      : client_sockets(client_sockets), rooms(rooms), room_listing(room_listing), names(names), search_index(search_index),
+        fanout(fanout), presence(presence), outbound(outbound) {
       init_message_handlers();
     }
 
+    /**
+     * @brief 방의 coalescing 창을 닫고 모인 입장/퇴장을 요약 알림 하나로 멤버 모두에게 보낸다.
+     *
+     * announce_presence() 가 바로 보낼 때와 달리 당사자를 빼지 않는다. 요약 하나를 방 전체에 같은 인코딩으로 보내므로,
+     * 창 안에서 들어온 사람은 자기 이름이 든 요약도 받는다.
+     * 
+     * @param room_id 방 ID, 그 사이 사라진 방이면 아무것도 하지 않는다
+     */
+    void flush_presence(int room_id) {
+      string text;
+      {
+        ProfiledLock lock(room_mutex);
+        Room *room = (*rooms).find(room_id);
+        if (room == nullptr) {
+          return;
+        }
+        text = room->get_presence().flush();
+      }
+
+      if (!text.empty()) {
+        broadcast(-1, room_id, MessageList {ServerMessage::system_message(text)});
+      }
+    }
+
     /**
      * @brief 메시지를 처리하고 해당하는 핸들러를 실행.
+     *
+     * 핸들러의 처리 시간을 파싱, 핸들러 로직, 전송 단계로 나눠 기록한다. 핸들러 안의 본문 파싱과 전송은
+     * 쓰레드별 누적 시간의 차이로 구하고, 나머지를 핸들러 로직으로 본다. 배치의 시간에는 안쪽 메시지의 시간이 들어간다.
      * 
      * @param sock 클라이언트 소켓 번호
      * @param type 메시지 타입
      * @param argv 메시지 데이터
+     * @param parse_ns 핸들러를 부르기 전에 프레임을 argv 로 해석하는 데 걸린 시간 (ns)
      */
-    void handle_message(int sock, string type, Format argv) {
-      if (handlers.find(type) != handlers.end()) {
-        handlers[type](sock, argv);
+    void handle_message(int sock, string type, Format argv, uint64_t parse_ns = 0) {
+      auto it = handlers.find(type);
+      if (it != handlers.end()) {
+        measure_handler(sock, type, it->second, parse_ns, [&]() {it->second.handler(sock, argv);});
       } else {
         throw UnknownTypeInMessage(type);
       }
     }
+
+    /**
+     * @brief 핸들러 하나의 실행을 받은 프레임 수, 단계별 처리 시간, trace 에 기록한다.
+     * 
+     * @param sock 클라이언트 소켓 번호
+     * @param type 메시지 타입
+     * @param handler 지표를 기록할 핸들러
+     * @param parse_ns 핸들러를 부르기 전에 프레임을 해석하는 데 걸린 시간 (ns)
+     * @param run 핸들러를 실행하는 함수
+     */
+    template <typename Run>
+    void measure_handler(int sock, const string &type, Handler &handler, uint64_t parse_ns, Run run) {
+      handler.frames_in->inc();
+      // 배치 안쪽 메시지는 배치의 trace 를 잇고, 그 밖의 메시지만 새로 뽑는다
+      uint64_t trace = TraceScope::current();
+      bool trace_root = trace == 0 && (trace = Tracer::instance().sample()) != 0;
+      TraceScope trace_scope(trace);
+
+      uint64_t parse_before = parse_clock;
+      uint64_t send_before = send_clock;
+      uint64_t start = metric_now_ns();
+      run();
+      uint64_t elapsed = metric_now_ns() - start;
+      if (trace != 0) {
+        trace_handler(trace, trace_root, sock, type, start - parse_ns, start, start + elapsed);
+      }
+
+      uint64_t parsed = parse_clock - parse_before;
+      uint64_t sent = send_clock - send_before;
+      HandlerLatency &latency = *handler.latency;
+      latency.parse.observe(parse_ns + parsed);
+      latency.logic.observe(elapsed > parsed + sent ? elapsed - parsed - sent : 0);
+      latency.send.observe(sent);
+      latency.total.observe(parse_ns + elapsed);
+    }
+
+    /**
+     * @brief JsonScanner::split_batch 로 나눈 JSON 배치를 처리. 배치 전체의 DOM 없이 안쪽 메시지만 하나씩 파싱한다.
+     *
+     * json::parse 를 거치는 배치와 같게 CSBatch 프레임의 지표를 남긴다. 안쪽 메시지의 파싱 시간은 배치의 파싱 단계에 들어간다.
+     * 
+     * @param sock 클라이언트 소켓 번호
+     * @param entries 안쪽 메시지 프레임들
+     * @param parse_ns 프레임을 안쪽 메시지로 나누는 데 걸린 시간 (ns)
+     */
+    void handle_batch(int sock, const vector<string_view> &entries, uint64_t parse_ns = 0) {
+      measure_handler(sock, "CSBatch", handlers.at("CSBatch"), parse_ns, [&]() {
+        run_batch(sock, [&]() {
+          for (auto &entry : entries) {
+            uint64_t parse_start = metric_now_ns();
+            json msg;
+            if (!JsonScanner::parse_flat_object(entry, msg)) {
+              msg = json::parse(entry.begin(), entry.end());
+            }
+            if (!msg.contains("type")) {
+              throw NoTypeFieldInMessage();
+            }
+            uint64_t entry_parse_ns = metric_now_ns() - parse_start;
+            parse_clock += entry_parse_ns;
+            handle_message(sock, msg["type"], msg, entry_parse_ns);
+          }
+        });
+      });
+    }
 };
 
+template <typename Format>
+thread_local typename MessageHandlers<Format>::Outbox *MessageHandlers<Format>::outbox = nullptr;
+template <typename Format>
+thread_local uint64_t MessageHandlers<Format>::parse_clock = 0;
+template <typename Format>
+thread_local uint64_t MessageHandlers<Format>::send_clock = 0;
+
 /**
  * @class ChatServer
  * @brief 채팅 서버 기능을 처리하는 클래스.
@@ -811,10 +1899,20 @@ class ChatServer {
     int server_socket; ///< 서버 소켓 파일 디스크립터.
     ClientMap client_sockets; ///< 연결된 클라이언트 소켓을 저장하는 맵.
     RoomMap rooms; ///< 방 정보를 저장하는 맵.
+    RoomListing room_listing; ///< CSRooms 에 보낼 방 목록 캐시.
+    NameTable names; ///< 클라이언트 이름 intern 테이블.
+    RoomSearchIndex search_index; ///< 방 제목 검색 인덱스.
+    FanoutPool fanout; ///< 큰 방의 브로드캐스트를 나눠 보내는 쓰레드들.
+    PresenceScheduler presence; ///< 입장/퇴장 요약을 보낼 시각에 깨어나는 타이머.
+    OutboundQueues outbound; ///< 클라이언트마다 보내지 못한 바이트를 쌓아 두는 송신 큐.
+    AdminServer admin; ///< 지표를 내주는 관리용 HTTP 서버.
     set<int> will_close_client; ///< 닫을 소켓들.
+    MessageFormat default_format; ///< 포맷 협상을 하지 않은 연결이 쓰는 메시지 포맷.
     MessageHandlers<json> json_message_handlers; ///< JSON 메시지 핸들러.
     MessageHandlers<string> protobuf_message_handlers; ///< Protobuf 메시지 핸들러.
+    MessageHandlers<FlatMessage> flat_message_handlers; ///< flat 메시지 핸들러.
     vector<thread> worker_threads; ///< 클라이언트를 병렬로 처리할 워커 스레드들.
+    uint32_t last_connection_id = 0; ///< 마지막으로 붙인 연결 번호.
 
 
     /**
@@ -851,6 +1949,66 @@ class ChatServer {
       }
     }
 
+    /**
+     * @brief 스크레이프할 때 계산하는 지표를 등록하고 관리용 HTTP 서버를 연다.
+     * 
+     * @param address 관리용 서버가 바인드할 주소.
+     * @param port 관리용 포트 번호.
+     */
+    void init_admin_server(const string &address, int port) {
+      MetricsRegistry::instance().add_collector([this](string &out) {
+        // 방 수와 방 크기 분포는 그때그때 방을 훑어 만든다
+        HistogramSnapshot sizes;
+        size_t room_count;
+        {
+          ProfiledLock lock(room_mutex);
+          room_count = rooms.size();
+          for (auto it = rooms.begin(); it != rooms.end(); ++it) {
+            size_t members = it->get_members().size();
+            sizes.buckets[histogram_bucket(members)]++;
+            sizes.sum += members;
+            sizes.count++;
+          }
+        }
+        out += "# HELP chat_rooms 열려 있는 방 수\n# TYPE chat_rooms gauge\nchat_rooms " + to_string(room_count) + "\n";
+        out += "# HELP chat_room_members 방마다의 멤버 수\n# TYPE chat_room_members histogram\n";
+        MetricsRegistry::render_histogram(out, "chat_room_members", "", sizes, 1);
+
+        RoomSearchIndex::Stats search_stats = search_index.get_stats();
+        out += "# HELP chat_room_search_index_rooms 검색 인덱스의 방 수\n# TYPE chat_room_search_index_rooms gauge\n"
+               "chat_room_search_index_rooms " + to_string(search_stats.rooms) + "\n";
+        out += "# HELP chat_room_search_index_bytes 검색 인덱스 메모리 추정치\n# TYPE chat_room_search_index_bytes gauge\n"
+               "chat_room_search_index_bytes " + to_string(search_stats.memory_bytes) + "\n";
+        out += "# HELP chat_room_search_queries_total 방 검색 횟수\n# TYPE chat_room_search_queries_total counter\n"
+               "chat_room_search_queries_total " + to_string(search_stats.queries) + "\n";
+        out += "# HELP chat_room_search_query_seconds_total 방 검색에 쓴 시간\n# TYPE chat_room_search_query_seconds_total counter\n"
+               "chat_room_search_query_seconds_total " + to_string(search_stats.total_query_ns / 1e9) + "\n";
+
+        OutboundQueues::Stats outbound_stats = outbound.get_stats();
+        out += "# HELP chat_outbound_pending_bytes 소켓 버퍼가 차서 송신 큐에 쌓인 바이트 수\n# TYPE chat_outbound_pending_bytes gauge\n"
+               "chat_outbound_pending_bytes " + to_string(outbound_stats.pending_bytes) + "\n";
+        out += "# HELP chat_outbound_pending_sockets 송신 큐가 비어 있지 않은 연결 수\n# TYPE chat_outbound_pending_sockets gauge\n"
+               "chat_outbound_pending_sockets " + to_string(outbound_stats.pending_sockets) + "\n";
+        out += "# HELP chat_outbound_queued_total 소켓에 바로 쓰지 못하고 송신 큐에 넣은 전송 수\n# TYPE chat_outbound_queued_total counter\n"
+               "chat_outbound_queued_total " + to_string(outbound_stats.queued) + "\n";
+        out += "# HELP chat_slow_consumer_disconnects_total 송신 큐가 한도를 넘어 끊은 연결 수\n# TYPE chat_slow_consumer_disconnects_total counter\n"
+               "chat_slow_consumer_disconnects_total " + to_string(outbound_stats.slow_consumers) + "\n";
+      });
+
+      admin.add_route("/metrics", "text/plain; version=0.0.4; charset=utf-8", []() {return MetricsRegistry::instance().render();});
+      admin.add_route("/locks", "text/plain; charset=utf-8", []() {return lock_report();});
+      admin.add_route("/profile", "text/plain; charset=utf-8", []() {
+        if (!Sampler::instance().enabled()) {
+          return string("sampling profiler is disabled, run with --profile-hz=N\n");
+        }
+        return Sampler::instance().folded();
+      });
+      if (!admin.start(address, port)) {
+        exit(1);
+      }
+      cout << "admin server listening on " << address << ":" << port << endl;
+    }
+
     /**
      * @brief 클라이언트의 메세지를 처리할 워커 스레드를 초기화.
      * 
@@ -860,24 +2018,37 @@ class ChatServer {
       for (int i = 0; i < num_worker; ++i) {
         worker_threads.emplace_back([this, i]() {
           cout << "thread " << i << " started" << endl;
+          Tracer::instance().name_thread("worker " + to_string(i));
+          Sampler::instance().register_thread("worker " + to_string(i));
+          ServerMetrics &metrics = ServerMetrics::instance();
           while (quit.load() == false) {
-            int sock;
+            Task task;
+            uint64_t idle_start = metric_now_ns();
             {
-              unique_lock<mutex> lock(queue_mutex);
+              ProfiledLock lock(queue_mutex);
               while (task_queue.empty() && quit.load() == false) {
                 task_cv.wait(lock);
+                metrics.worker_wakeups.inc();
               }
 
               if (quit.load() == true) {
                 continue;
               }
 
-              sock = task_queue.front();
+              task = task_queue.front();
               task_queue.pop();
+              metrics.task_queue_depth.set(task_queue.size());
               // cout << "Consumed: " << sock << endl;
             }
-            process_socket(sock);
-            client_sockets[sock].set_is_waiting(false);
+            uint64_t busy_start = metric_now_ns();
+            metrics.worker_idle.inc(busy_start - idle_start);
+            metrics.task_queue_delay.observe(busy_start - task.enqueued_ns);
+            metrics.worker_tasks.inc();
+            frame_trace = FrameTrace {task.enqueue_thread, task.enqueued_ns, busy_start, 0, 0};
+
+            process_socket(task.sock);
+            client_sockets[task.sock].set_is_waiting(false);
+            metrics.worker_busy.inc(metric_now_ns() - busy_start);
           }
           cout << "thread " << i << " finished" << endl;
         });
@@ -900,8 +2071,15 @@ class ChatServer {
         memset(&sin, 0, sizeof(sin));
         sin_len = sizeof(sin);
         if (getpeername(sock, (struct sockaddr *) &sin, &sin_len) == 0) {
-          Client client_info(sock, "(" + to_string(*inet_ntoa(sin.sin_addr)) + ", " + to_string(ntohs(sin.sin_port)) + ")");
-          client_sockets[sock] = client_info;
+          NamePtr name = names.bind(sock, "(" + to_string(*inet_ntoa(sin.sin_addr)) + ", " + to_string(ntohs(sin.sin_port)) + ")");
+          Client client_info(sock, ++last_connection_id, move(name), default_format, max_frame_size);
+          client_sockets[sock] = move(client_info);
+          outbound.open(sock, last_connection_id);
+          if (CaptureWriter::instance().enabled()) {
+            CaptureWriter::instance().record(CaptureKind::OPEN, last_connection_id, (uint8_t)default_format, (uint8_t)FramingMode::U16);
+          }
+          ServerMetrics::instance().connections_accepted.inc();
+          ServerMetrics::instance().connections_open.add(1);
           cout << "new connection succes, [" << client_sockets[sock].get_client_name() << "]" << endl;
         } else {
           cerr << "getpeername() failed: " << strerror(errno) << endl;
@@ -919,56 +2097,108 @@ class ChatServer {
      * 그 형식에 맞게(JSON 또는 Protobuf) 메시지를 처리.
      */
     void process_socket(int sock) {
-      char received_buffer[65535];
-      int num_recv = recv(sock, received_buffer, sizeof(received_buffer), 0);
+      auto &client_socket = client_sockets[sock];
+      auto &reader = client_socket.get_frame_reader();
+
+      // 풀에서 빌린 청크로 바로 recv 한다
+      bool tracing = Tracer::instance().enabled();
+      if (tracing) {
+        frame_trace.recv_start_ns = metric_now_ns();
+      }
+      ssize_t num_recv = reader.read_from(sock);
+      if (tracing) {
+        frame_trace.recv_end_ns = metric_now_ns();
+      }
       if (num_recv == 0) {
         will_close_client.insert(sock);
         return;
+      } else if (num_recv < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        return;
       } else if (num_recv < 0) {
         cerr << "recv() failed: " << strerror(errno) << endl;
         will_close_client.insert(sock);
         return;
       } else {
         // cout << "Received: " << num_recv << "bytes, clientSock " << sock << endl;
+        ServerMetrics::instance().bytes_in.inc(num_recv);
       }
-      
-      auto &client_socket = client_sockets[sock];
-      auto &socket_buf = client_socket.get_socket_buffer();
-      
-      client_socket.append_socket_buffer(received_buffer, num_recv);
 
-      while (true) {
-        if (client_socket.get_current_message_len() == 0) {
-          if (socket_buf.length() < 2) {
+      // 연결 후 첫 바이트가 HANDSHAKE_MAGIC 이면 다음 바이트로 이 연결의 포맷(하위 4비트)과 프레이밍(상위 4비트)을 정한다.
+      // 협상하지 않은 연결은 프레임을 LEGACY_MAX_FRAME_SIZE 까지만 보낼 수 있으므로 첫 바이트 0xFF 는 언제나 협상이다
+      if (!client_socket.get_handshake_checked()) {
+        char handshake[2];
+        reader.peek(1, handshake);
+        if ((uint8_t)handshake[0] == HANDSHAKE_MAGIC) {
+          if (!reader.peek(2, handshake)) {
             return;
           }
 
-          uint16_t current_message_len_big_endian;
-          memcpy(&current_message_len_big_endian, socket_buf.data(), 2);
-          client_socket.set_current_message_len(ntohs(current_message_len_big_endian));
-
-          client_socket.erase_socket_buffer(0, 2);
+          int requested_format = (uint8_t)handshake[1] & 0x0F;
+          int requested_framing = (uint8_t)handshake[1] >> 4;
+          if (requested_format >= MESSAGE_FORMAT_COUNT || requested_framing >= FRAMING_MODE_COUNT) {
+            cerr << "Error: Unknown handshake: " << (int)(uint8_t)handshake[1] << endl;
+            will_close_client.insert(sock);
+            return;
+          }
+          client_socket.set_format((MessageFormat)requested_format);
+          reader.set_mode((FramingMode)requested_framing);
+          reader.skip(2);
+        } else {
+          reader.set_max_frame_size(min(max_frame_size, LEGACY_MAX_FRAME_SIZE));
         }
+        client_socket.set_handshake_checked(true);
+      }
 
-        if (socket_buf.length() < client_socket.get_current_message_len()) {
+      while (true) {
+        string_view frame;
+        FrameReader::Status status = reader.next(frame);
+        if (status == FrameReader::Status::INCOMPLETE) {
+          return;
+        } else if (status == FrameReader::Status::TOO_LARGE) {
+          cerr << "Error: Frame exceeds max frame size " << max_frame_size << ", clientSock: " << sock << endl;
+          will_close_client.insert(sock);
+          return;
+        } else if (status == FrameReader::Status::MALFORMED) {
+          cerr << "Error: Malformed length prefix, clientSock: " << sock << endl;
+          will_close_client.insert(sock);
           return;
         }
-
-        string serialized = client_socket.substr_socket_buffer(0, client_socket.get_current_message_len());
-        client_socket.erase_socket_buffer(0, client_socket.get_current_message_len());
-        client_socket.set_current_message_len(0);
+        ServerMetrics::instance().worker_frames.inc();
+        if (CaptureWriter::instance().enabled()) {
+          CaptureWriter::instance().record(CaptureKind::FRAME, client_socket.get_connection_id(), (uint8_t)client_socket.get_format(),
+                                           (uint8_t)reader.get_mode(), frame);
+        }
 
         try {
-          if (format == "json") {
-          
-            json msg = json::parse(serialized);
-            // cout << "받은 JSON serialized: " << msg.dump(2) << endl;
-            if (!msg.contains("type")) {
-              throw NoTypeFieldInMessage();
+          uint64_t parse_start = metric_now_ns();
+          if (client_socket.get_format() == MessageFormat::FLAT) {
+            // 수신 청크 안의 프레임을 복사하지 않고 그대로 읽는다. 처리가 끝난 뒤에 버퍼에서 지운다.
+            FlatMessage msg(frame);
+            if (!msg.valid()) {
+              throw MalformedFlatMessage();
+            }
+            flat_message_handlers.handle_message(sock, to_string(msg.type()), msg, metric_now_ns() - parse_start);
+
+          } else if (client_socket.get_format() == MessageFormat::JSON) {
+            // SIMD stage-1 스캔으로 평평한 객체는 바로 추출하고, 배치는 DOM 없이 안쪽 메시지로 나눈다. 나머지는 json::parse 에 맡긴다
+            json msg;
+            vector<string_view> entries;
+            bool parsed = JsonScanner::parse_flat_object(frame, msg);
+            if (!parsed && JsonScanner::split_batch(frame, entries)) {
+              json_message_handlers.handle_batch(sock, entries, metric_now_ns() - parse_start);
+            } else {
+              if (!parsed) {
+                msg = json::parse(frame.begin(), frame.end());
+              }
+              // cout << "받은 JSON serialized: " << msg.dump(2) << endl;
+              if (!msg.contains("type")) {
+                throw NoTypeFieldInMessage();
+              }
+              json_message_handlers.handle_message(sock, msg["type"], msg, metric_now_ns() - parse_start);
             }
-            json_message_handlers.handle_message(sock, msg["type"], msg);
           
           } else {
+            string serialized(frame);
             if (client_socket.get_current_protobuf_type().empty()) {
               Type *msg = new Type;
               msg->ParseFromString(serialized);
@@ -977,7 +2207,7 @@ class ChatServer {
 
               delete(msg);
             } else {
-              protobuf_message_handlers.handle_message(sock, client_socket.get_current_protobuf_type(), serialized);
+              protobuf_message_handlers.handle_message(sock, client_socket.get_current_protobuf_type(), serialized, metric_now_ns() - parse_start);
               client_socket.set_current_protobuf_type("");
             }
           } 
@@ -990,10 +2220,18 @@ class ChatServer {
         } catch (const UnknownTypeInMessage &e){
           will_close_client.insert(sock);
           cerr << "Error: " << e.what() << endl;
+        } catch (const MalformedFlatMessage &e){
+          will_close_client.insert(sock);
+          cerr << "Error: " << e.what() << endl;
+        } catch (const NestedBatchInMessage &e){
+          will_close_client.insert(sock);
+          cerr << "Error: " << e.what() << endl;
         } catch (const exception& e) {
           will_close_client.insert(sock);
           cerr << "Error: " << e.what() << endl;
         }
+
+        reader.consume();
       }
     }
 
@@ -1005,9 +2243,25 @@ class ChatServer {
      * @param num_worker 메시지를 처리할 워커 스레드의 수.
      */
     ChatServer(int port, int num_worker) 
-      : json_message_handlers(&client_sockets, &rooms), protobuf_message_handlers(&client_sockets, &rooms) {
+      : fanout(fanout_threads), outbound(max_outbound_bytes),
+        json_message_handlers(&client_sockets, &rooms, &room_listing, &names, &search_index, &fanout, &presence, &outbound),
+        protobuf_message_handlers(&client_sockets, &rooms, &room_listing, &names, &search_index, &fanout, &presence, &outbound),
+        flat_message_handlers(&client_sockets, &rooms, &room_listing, &names, &search_index, &fanout, &presence, &outbound) {
+      parse_message_format(format, default_format);
+      // 메인 쓰레드가 새 연결을 넣는 동안 워커가 같은 맵을 읽으므로 rehash 가 일어나지 않도록 select() 한도만큼 미리 잡아둔다
+      client_sockets.reserve(FD_SETSIZE);
       init_server_socket(port);
       init_worker_threads(num_worker);
+      if (Sampler::instance().enabled()) {
+        for (size_t i = 0; i < fanout.size(); ++i) {
+          fanout.post(i, [i]() {Sampler::instance().register_thread("fanout " + to_string(i));});
+        }
+      }
+      // 요약은 받는 멤버마다 그 멤버의 포맷으로 인코딩되므로 어느 포맷의 핸들러로 보내도 같다
+      presence.start([this](int room_id) {json_message_handlers.flush_presence(room_id);});
+      if (admin_port != 0) {
+        init_admin_server(admin_bind, admin_port);
+      }
     }
 
     /**
@@ -1016,6 +2270,7 @@ class ChatServer {
      * 모든 스레드를 종료하고, 클라이언트 소켓과 서버 소켓을 안전하게 닫는다.
      */
      ~ChatServer() {
+      admin.stop();
       quit.store(true);
       task_cv.notify_all();
 
@@ -1024,6 +2279,12 @@ class ChatServer {
           thread.join();
         }        
       }
+      // 소켓을 닫기 전에 fan-out 큐에 남은 전송을 끝낸다. 요약 알림도 fan-out 으로 갈 수 있으니 타이머를 먼저 멈춘다
+      presence.stop();
+      fanout.stop();
+      Tracer::instance().stop();
+      CaptureWriter::instance().stop();
+      Sampler::instance().stop();
       
       for (auto it = client_sockets.begin() ; it != client_sockets.end() ; ++it) {
         auto &client_socket = it->second;
@@ -1033,6 +2294,11 @@ class ChatServer {
       client_sockets.clear();
       rooms.clear();
 
+      RoomSearchIndex::Stats search_stats = search_index.get_stats();
+      cout << "방 검색 인덱스: 방 " << search_stats.rooms << "개, 메모리 " << search_stats.memory_bytes << " bytes, 검색 "
+           << search_stats.queries << "번, 평균 " << (search_stats.queries == 0 ? 0 : search_stats.total_query_ns / search_stats.queries / 1000)
+           << " us, 최대 " << search_stats.max_query_ns / 1000 << " us" << endl;
+
       close(server_socket);
     }
 
@@ -1043,9 +2309,29 @@ class ChatServer {
      * 새로운 연결이나 데이터를 처리.
      */
     void run() {
+      Tracer::instance().name_thread("main");
+      Sampler::instance().register_thread("main");
+      uint64_t next_latency_log = metric_now_ns() + latency_log_interval * 1000000000ULL;
       while (quit.load() == false) {
+        if (latency_log_interval > 0 && metric_now_ns() >= next_latency_log) {
+          string summary = HandlerLatency::summary(latency_log_interval);
+          if (!summary.empty()) {
+            cout << summary << endl;
+          }
+          string queue_summary = ServerMetrics::instance().queue_summary(latency_log_interval);
+          if (!queue_summary.empty()) {
+            cout << queue_summary << endl;
+          }
+          next_latency_log += latency_log_interval * 1000000000ULL;
+        }
+        if (lock_report_requested.exchange(false)) {
+          cout << lock_report();
+        }
+
         fd_set rset;
         FD_ZERO(&rset);
+        fd_set wset;
+        FD_ZERO(&wset);
 
         FD_SET(server_socket, &rset);
         int max_fd = server_socket;
@@ -1058,10 +2344,22 @@ class ChatServer {
           }
         }
 
+        // 송신 큐가 남은 소켓은 쓸 수 있게 되기를 기다린다
+        vector<int> pending_sockets = outbound.get_pending_sockets();
+        for (int sock : pending_sockets) {
+          FD_SET(sock, &wset);
+          if (sock > max_fd) {
+            max_fd = sock;
+          }
+        }
+
         struct timeval tv = {0, 1000};
-        int num_ready = select(max_fd + 1, &rset, NULL, NULL, &tv);
+        int num_ready = select(max_fd + 1, &rset, &wset, NULL, &tv);
         if (num_ready < 0) {
-          cerr << "select() failed: " << strerror(errno) << endl;
+          // SIGUSR1, SIGUSR2, SIGPROF 에 깨어난 것은 오류가 아니다
+          if (errno != EINTR) {
+            cerr << "select() failed: " << strerror(errno) << endl;
+          }
           continue;
         }
 
@@ -1069,14 +2367,22 @@ class ChatServer {
           make_new_connection();
         }
 
+        for (int sock : pending_sockets) {
+          if (FD_ISSET(sock, &wset)) {
+            outbound.flush(sock);
+          }
+        }
+
         for (auto it = client_sockets.begin() ; it != client_sockets.end() ; ++it) {
           int sock = it->first;
           if (FD_ISSET(sock, &rset)) {
             if (!client_sockets[sock].get_is_waiting()) {
               {
-                unique_lock<mutex> lock(queue_mutex);
+                ProfiledLock lock(queue_mutex);
 
-                task_queue.push(sock);
+                task_queue.push(Task {sock, metric_now_ns(), Tracer::thread_id()});
+                ServerMetrics::instance().task_queue_depth.set(task_queue.size());
+                ServerMetrics::instance().task_queue_depth_at_enqueue.observe(task_queue.size());
                 client_sockets[sock].set_is_waiting(true);
                 task_cv.notify_one();
                 // cout << "Produced: " << sock << endl;
@@ -1088,20 +2394,44 @@ class ChatServer {
         //닫을 소켓 정리
         for (int sock: will_close_client) {
           cout << "closed: " << sock << endl;
+          // 다른 쓰레드가 이 소켓에 쓰지 못하게 한 뒤에 닫는다
+          outbound.close(sock);
           close(sock);
+          if (CaptureWriter::instance().enabled() && client_sockets[sock].get_name() != nullptr) {
+            CaptureWriter::instance().record(CaptureKind::CLOSE, client_sockets[sock].get_connection_id(), 0, 0);
+          }
 
-          int entered_room_id = client_sockets[sock].get_entered_room_id();
-          if (entered_room_id != 0) {
-            rooms[entered_room_id].leave_client(sock);
-            if (rooms[entered_room_id].get_members().size() == 0) {
-              {
-                unique_lock<mutex> lock(room_mutex);
+          // 들어가 있던 방들에서 모두 나온다. 나오면서 목록이 바뀌므로 복사해 둔다
+          vector<int> joined_rooms = client_sockets[sock].get_joined_rooms();
+          for (int entered_room_id : joined_rooms) {
+            bool erased = false;
+            {
+              ProfiledLock lock(room_mutex);
+              Room *room = rooms.find(entered_room_id);
+              if (room == nullptr) {
+                continue;
+              }
+              room->leave_client_locked(sock);
+              if (room->get_members().size() == 0) {
                 cout << "방[" << entered_room_id << "] 클라이언트 연결 종료로 인해 삭제"<< endl;
                 rooms.erase(entered_room_id);
+                erased = true;
+              } else {
+                room_listing.update_locked(*room);
               }
             }
+            if (erased) {
+              room_listing.remove(entered_room_id);
+              search_index.remove(entered_room_id);
+            }
           }
 
+          // 이미 닫힌 소켓을 작업 쓰레드가 is_waiting 을 되돌리며 기본값으로 다시 만든 항목은 세지 않는다
+          if (client_sockets[sock].get_name() != nullptr) {
+            ServerMetrics::instance().connections_closed.inc();
+            ServerMetrics::instance().connections_open.add(-1);
+          }
+          names.unbind(sock, client_sockets[sock].get_name());
           client_sockets.erase(sock);
         }
         will_close_client.clear();
@@ -1109,6 +2439,8 @@ class ChatServer {
     }
 };
 
+// micro_bench 는 이 파일을 CHAT_SERVER_NO_MAIN 을 정의하고 포함해 서버 코드를 그대로 잰다
+#ifndef CHAT_SERVER_NO_MAIN
 /**
  * @brief 프로그램의 진입점.
  * 
@@ -1128,20 +2460,101 @@ int main(int argc, char* argv[]) {
              << "flags:" << endl
              << endl
              << "chat_server.cpp:" <<endl
-             << "  --formet: <json|protobuf>: 메시지 포멧" << endl
+             << "  --formet: <json|protobuf|flat>: 메시지 포멧" << endl
              << "    (default: 'json')" << endl
              << "  --workers: 작업 쓰레드 숫자" << endl
              << "    (default: '2')" << endl
-             << "    (an integer)" << endl;
+             << "    (an integer)" << endl
+             << "  --max-frame-size: 받을 수 있는 가장 큰 프레임의 바이트 수" << endl
+             << "    (default: '16777216')" << endl
+             << "    (an integer)" << endl
+             << "  --fanout-threads: 큰 방의 브로드캐스트를 나눠 보낼 쓰레드 숫자, 0 이면 쓰지 않음" << endl
+             << "    (default: '2')" << endl
+             << "    (an integer)" << endl
+             << "  --fanout-threshold: 브로드캐스트를 fan-out 쓰레드로 넘기기 시작하는 방 멤버 수" << endl
+             << "    (default: '1024')" << endl
+             << "    (an integer)" << endl
+             << "  --max-outbound-bytes: 클라이언트 하나에게 보내지 못하고 쌓아 둘 수 있는 바이트 수, 넘으면 연결을 끊음" << endl
+             << "    (default: '16777216')" << endl
+             << "    (an integer)" << endl
+             << "  --admin-port: Prometheus 지표를 /metrics 로 내주는 관리용 HTTP 포트, 0 이면 열지 않음" << endl
+             << "    (default: '0')" << endl
+             << "    (an integer)" << endl
+             << "  --admin-bind: 관리용 HTTP 서버가 바인드할 IPv4 주소, 인증이 없으므로 외부에 열 때는 주의" << endl
+             << "    (default: '127.0.0.1')" << endl
+             << "  --latency-log-interval: 메시지 타입별 처리 시간 요약을 로그에 남기는 주기 (초), 0 이면 남기지 않음" << endl
+             << "    (default: '60')" << endl
+             << "    (an integer)" << endl
+             << "  --trace-file: 뽑힌 메시지의 단계별 span 을 쓸 Chrome trace-event JSON 파일, 비어 있으면 추적하지 않음" << endl
+             << "    (default: '')" << endl
+             << "  --trace-sample: 메시지 몇 개에 하나를 추적할지" << endl
+             << "    (default: '100')" << endl
+             << "    (an integer)" << endl
+             << "  --trace-rotate-bytes: 추적 파일을 회전하는 크기, 0 이면 회전하지 않음" << endl
+             << "    (default: '67108864')" << endl
+             << "    (an integer)" << endl
+             << "  --lock-profile: room_mutex 와 queue_mutex 의 경합과 잡은 시간을 기록, /locks 나 SIGUSR1 로 볼 수 있음" << endl
+             << "    (default: '0')" << endl
+             << "    (an integer)" << endl
+             << "  --capture-file: 받은 프레임을 모두 연결 번호, 시각, 포맷과 함께 남길 캡처 파일, chat_replay 로 재생" << endl
+             << "    (default: '')" << endl
+             << "  --capture-buffer-bytes: 캡처할 때 쓰레드마다 두는 링 버퍼 크기, 차면 레코드를 버림" << endl
+             << "    (default: '8388608')" << endl
+             << "    (an integer)" << endl
+             << "  --profile-hz: 메인, 워커, fan-out 쓰레드의 스택을 CPU 시간 1초에 몇 번 뜰지, 0 이면 샘플링하지 않음" << endl
+             << "    (default: '0')" << endl
+             << "    (an integer)" << endl
+             << "  --profile-window: /profile 과 SIGUSR2 로 낼 최근 샘플의 기간 (초)" << endl
+             << "    (default: '60')" << endl
+             << "    (an integer)" << endl
+             << "  --profile-file: SIGUSR2 를 받으면 folded stack 을 쓸 파일" << endl
+             << "    (default: 'chat_server.folded')" << endl;
         return 0;
       } else if (arg.rfind("--format=", 0) == 0) { // "--format="으로 시작하는지 확인
         format = arg.substr(9);
 
-        if (format != "json" && format != "protobuf") { 
+        if (format != "json" && format != "protobuf" && format != "flat") { 
           throw invalid_argument(format);
         }
       } else if (arg.rfind("--workers=", 0) == 0) { // "--worker="으로 시작하는지 확인    
         num_worker = stoi(arg.substr(10));
+      } else if (arg.rfind("--max-frame-size=", 0) == 0) { // "--max-frame-size="으로 시작하는지 확인
+        max_frame_size = stoull(arg.substr(17));
+      } else if (arg.rfind("--fanout-threads=", 0) == 0) { // "--fanout-threads="으로 시작하는지 확인
+        fanout_threads = stoull(arg.substr(17));
+      } else if (arg.rfind("--fanout-threshold=", 0) == 0) { // "--fanout-threshold="으로 시작하는지 확인
+        fanout_threshold = stoull(arg.substr(19));
+      } else if (arg.rfind("--max-outbound-bytes=", 0) == 0) { // "--max-outbound-bytes="으로 시작하는지 확인
+        max_outbound_bytes = stoull(arg.substr(21));
+      } else if (arg.rfind("--admin-port=", 0) == 0) { // "--admin-port="으로 시작하는지 확인
+        admin_port = stoi(arg.substr(13));
+      } else if (arg.rfind("--admin-bind=", 0) == 0) { // "--admin-bind="으로 시작하는지 확인
+        admin_bind = arg.substr(13);
+
+        in_addr addr;
+        if (inet_pton(AF_INET, admin_bind.c_str(), &addr) != 1) {
+          throw invalid_argument(admin_bind);
+        }
+      } else if (arg.rfind("--latency-log-interval=", 0) == 0) { // "--latency-log-interval="으로 시작하는지 확인
+        latency_log_interval = stoi(arg.substr(23));
+      } else if (arg.rfind("--trace-file=", 0) == 0) { // "--trace-file="으로 시작하는지 확인
+        trace_file = arg.substr(13);
+      } else if (arg.rfind("--trace-sample=", 0) == 0) { // "--trace-sample="으로 시작하는지 확인
+        trace_sample = stoull(arg.substr(15));
+      } else if (arg.rfind("--trace-rotate-bytes=", 0) == 0) { // "--trace-rotate-bytes="으로 시작하는지 확인
+        trace_rotate_bytes = stoull(arg.substr(21));
+      } else if (arg.rfind("--lock-profile=", 0) == 0) { // "--lock-profile="으로 시작하는지 확인
+        lock_profile = stoi(arg.substr(15)) != 0;
+      } else if (arg.rfind("--capture-file=", 0) == 0) { // "--capture-file="으로 시작하는지 확인
+        capture_file = arg.substr(15);
+      } else if (arg.rfind("--capture-buffer-bytes=", 0) == 0) { // "--capture-buffer-bytes="으로 시작하는지 확인
+        capture_buffer_bytes = stoull(arg.substr(23));
+      } else if (arg.rfind("--profile-hz=", 0) == 0) { // "--profile-hz="으로 시작하는지 확인
+        profile_hz = stoi(arg.substr(13));
+      } else if (arg.rfind("--profile-window=", 0) == 0) { // "--profile-window="으로 시작하는지 확인
+        profile_window = stoi(arg.substr(17));
+      } else if (arg.rfind("--profile-file=", 0) == 0) { // "--profile-file="으로 시작하는지 확인
+        profile_file = arg.substr(15);
       } else {
         throw invalid_argument(format);
       }
@@ -1152,8 +2565,27 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
+  if (lock_profile) {
+    ProfiledMutex::set_enabled(true);
+    signal(SIGUSR1, [](int) {lock_report_requested.store(true);});
+  }
+  if (!trace_file.empty() && !Tracer::instance().start(trace_file, trace_sample, trace_rotate_bytes)) {
+    return 1;
+  }
+  if (!capture_file.empty() && !CaptureWriter::instance().start(capture_file, capture_buffer_bytes)) {
+    return 1;
+  }
+  if (profile_hz > 0) {
+    Sampler::instance().set_dump_path(profile_file);
+    if (!Sampler::instance().start(profile_hz, profile_window)) {
+      return 1;
+    }
+    signal(SIGUSR2, [](int) {Sampler::instance().request_dump();});
+  }
+
   ChatServer server(PORT, num_worker);
   server.run();
 
   return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -0,0 +1,137 @@
+/**
+ * @file fanout.h
+ * @brief 큰 방의 브로드캐스트를 여러 쓰레드로 나눠 보내는 fan-out 풀
+ *
+ * 멤버가 아주 많은 방에서 한 워커가 멤버 전체에 차례로 sendmsg 하면 채팅 한 줄에 코어 하나가
+ * 수 ms 씩 묶인다. 풀은 샤드마다 쓰레드 하나와 FIFO 작업 큐를 두고, 브로드캐스트는 공유 프레임과
+ * 샤드의 멤버 스냅샷을 샤드마다 하나씩 넘긴 뒤 바로 돌아간다. 샤드들은 병렬로 각자의 멤버에게 보낸다.
+ *
+ * 한 샤드의 작업은 넘겨받은 순서대로 한 쓰레드에서만 실행된다. 멤버가 늘 같은 샤드에 속하면
+ * 한 송신자가 차례로 넘긴 메시지는 받는 쪽에 같은 순서로 도착한다.
+ */
+
+#ifndef CHAT_SERVER_FANOUT_H
+#define CHAT_SERVER_FANOUT_H
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 샤드마다 쓰레드 하나와 FIFO 큐를 가진 작업 풀
+ */
+class FanoutPool {
+  public:
+    using Task = std::function<void()>;
+
+  private:
+    /**
+     * @brief 샤드 하나의 작업 큐와 그 큐를 비우는 쓰레드
+     */
+    struct Shard {
+      std::mutex mutex;
+      std::condition_variable cv;
+      std::deque<Task> tasks;
+      bool stopping = false;
+      std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards;
+
+    static void run(Shard &shard) {
+      while (true) {
+        Task task;
+        {
+          std::unique_lock<std::mutex> lock(shard.mutex);
+          shard.cv.wait(lock, [&shard]() {return shard.stopping || !shard.tasks.empty();});
+          // 멈추라는 요청을 받아도 이미 넘겨받은 작업은 모두 끝낸다
+          if (shard.tasks.empty()) {
+            return;
+          }
+          task = std::move(shard.tasks.front());
+          shard.tasks.pop_front();
+        }
+        // 작업 하나의 예외가 쓰레드를 끝내면 서버 전체가 종료되므로 기록만 하고 다음 작업으로 넘어간다
+        try {
+          task();
+        } catch (const std::exception &e) {
+          std::cerr << "Error: fan-out task failed: " << e.what() << std::endl;
+        }
+      }
+    }
+
+  public:
+    /**
+     * @brief 샤드 수만큼 쓰레드를 띄운다.
+     *
+     * @param num_shards 샤드(쓰레드) 수, 0 이면 풀을 쓰지 않는다
+     */
+    explicit FanoutPool(size_t num_shards) {
+      for (size_t i = 0; i < num_shards; ++i) {
+        shards.emplace_back(new Shard());
+      }
+      for (auto &shard : shards) {
+        Shard *target = shard.get();
+        shard->thread = std::thread([target]() {run(*target);});
+      }
+    }
+
+    FanoutPool(const FanoutPool &) = delete;
+    FanoutPool &operator=(const FanoutPool &) = delete;
+
+    ~FanoutPool() {
+      stop();
+    }
+
+    /**
+     * @brief 샤드의 큐 끝에 작업을 넣는다.
+     *
+     * @param shard 샤드 번호, size() 보다 작아야 한다
+     * @param task 실행할 작업
+     */
+    void post(size_t shard, Task task) {
+      Shard &target = *shards[shard];
+      {
+        std::unique_lock<std::mutex> lock(target.mutex);
+        target.tasks.push_back(std::move(task));
+      }
+      target.cv.notify_one();
+    }
+
+    /**
+     * @brief 남은 작업을 모두 끝내고 쓰레드를 멈춘다. 여러 번 불러도 된다.
+     */
+    void stop() {
+      for (auto &shard : shards) {
+        {
+          std::unique_lock<std::mutex> lock(shard->mutex);
+          shard->stopping = true;
+        }
+        shard->cv.notify_one();
+      }
+      for (auto &shard : shards) {
+        if (shard->thread.joinable()) {
+          shard->thread.join();
+        }
+      }
+    }
+
+    /**
+     * @brief 소켓이 속한 샤드. 같은 소켓은 늘 같은 샤드에 속한다.
+     */
+    size_t shard_of(int sock) const {
+      return static_cast<size_t>(sock) % shards.size();
+    }
+
+    //getter
+    size_t size() const {return shards.size();}
+};
+
+#endif
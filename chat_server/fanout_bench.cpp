@@ -0,0 +1,549 @@
+/**
+ * @file fanout_bench.cpp
+ * @brief 방 크기와 느린 수신자 비율에 따른 broadcast() 의 전달 지연과 송신 처리량을 재는 시나리오 벤치마크
+ *
+ * chat_server.cpp 를 main 없이 포함해 서버의 MessageHandlers 를 그대로 쓴다. 방 하나에 멤버를 넣고,
+ * 멤버마다 socketpair 의 한쪽을 소켓으로 준 뒤 반대편을 벤치마크가 읽는다. 송신자 하나가 CSChat 을 계속 보내고,
+ * 일부 멤버(probe) 가 받은 시각으로 전달 지연을 잰다. 송신자는 가장 늦은 probe 보다 window 개 이상 앞서 보내지 않는다.
+ *
+ * 수신자 종류
+ * - fast: 바로바로 읽는다. 지연을 재는 probe 몇 명 외에는 fd 를 아끼려고 멤버 64명이 socketpair 하나를 dup 해서 나눠 쓴다.
+ * - slow: 초당 --slow-rate 바이트만 읽는다.
+ * - stuck: 전혀 읽지 않는다.
+ *
+ * 서버의 메인 루프 대신 쓰레드 하나가 송신 큐가 남은 소켓을 poll 해서 보낸다.
+ * 송신자가 handle_message 안에서, 또는 probe 로의 전달이 --stall-ms 넘게 멈추면 그 시나리오를 STALLED 로 보고하고 1 로 끝난다.
+ * 전송이 소켓 버퍼에서 막히던 때에는 stuck 멤버 하나가 송신자를 room_mutex 를 잡은 채로 세웠다.
+ *
+ * 예) ./fanout_bench --sizes=2,1024,16384 --slow-fraction=0.01 --stuck-fraction=0.001
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 서버의 핸들러와 방을 그대로 쓰기 위해 main 을 빼고 포함한다
+#define CHAT_SERVER_NO_MAIN
+#include "chat_server.cpp"
+
+using namespace std;
+
+vector<size_t> sizes = {2, 16, 256, 1024, 4096, 16384, 50000}; ///< 잴 방 크기들 (송신자 포함)
+double slow_fraction = 0.01; ///< slow 시나리오에서 느리게 읽는 멤버의 비율
+double stuck_fraction = 0.01; ///< stuck 시나리오에서 읽지 않는 멤버의 비율
+size_t slow_rate = 32 * 1024; ///< 느린 멤버 하나가 초당 읽는 바이트 수
+string member_format = "json"; ///< 송신자와 멤버의 포맷, json 또는 protobuf
+size_t message_size = 64; ///< 채팅 내용 바이트 수
+double duration = 2; ///< 시나리오마다 보내는 시간 (초)
+size_t window = 8; ///< 송신자가 가장 늦은 probe 보다 앞설 수 있는 메시지 수
+uint64_t stall_ms = 2000; ///< 진행이 이만큼 멈추면 STALLED
+
+static const size_t MAX_PROBES = 16; ///< 지연을 재는 fast 멤버 수
+static const size_t SINK_MEMBERS = 64; ///< socketpair 하나를 나눠 쓰는 fast 멤버 수
+static const size_t MAX_MESSAGES = 1 << 21; ///< 시나리오 하나에서 보낼 수 있는 최대 메시지 수
+static const uint64_t MS = 1000000;
+
+/**
+ * @brief 수신자 종류
+ */
+enum class Role {
+  SINK,  ///< fast, socketpair 를 나눠 쓴다
+  PROBE, ///< fast, 지연을 잰다
+  SLOW,
+  STUCK,
+};
+
+/**
+ * @brief 벤치마크가 읽는 쪽의 소켓 하나
+ */
+struct Reader {
+  int fd;
+  Role role;
+  uint64_t bytes = 0; ///< 읽은 바이트 수
+  atomic<uint64_t> messages {0}; ///< probe 가 끝까지 받은 메시지 수
+
+  Reader(int fd, Role role) : fd(fd), role(role) {}
+};
+
+/**
+ * @brief 시나리오 하나의 결과
+ */
+struct ScenarioResult {
+  uint64_t sent = 0;
+  double seconds = 0;
+  vector<uint64_t> send_ns; ///< 메시지마다 handle_message 에 걸린 시간
+  vector<uint64_t> delivery_ns; ///< probe 가 받은 메시지마다 보낸 시각부터 받은 시각까지
+  uint64_t probe_messages = 0; ///< 가장 늦은 probe 가 받은 메시지 수
+  uint64_t slow_consumers = 0; ///< 송신 큐가 한도를 넘어 끊긴 멤버 수
+  size_t peak_pending_bytes = 0; ///< 송신 큐에 쌓인 바이트 수의 최대
+  string stalled; ///< 멈췄으면 그 이유
+};
+
+static vector<atomic<uint64_t>> sent_at(MAX_MESSAGES); ///< 메시지 순번마다 보낸 시각
+
+/**
+ * @brief 출력을 버리는 동안 스트림을 막는다. 방 생성 로그와 정리 중의 전송 실패 로그가 결과를 덮지 않게 한다.
+ */
+class QuietStream {
+  private:
+    ostream &stream;
+    streambuf *saved;
+
+  public:
+    explicit QuietStream(ostream &stream) : stream(stream), saved(stream.rdbuf(nullptr)) {}
+    ~QuietStream() {
+      stream.rdbuf(saved);
+    }
+};
+
+static void set_nonblocking(int fd) {
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+/**
+ * @brief 순번이 seq 인 채팅 내용. 길이가 순번과 상관없이 같아서 메시지마다 인코딩 길이가 같다.
+ */
+static string make_text(uint64_t seq) {
+  char head[24];
+  snprintf(head, sizeof(head), "%010llu|", static_cast<unsigned long long>(seq));
+  string text = head;
+  text.resize(max(message_size, text.size()), 'x');
+  return text;
+}
+
+/**
+ * @brief 멤버 하나가 받는 채팅 메시지 하나의 바이트 수 (길이 prefix 포함)
+ */
+static size_t message_bytes(const NamePtr &sender, int room_id, MessageFormat format) {
+  ServerMessagePtr message = ServerMessage::chat(sender, make_text(0), room_id);
+  const EncodedFrame &frame = message->encode(format);
+  size_t bytes = 0;
+  char prefix[MAX_LENGTH_PREFIX];
+  for (size_t i = 0; i < frame.frames.size(); ++i) {
+    bytes += encode_length_prefix(FramingMode::U16, frame.frame_size(i), prefix) + frame.frame_size(i);
+  }
+  return bytes;
+}
+
+/**
+ * @brief 멤버 count 명 중 n 명을 고르게 흩어 role 로 정한다. 이미 정해진 자리는 건너뛴다.
+ */
+static void spread(vector<Role> &roles, size_t n, Role role, double offset) {
+  for (size_t k = 0; k < n; ++k) {
+    size_t at = static_cast<size_t>((k + offset) * roles.size() / n) % roles.size();
+    while (roles[at] != Role::SINK) {
+      at = (at + 1) % roles.size();
+    }
+    roles[at] = role;
+  }
+}
+
+/**
+ * @brief 정렬된 표본의 q 분위수
+ */
+static double quantile(const vector<uint64_t> &sorted, double q) {
+  if (sorted.empty()) {
+    return 0;
+  }
+  return sorted[min(sorted.size() - 1, static_cast<size_t>(q * sorted.size()))];
+}
+
+/**
+ * @brief 방 하나에 members 명을 넣고 duration 동안 채팅을 보낸다.
+ *
+ * @param members 송신자를 포함한 방 크기
+ * @param slow 느린 멤버 수
+ * @param stuck 읽지 않는 멤버 수
+ * @param result 결과가 담긴다
+ */
+static void run_scenario(size_t members, size_t slow, size_t stuck, ScenarioResult &result) {
+  MessageFormat format = member_format == "json" ? MessageFormat::JSON : MessageFormat::PROTOBUF;
+  size_t others = members - 1;
+  vector<Role> roles(others, Role::SINK);
+  spread(roles, stuck, Role::STUCK, 0.5);
+  spread(roles, slow, Role::SLOW, 0.25);
+  spread(roles, min(MAX_PROBES, others - stuck - slow), Role::PROBE, 0.75);
+
+  // 멤버의 소켓 (서버 쪽) 과 벤치마크가 읽는 쪽
+  vector<unique_ptr<Reader>> readers;
+  vector<int> member_socks;
+  vector<int> owned_socks;
+  auto make_pair = [&](Role role) {
+    int pair[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, pair) < 0) {
+      cerr << "socketpair() failed: " << strerror(errno) << endl;
+      exit(1);
+    }
+    set_nonblocking(pair[1]);
+    readers.emplace_back(new Reader(pair[1], role));
+    owned_socks.push_back(pair[0]);
+    return pair[0];
+  };
+  int sender = make_pair(Role::PROBE);
+  Reader &echo = *readers.back();
+  int sink = -1;
+  size_t sink_members = 0;
+  for (Role role : roles) {
+    if (role != Role::SINK) {
+      member_socks.push_back(make_pair(role));
+      continue;
+    }
+    if (sink < 0 || sink_members == SINK_MEMBERS) {
+      sink = make_pair(Role::SINK);
+      sink_members = 0;
+      member_socks.push_back(sink);
+    } else {
+      member_socks.push_back(dup(sink));
+      owned_socks.push_back(member_socks.back());
+    }
+    ++sink_members;
+  }
+
+  ClientMap clients;
+  clients.reserve(members);
+  RoomMap rooms;
+  RoomListing listing;
+  NameTable names;
+  RoomSearchIndex search_index;
+  FanoutPool fanout(fanout_threads);
+  PresenceScheduler presence;
+  OutboundQueues outbound(max_outbound_bytes);
+  MessageHandlers<json> json_handlers(&clients, &rooms, &listing, &names, &search_index, &fanout, &presence, &outbound);
+  MessageHandlers<string> protobuf_handlers(&clients, &rooms, &listing, &names, &search_index, &fanout, &presence, &outbound);
+
+  // 입장 알림 없이 방을 바로 채운다
+  int room_id = rooms.allocate_key();
+  {
+    QuietStream quiet(cout);
+    Room *room = &rooms.get(rooms.emplace(room_id, room_id, "fanout"));
+    clients[sender] = Client(sender, sender, names.bind(sender, "sender"), format, max_frame_size);
+    outbound.open(sender, sender);
+    room->join_client(sender, &clients[sender], room_id);
+    for (size_t i = 0; i < member_socks.size(); ++i) {
+      int sock = member_socks[i];
+      clients[sock] = Client(sock, sock, names.bind(sock, "member" + to_string(i)), format, max_frame_size);
+      outbound.open(sock, sock);
+      room->join_client(sock, &clients[sock], room_id);
+    }
+  }
+  const size_t chat_bytes = message_bytes(clients[sender].get_name(), room_id, format);
+
+  vector<Reader *> probes;
+  for (auto &reader : readers) {
+    if (reader->role == Role::PROBE && reader.get() != &echo) {
+      probes.push_back(reader.get());
+    }
+  }
+  auto probe_messages = [&probes]() {
+    uint64_t least = UINT64_MAX;
+    for (Reader *probe : probes) {
+      least = min(least, probe->messages.load(memory_order_acquire));
+    }
+    return least;
+  };
+
+  atomic<bool> stop_readers(false);
+  atomic<bool> stop_sender(false);
+  atomic<uint64_t> sent(0);
+  atomic<uint64_t> in_send_since(0); ///< 송신자가 handle_message 에 들어간 시각, 밖이면 0
+
+  // fast 멤버와 probe 를 읽는 쓰레드
+  thread fast_reader([&]() {
+    int epfd = epoll_create1(0);
+    for (auto &reader : readers) {
+      if (reader->role == Role::SINK || reader->role == Role::PROBE) {
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.ptr = reader.get();
+        epoll_ctl(epfd, EPOLL_CTL_ADD, reader->fd, &event);
+      }
+    }
+    vector<epoll_event> events(256);
+    char buffer[65536];
+    while (!stop_readers.load()) {
+      int n = epoll_wait(epfd, events.data(), events.size(), 10);
+      for (int i = 0; i < n; ++i) {
+        Reader *reader = static_cast<Reader *>(events[i].data.ptr);
+        ssize_t got;
+        while ((got = read(reader->fd, buffer, sizeof(buffer))) > 0) {
+          reader->bytes += got;
+        }
+        if (reader->role != Role::PROBE || reader == &echo) {
+          continue;
+        }
+        uint64_t now = metric_now_ns();
+        uint64_t done = reader->messages.load(memory_order_relaxed);
+        while ((done + 1) * chat_bytes <= reader->bytes) {
+          result.delivery_ns.push_back(now - sent_at[done].load(memory_order_acquire));
+          ++done;
+        }
+        reader->messages.store(done, memory_order_release);
+      }
+    }
+    close(epfd);
+  });
+
+  // 느린 멤버를 10ms 마다 조금씩 읽는 쓰레드
+  thread slow_reader([&]() {
+    char buffer[65536];
+    size_t budget = max<size_t>(1, slow_rate / 100);
+    while (!stop_readers.load()) {
+      this_thread::sleep_for(chrono::milliseconds(10));
+      for (auto &reader : readers) {
+        if (reader->role == Role::SLOW) {
+          ssize_t got = read(reader->fd, buffer, min(budget, sizeof(buffer)));
+          if (got > 0) {
+            reader->bytes += got;
+          }
+        }
+      }
+    }
+  });
+
+  // 서버의 메인 루프처럼 송신 큐가 남은 소켓에 쓸 수 있게 되면 보낸다
+  thread flusher([&]() {
+    QuietStream quiet(cerr);
+    vector<pollfd> fds;
+    while (!stop_readers.load()) {
+      fds.clear();
+      for (int sock : outbound.get_pending_sockets()) {
+        fds.push_back({sock, POLLOUT, 0});
+      }
+      if (fds.empty()) {
+        this_thread::sleep_for(chrono::milliseconds(1));
+        continue;
+      }
+      if (poll(fds.data(), fds.size(), 1) > 0) {
+        for (auto &fd : fds) {
+          if (fd.revents != 0) {
+            outbound.flush(fd.fd);
+          }
+        }
+      }
+    }
+  });
+
+  string json_type = "CSChat";
+  string protobuf_type = to_string(Type_MessageType_CS_CHAT);
+  result.send_ns.reserve(1 << 16);
+  thread sender_thread([&]() {
+    for (uint64_t seq = 0; seq < MAX_MESSAGES && !stop_sender.load(); ++seq) {
+      // 가장 늦은 probe 가 따라올 때까지 기다린다
+      while (!probes.empty() && probe_messages() + window <= seq && !stop_sender.load()) {
+        this_thread::yield();
+      }
+      if (stop_sender.load()) {
+        break;
+      }
+      string text = make_text(seq);
+      uint64_t start = metric_now_ns();
+      sent_at[seq].store(start, memory_order_release);
+      in_send_since.store(start);
+      if (format == MessageFormat::JSON) {
+        json_handlers.handle_message(sender, json_type, json {{"type", json_type}, {"text", text}});
+      } else {
+        CSChat chat;
+        chat.set_text(text);
+        protobuf_handlers.handle_message(sender, protobuf_type, chat.SerializeAsString());
+      }
+      in_send_since.store(0);
+      result.send_ns.push_back(metric_now_ns() - start);
+      sent.store(seq + 1);
+    }
+  });
+
+  // 시간이 다 되거나 진행이 멈출 때까지 지켜본다
+  uint64_t start = metric_now_ns();
+  uint64_t end = start + static_cast<uint64_t>(duration * 1e9);
+  uint64_t last_progress = start;
+  uint64_t last_delivered = 0;
+  uint64_t now = start;
+  while ((now = metric_now_ns()) < end) {
+    this_thread::sleep_for(chrono::milliseconds(20));
+    result.peak_pending_bytes = max(result.peak_pending_bytes, outbound.get_stats().pending_bytes);
+    uint64_t since = in_send_since.load();
+    if (since != 0 && now > since + stall_ms * MS) {
+      result.stalled = "sender blocked in handle_message for " + to_string((now - since) / MS) + " ms";
+      break;
+    }
+    if (!probes.empty()) {
+      uint64_t delivered = probe_messages();
+      if (delivered != last_delivered || delivered >= sent.load()) {
+        last_delivered = delivered;
+        last_progress = now;
+      } else if (now > last_progress + stall_ms * MS) {
+        result.stalled = "no delivery to probes for " + to_string((now - last_progress) / MS) + " ms";
+        break;
+      }
+    }
+  }
+  result.seconds = (now - start) / 1e9;
+  result.sent = sent.load();
+
+  // 막혀 있는 전송은 읽지 않는 쪽을 닫아 풀어준다. 그 뒤의 전송 실패 로그는 버린다
+  {
+    QuietStream quiet(cerr);
+    stop_sender.store(true);
+    for (auto &reader : readers) {
+      if (reader->role == Role::SLOW || reader->role == Role::STUCK) {
+        shutdown(reader->fd, SHUT_RDWR);
+      }
+    }
+    sender_thread.join();
+    fanout.stop();
+  }
+  result.slow_consumers = outbound.get_stats().slow_consumers;
+  stop_readers.store(true);
+  fast_reader.join();
+  slow_reader.join();
+  flusher.join();
+  result.probe_messages = probes.empty() ? 0 : probe_messages();
+
+  for (int sock : owned_socks) {
+    close(sock);
+  }
+  for (auto &reader : readers) {
+    close(reader->fd);
+  }
+}
+
+/**
+ * @brief 결과 한 줄
+ */
+static void print_result(size_t members, const string &label, ScenarioResult &result) {
+  sort(result.send_ns.begin(), result.send_ns.end());
+  sort(result.delivery_ns.begin(), result.delivery_ns.end());
+  cout << right << setw(7) << members << "  " << left << setw(16) << label << right << setw(9) << result.sent
+       << setw(11) << fixed << setprecision(1) << result.sent / result.seconds
+       << setw(9) << setprecision(0) << quantile(result.send_ns, 0.5) / 1e3 << " /" << setw(7) << quantile(result.send_ns, 0.99) / 1e3;
+  if (result.delivery_ns.empty()) {
+    cout << setw(30) << "-";
+  } else {
+    cout << setw(10) << setprecision(2) << quantile(result.delivery_ns, 0.5) / 1e6 << " /" << setw(8) << quantile(result.delivery_ns, 0.99) / 1e6
+         << " /" << setw(8) << result.delivery_ns.back() / 1e6;
+  }
+  cout << setw(10) << setprecision(1) << result.peak_pending_bytes / 1024.0 << setw(6) << result.slow_consumers
+       << "  " << (result.stalled.empty() ? "ok" : "STALLED: " + result.stalled) << endl;
+}
+
+int main(int argc, char *argv[]) {
+  try {
+    for (int i = 1; i < argc; ++i) {
+      string arg = argv[i];
+      if (arg == "--help") {
+        cout << "USAGE: " << argv[0] << " [flags]" << endl
+             << "  --sizes: 쉼표로 나눈 방 크기들, 송신자 포함 (default: 2,16,256,1024,4096,16384,50000)" << endl
+             << "  --slow-fraction: slow 시나리오의 느린 멤버 비율 (default: 0.01)" << endl
+             << "  --stuck-fraction: stuck 시나리오의 읽지 않는 멤버 비율 (default: 0.01)" << endl
+             << "  --slow-rate: 느린 멤버가 초당 읽는 바이트 수 (default: 32768)" << endl
+             << "  --format: <json|protobuf> 멤버 포맷 (default: json)" << endl
+             << "  --message-size: 채팅 내용 바이트 수 (default: 64)" << endl
+             << "  --duration: 시나리오마다 보내는 시간, 초 (default: 2)" << endl
+             << "  --window: 가장 늦은 probe 보다 앞서 보낼 수 있는 메시지 수 (default: 8)" << endl
+             << "  --stall-ms: 진행이 이만큼 멈추면 STALLED (default: 2000)" << endl
+             << "  --fanout-threads, --fanout-threshold, --max-outbound-bytes: chat_server 와 같다 (default: 2, 1024, 16777216)" << endl;
+        return 0;
+      } else if (arg.rfind("--sizes=", 0) == 0) {
+        sizes.clear();
+        stringstream list(arg.substr(8));
+        string size;
+        while (getline(list, size, ',')) {
+          sizes.push_back(stoull(size));
+          if (sizes.back() < 2) {
+            throw invalid_argument(arg);
+          }
+        }
+      } else if (arg.rfind("--slow-fraction=", 0) == 0) {
+        slow_fraction = stod(arg.substr(16));
+      } else if (arg.rfind("--stuck-fraction=", 0) == 0) {
+        stuck_fraction = stod(arg.substr(17));
+      } else if (arg.rfind("--slow-rate=", 0) == 0) {
+        slow_rate = stoull(arg.substr(12));
+      } else if (arg.rfind("--format=", 0) == 0) {
+        member_format = arg.substr(9);
+        if (member_format != "json" && member_format != "protobuf") {
+          throw invalid_argument(arg);
+        }
+      } else if (arg.rfind("--message-size=", 0) == 0) {
+        message_size = stoull(arg.substr(15));
+      } else if (arg.rfind("--duration=", 0) == 0) {
+        duration = stod(arg.substr(11));
+      } else if (arg.rfind("--window=", 0) == 0) {
+        window = max<size_t>(1, stoull(arg.substr(9)));
+      } else if (arg.rfind("--stall-ms=", 0) == 0) {
+        stall_ms = stoull(arg.substr(11));
+      } else if (arg.rfind("--fanout-threads=", 0) == 0) {
+        fanout_threads = stoull(arg.substr(17));
+      } else if (arg.rfind("--fanout-threshold=", 0) == 0) {
+        fanout_threshold = stoull(arg.substr(19));
+      } else if (arg.rfind("--max-outbound-bytes=", 0) == 0) {
+        max_outbound_bytes = stoull(arg.substr(21));
+      } else {
+        throw invalid_argument(arg);
+      }
+    }
+    if (slow_fraction < 0 || stuck_fraction < 0 || slow_fraction + stuck_fraction >= 1) {
+      throw invalid_argument("0 <= slow-fraction + stuck-fraction < 1");
+    }
+  } catch (const exception &e) {
+    cerr << "Error: " << e.what() << endl;
+    return 1;
+  }
+
+  // 닫힌 멤버에게 보내다 죽지 않도록
+  signal(SIGPIPE, SIG_IGN);
+  // 멤버마다 fd 가 하나 이상 필요하다
+  rlimit limit;
+  getrlimit(RLIMIT_NOFILE, &limit);
+  limit.rlim_cur = limit.rlim_max;
+  setrlimit(RLIMIT_NOFILE, &limit);
+
+  cout << "fanout_bench: " << member_format << ", " << message_size << "-byte chats, window " << window << ", slow readers "
+       << slow_rate << " B/s, fanout " << fanout_threads << " threads from " << fanout_threshold << " members, outbound limit "
+       << max_outbound_bytes << " bytes" << endl;
+  cout << "members  readers              sent      msg/s   send p50/p99 us   delivery p50/p99/max ms  queue KB  cut  result" << endl;
+
+  int stalled = 0;
+  for (size_t members : sizes) {
+    size_t others = members - 1;
+    auto count_of = [others](double fraction) {
+      return fraction <= 0 ? 0 : max<size_t>(1, static_cast<size_t>(llround(others * fraction)));
+    };
+    vector<pair<string, pair<size_t, size_t>>> scenarios = {{"fast", {0, 0}}};
+    if (count_of(slow_fraction) > 0) {
+      scenarios.push_back({to_string(count_of(slow_fraction)) + " slow", {min(others, count_of(slow_fraction)), 0}});
+    }
+    if (count_of(stuck_fraction) > 0) {
+      scenarios.push_back({to_string(count_of(stuck_fraction)) + " stuck", {0, min(others, count_of(stuck_fraction))}});
+    }
+
+    // fast 멤버는 SINK_MEMBERS 명이 fd 하나를 더 쓰고, 나머지는 멤버마다 socketpair 하나
+    size_t fds = members + 2 * (MAX_PROBES + others * (slow_fraction + stuck_fraction) + members / SINK_MEMBERS + 2) + 64;
+    if (fds > limit.rlim_cur) {
+      cout << right << setw(7) << members << "  skipped: needs about " << fds << " fds, limit " << limit.rlim_cur << endl;
+      continue;
+    }
+    for (auto &scenario : scenarios) {
+      ScenarioResult result;
+      run_scenario(members, scenario.second.first, scenario.second.second, result);
+      print_result(members, scenario.first, result);
+      stalled += !result.stalled.empty();
+    }
+  }
+
+  return stalled > 0 ? 1 : 0;
+}
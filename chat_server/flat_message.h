@@ -0,0 +1,234 @@
+/**
+ * @file flat_message.h
+ * @brief `--format=flat` 에서 쓰는 고정 오프셋 바이너리 메시지
+ *
+ * 모든 정수는 길이 prefix 와 같이 big endian 이다.
+ *
+ * | offset | 크기 | 필드                                                   |
+ * |--------|------|--------------------------------------------------------|
+ * | 0      | 1    | type (Type::MessageType 값)                            |
+ * | 1      | 3    | 예약 (0)                                               |
+ * | 4      | 4    | roomId (CSJoinRoom, CSLeaveRoom, CSChat, SCChat), CSRooms.sort |
+ * | 8      | 4    | count (SCRoomsResult 의 방 개수), CSRooms.limit, CSSearchRooms.limit |
+ * | 12     | 4    | str1 길이 (CSName.name, CSCreateRoom.title, CSChat.text, CSRooms.titlePrefix, CSSearchRooms.query, SCChat.member, SCSystemMessage.text, SCRoomsResult.nextCursor) |
+ * | 16     | 4    | str2 길이 (SCChat.text, CSRooms.cursor)                |
+ * | 20     | ...  | str1, str2 바이트                                      |
+ *
+ * SCRoomsResult 는 헤더와 str1(nextCursor) 뒤에 count 개의 방 레코드가 온다.
+ * 방 레코드: roomId(4) title 길이(4) 멤버 수(4) title, 그리고 멤버마다 이름 길이(4) 이름.
+ *
+ * CSBatch, SCBatch 는 헤더 뒤에 count 개의 메시지가 프레임 길이(4) 프레임 순서로 온다.
+ *
+ * 수신한 메시지는 수신 버퍼를 가리키는 string_view 로 감싸서 복사 없이 필드를 읽는다.
+ * 송신 메시지는 직접 가진 앞부분(head)과 다른 버퍼에서 빌려온 뒷부분(tail)으로 나뉘어,
+ * CSChat 의 text 를 SCChat 으로 옮길 때 바이트를 복사하지 않고 writev 로 함께 보낸다.
+ */
+
+#ifndef CHAT_SERVER_FLAT_MESSAGE_H
+#define CHAT_SERVER_FLAT_MESSAGE_H
+
+#include <arpa/inet.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "message.pb.h"
+
+/**
+ * @brief flat 포맷 메시지. 수신 메시지의 읽기 전용 뷰이자 송신 메시지의 빌더.
+ */
+class FlatMessage {
+  public:
+    static const size_t HEADER_SIZE = 20; ///< 고정 헤더 크기
+
+  private:
+    std::string head;      ///< 송신: 직접 가진 바이트 (헤더 포함)
+    std::string_view tail; ///< 송신: head 뒤에 이어 보낼 빌린 바이트
+    std::string_view view; ///< 수신: 수신 버퍼 안의 프레임
+
+    static uint32_t read_u32(const char *p) {
+      uint32_t v;
+      memcpy(&v, p, 4);
+      return ntohl(v);
+    }
+
+    static void write_u32(char *p, uint32_t value) {
+      uint32_t v = htonl(value);
+      memcpy(p, &v, 4);
+    }
+
+    static void append_u32(std::string &out, uint32_t value) {
+      char buf[4];
+      write_u32(buf, value);
+      out.append(buf, 4);
+    }
+
+    explicit FlatMessage(int type) : head(HEADER_SIZE, '\0') {
+      head[0] = static_cast<char>(type);
+    }
+
+    const char *frame() const {return view.empty() ? head.data() : view.data();}
+
+  public:
+    /**
+     * @brief 기본 생성자
+     */
+    FlatMessage() {}
+
+    /**
+     * @brief 수신 버퍼 안의 프레임을 감싸는 생성자. 버퍼는 메시지를 처리하는 동안 유지되어야 한다.
+     *
+     * @param frame 길이 prefix 를 뗀 프레임
+     */
+    explicit FlatMessage(std::string_view frame) : view(frame) {}
+
+    /**
+     * @brief 헤더와 문자열 길이가 프레임 크기 안에 있는지 확인.
+     */
+    bool valid() const {
+      if (view.size() < HEADER_SIZE) {
+        return false;
+      }
+      uint64_t needed = HEADER_SIZE + static_cast<uint64_t>(read_u32(view.data() + 12)) + read_u32(view.data() + 16);
+      return needed <= view.size();
+    }
+
+    //getter
+    int type() const {return static_cast<uint8_t>(frame()[0]);}
+    int room_id() const {return static_cast<int32_t>(read_u32(frame() + 4));}
+    uint32_t count() const {return read_u32(frame() + 8);}
+    std::string_view str1() const {return std::string_view(frame() + HEADER_SIZE, read_u32(frame() + 12));}
+    std::string_view str2() const {return std::string_view(frame() + HEADER_SIZE + read_u32(frame() + 12), read_u32(frame() + 16));}
+    std::string_view name() const {return str1();}
+    std::string_view title() const {return str1();}
+    std::string_view text() const {return str1();}
+    int sort() const {return room_id();}
+    uint32_t limit() const {return count();}
+    std::string_view title_prefix() const {return str1();}
+    std::string_view cursor() const {return str2();}
+
+    /**
+     * @brief CSBatch 안의 메시지 프레임들을 잘라낸다. 프레임은 이 메시지와 같은 버퍼를 가리킨다.
+     *
+     * @param entries 결과
+     * @return 모든 프레임이 메시지 크기 안에 있으면 true
+     */
+    bool batch_entries(std::vector<std::string_view> &entries) const {
+      entries.clear();
+      size_t offset = HEADER_SIZE;
+      for (uint32_t i = 0; i < count(); ++i) {
+        if (view.size() - offset < 4) {
+          return false;
+        }
+        uint32_t len = read_u32(view.data() + offset);
+        offset += 4;
+        if (view.size() - offset < len) {
+          return false;
+        }
+        entries.push_back(view.substr(offset, len));
+        offset += len;
+      }
+      return true;
+    }
+
+    //송신용
+    const std::string &get_head() const {return head;}
+    std::string_view get_tail() const {return tail;}
+    size_t size() const {return head.size() + tail.size();}
+
+    /**
+     * @brief SCSystemMessage 를 만든다.
+     *
+     * @param text 시스템 메시지 내용
+     */
+    static FlatMessage system_message(const std::string &text) {
+      FlatMessage message(mju::Type_MessageType_SC_SYSTEM_MESSAGE);
+      write_u32(&message.head[12], text.size());
+      message.head += text;
+      return message;
+    }
+
+    /**
+     * @brief SCChat 을 만든다. text 는 복사하지 않고 빌려오므로 메시지를 보낼 때까지 유지되어야 한다.
+     *
+     * @param member 채팅을 보낸 사람
+     * @param text 채팅 내용
+     * @param room_id 채팅이 오간 방
+     */
+    static FlatMessage chat(const std::string &member, std::string_view text, int room_id) {
+      FlatMessage message(mju::Type_MessageType_SC_CHAT);
+      write_u32(&message.head[4], static_cast<uint32_t>(room_id));
+      write_u32(&message.head[12], member.size());
+      write_u32(&message.head[16], text.size());
+      message.head += member;
+      message.tail = text;
+      return message;
+    }
+
+    /**
+     * @brief 빈 SCRoomsResult 를 만든다. add_room_record() 로 채운다.
+     *
+     * @param next_cursor 다음 페이지 커서, 마지막 페이지이면 빈 문자열
+     */
+    static FlatMessage rooms_result(const std::string &next_cursor = "") {
+      FlatMessage message(mju::Type_MessageType_SC_ROOMS_RESULT);
+      write_u32(&message.head[12], next_cursor.size());
+      message.head += next_cursor;
+      return message;
+    }
+
+    /**
+     * @brief SCRoomsResult 의 방 레코드 하나를 만든다.
+     *
+     * @param room_id 방 ID
+     * @param title 방 제목
+     * @param members 멤버 이름들
+     */
+    static std::string room_record(int room_id, const std::string &title, const std::vector<std::string_view> &members) {
+      std::string record;
+      append_u32(record, static_cast<uint32_t>(room_id));
+      append_u32(record, title.size());
+      append_u32(record, members.size());
+      record += title;
+      for (auto name : members) {
+        append_u32(record, name.size());
+        record.append(name);
+      }
+      return record;
+    }
+
+    /**
+     * @brief SCRoomsResult 에 room_record() 로 만든 방 레코드를 추가.
+     *
+     * @param record 방 레코드
+     */
+    void add_room_record(std::string_view record) {
+      write_u32(&head[8], count() + 1);
+      head.append(record);
+    }
+
+    /**
+     * @brief 빈 SCBatch 를 만든다. add_entry() 로 채운다.
+     */
+    static FlatMessage batch() {
+      return FlatMessage(mju::Type_MessageType_SC_BATCH);
+    }
+
+    /**
+     * @brief SCBatch 에 메시지 프레임 하나를 추가. head 와 tail 을 이어 붙인 것이 하나의 프레임이다.
+     *
+     * @param head 프레임 앞부분
+     * @param tail 프레임 뒷부분
+     */
+    void add_entry(std::string_view head, std::string_view tail) {
+      write_u32(&this->head[8], count() + 1);
+      append_u32(this->head, head.size() + tail.size());
+      this->head.append(head);
+      this->head.append(tail);
+    }
+};
+
+#endif
@@ -0,0 +1,374 @@
+/**
+ * @file framing.h
+ * @brief 길이 prefix 프레이밍과 풀(pool)에서 빌린 청크 위에서 동작하는 프레임 재조립기
+ *
+ * 프레이밍 모드는 연결마다 협상한다.
+ * - U16: 기존 2바이트 big endian 길이. 프레임은 65535 바이트를 넘을 수 없다.
+ * - U32: 4바이트 big endian 길이.
+ * - VARINT: protobuf 와 같은 base 128 varint 길이 (최대 5바이트).
+ *
+ * 수신한 바이트는 하나의 연속된 문자열에 이어 붙이지 않고 ChunkPool 에서 빌린 고정 크기 청크에 바로 recv 한다.
+ * 프레임이 한 청크 안에 들어 있으면 청크를 그대로 가리키고, 여러 청크에 걸친 경우에만 한 번 이어 붙인다.
+ * 다 읽은 청크는 바로 풀로 돌려주므로 쉬고 있는 연결은 버퍼 메모리를 잡고 있지 않는다.
+ */
+
+#ifndef CHAT_SERVER_FRAMING_H
+#define CHAT_SERVER_FRAMING_H
+
+#include <arpa/inet.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief 길이 prefix 의 형식
+ */
+enum class FramingMode {
+  U16 = 0,
+  U32 = 1,
+  VARINT = 2,
+};
+
+static const int FRAMING_MODE_COUNT = 3; ///< FramingMode 값의 개수
+static const size_t MAX_LENGTH_PREFIX = 5; ///< 가장 긴 길이 prefix 의 바이트 수
+
+/**
+ * @brief 프레이밍 모드가 표현할 수 있는 가장 큰 프레임 길이.
+ */
+inline size_t max_frame_length(FramingMode mode) {
+  return mode == FramingMode::U16 ? 0xFFFF : 0xFFFFFFFFu;
+}
+
+/**
+ * @brief 프레임 길이를 prefix 로 인코딩.
+ *
+ * @param mode 프레이밍 모드
+ * @param len 프레임 길이, max_frame_length(mode) 이하여야 한다
+ * @param out MAX_LENGTH_PREFIX 바이트 이상의 출력 버퍼
+ * @return prefix 의 바이트 수
+ */
+inline size_t encode_length_prefix(FramingMode mode, size_t len, char *out) {
+  if (mode == FramingMode::U16) {
+    uint16_t v = htons(static_cast<uint16_t>(len));
+    memcpy(out, &v, 2);
+    return 2;
+  } else if (mode == FramingMode::U32) {
+    uint32_t v = htonl(static_cast<uint32_t>(len));
+    memcpy(out, &v, 4);
+    return 4;
+  }
+
+  size_t n = 0;
+  uint32_t v = static_cast<uint32_t>(len);
+  while (v >= 0x80) {
+    out[n++] = static_cast<char>((v & 0x7F) | 0x80);
+    v >>= 7;
+  }
+  out[n++] = static_cast<char>(v);
+  return n;
+}
+
+/**
+ * @brief 수신 버퍼로 쓰는 고정 크기 청크의 풀. 모든 연결이 공유한다.
+ */
+class ChunkPool {
+  public:
+    static const size_t CHUNK_SIZE = 64 * 1024; ///< 청크 하나의 크기
+    static const size_t MAX_FREE_CHUNKS = 1024; ///< 풀이 보관하는 빈 청크 수의 상한
+
+  private:
+    std::mutex pool_mutex;
+    std::vector<char *> free_chunks;
+
+    ChunkPool() {}
+
+  public:
+    ~ChunkPool() {
+      for (char *chunk : free_chunks) {
+        delete[] chunk;
+      }
+    }
+
+    static ChunkPool &instance() {
+      static ChunkPool pool;
+      return pool;
+    }
+
+    char *acquire() {
+      {
+        std::unique_lock<std::mutex> lock(pool_mutex);
+        if (!free_chunks.empty()) {
+          char *chunk = free_chunks.back();
+          free_chunks.pop_back();
+          return chunk;
+        }
+      }
+      return new char[CHUNK_SIZE];
+    }
+
+    void release(char *chunk) {
+      {
+        std::unique_lock<std::mutex> lock(pool_mutex);
+        if (free_chunks.size() < MAX_FREE_CHUNKS) {
+          free_chunks.push_back(chunk);
+          return;
+        }
+      }
+      delete[] chunk;
+    }
+};
+
+/**
+ * @brief 연결 하나의 수신 바이트를 청크에 모아 길이 prefix 단위의 프레임으로 잘라내는 클래스.
+ *
+ * next() 가 READY 를 돌려준 프레임은 consume() 을 부를 때까지 유효하다.
+ */
+class FrameReader {
+  public:
+    /**
+     * @brief next() 의 결과
+     */
+    enum class Status {
+      INCOMPLETE, ///< 프레임을 완성하기에 바이트가 모자라다
+      READY,      ///< 프레임 하나가 준비되었다
+      TOO_LARGE,  ///< 프레임 길이가 최대 크기를 넘는다
+      MALFORMED,  ///< 길이 prefix 가 잘못되었다
+    };
+
+  private:
+    /**
+     * @brief 청크 하나와 그 안에서 아직 읽지 않은 바이트 범위 [begin, end)
+     */
+    struct Segment {
+      char *chunk;
+      size_t begin;
+      size_t end;
+    };
+
+    std::deque<Segment> segments;
+    size_t buffered = 0; ///< 아직 읽지 않은 바이트 수
+    FramingMode mode;
+    size_t max_frame_size;
+
+    bool has_header = false; ///< 현재 프레임의 길이 prefix 를 읽었는지 여부
+    size_t frame_len = 0; ///< 현재 프레임의 길이
+    std::string scratch; ///< 여러 청크에 걸친 프레임을 이어 붙이는 버퍼
+
+    void release_all() {
+      for (auto &segment : segments) {
+        ChunkPool::instance().release(segment.chunk);
+      }
+      segments.clear();
+      buffered = 0;
+    }
+
+    /**
+     * @brief 쓰기 가능한 공간이 있는 마지막 청크를 돌려준다.
+     */
+    Segment &writable_segment() {
+      if (segments.empty() || segments.back().end == ChunkPool::CHUNK_SIZE) {
+        segments.push_back({ChunkPool::instance().acquire(), 0, 0});
+      }
+      return segments.back();
+    }
+
+  public:
+    /**
+     * @brief 생성자
+     *
+     * @param mode 프레이밍 모드
+     * @param max_frame_size 허용하는 최대 프레임 길이
+     */
+    explicit FrameReader(FramingMode mode = FramingMode::U16, size_t max_frame_size = 0xFFFF)
+      : mode(mode), max_frame_size(max_frame_size) {}
+
+    FrameReader(const FrameReader &) = delete;
+    FrameReader &operator=(const FrameReader &) = delete;
+
+    FrameReader(FrameReader &&other) noexcept {
+      *this = std::move(other);
+    }
+
+    FrameReader &operator=(FrameReader &&other) noexcept {
+      if (this != &other) {
+        release_all();
+        segments = std::move(other.segments);
+        buffered = other.buffered;
+        mode = other.mode;
+        max_frame_size = other.max_frame_size;
+        has_header = other.has_header;
+        frame_len = other.frame_len;
+        scratch = std::move(other.scratch);
+        other.segments.clear();
+        other.buffered = 0;
+        other.has_header = false;
+      }
+      return *this;
+    }
+
+    ~FrameReader() {
+      release_all();
+    }
+
+    //setter
+    void set_mode(FramingMode mode) {this->mode = mode;}
+    void set_max_frame_size(size_t max_frame_size) {this->max_frame_size = max_frame_size;}
+
+    //getter
+    FramingMode get_mode() const {return mode;}
+    size_t get_buffered() const {return buffered;}
+
+    /**
+     * @brief 소켓에서 마지막 청크의 빈 공간으로 바로 recv.
+     *
+     * select() 가 알려준 준비 상태는 다른 워커가 먼저 읽어서 이미 지나갔을 수 있으므로 블록하지 않는다.
+     *
+     * @param sock 소켓
+     * @return recv() 의 반환값, 읽을 데이터가 없으면 -1 과 errno EAGAIN
+     */
+    ssize_t read_from(int sock) {
+      Segment &segment = writable_segment();
+      ssize_t num_recv = recv(sock, segment.chunk + segment.end, ChunkPool::CHUNK_SIZE - segment.end, MSG_DONTWAIT);
+      if (num_recv > 0) {
+        segment.end += num_recv;
+        buffered += num_recv;
+      } else if (segment.begin == segment.end) {
+        ChunkPool::instance().release(segment.chunk);
+        segments.pop_back();
+      }
+      return num_recv;
+    }
+
+    /**
+     * @brief 메모리에 있는 바이트를 추가. 벤치마크와 테스트용.
+     */
+    void append(const char *data, size_t len) {
+      while (len > 0) {
+        Segment &segment = writable_segment();
+        size_t n = std::min(len, ChunkPool::CHUNK_SIZE - segment.end);
+        memcpy(segment.chunk + segment.end, data, n);
+        segment.end += n;
+        buffered += n;
+        data += n;
+        len -= n;
+      }
+    }
+
+    /**
+     * @brief 앞에서부터 n 바이트를 소비하지 않고 복사.
+     *
+     * @return 버퍼에 n 바이트 이상 있으면 true
+     */
+    bool peek(size_t n, char *out) const {
+      if (buffered < n) {
+        return false;
+      }
+      for (auto it = segments.begin(); n > 0; ++it) {
+        size_t m = std::min(n, it->end - it->begin);
+        memcpy(out, it->chunk + it->begin, m);
+        out += m;
+        n -= m;
+      }
+      return true;
+    }
+
+    /**
+     * @brief 앞에서부터 n 바이트를 버린다. 다 읽은 청크는 풀로 돌려준다.
+     */
+    void skip(size_t n) {
+      buffered -= n;
+      while (n > 0) {
+        Segment &segment = segments.front();
+        size_t m = std::min(n, segment.end - segment.begin);
+        segment.begin += m;
+        n -= m;
+        if (segment.begin == segment.end) {
+          ChunkPool::instance().release(segment.chunk);
+          segments.pop_front();
+        }
+      }
+    }
+
+    /**
+     * @brief 다음 프레임을 준비.
+     *
+     * @param frame READY 일 때 길이 prefix 를 뗀 프레임. consume() 전까지 유효하다.
+     */
+    Status next(std::string_view &frame) {
+      if (!has_header) {
+        char prefix[MAX_LENGTH_PREFIX];
+        size_t prefix_len;
+        if (mode == FramingMode::U16) {
+          if (!peek(2, prefix)) return Status::INCOMPLETE;
+          uint16_t v;
+          memcpy(&v, prefix, 2);
+          frame_len = ntohs(v);
+          prefix_len = 2;
+        } else if (mode == FramingMode::U32) {
+          if (!peek(4, prefix)) return Status::INCOMPLETE;
+          uint32_t v;
+          memcpy(&v, prefix, 4);
+          frame_len = ntohl(v);
+          prefix_len = 4;
+        } else {
+          size_t available = std::min(buffered, MAX_LENGTH_PREFIX);
+          peek(available, prefix);
+          frame_len = 0;
+          prefix_len = 0;
+          while (true) {
+            if (prefix_len == available) {
+              return available == MAX_LENGTH_PREFIX ? Status::MALFORMED : Status::INCOMPLETE;
+            }
+            uint8_t byte = prefix[prefix_len];
+            frame_len |= static_cast<size_t>(byte & 0x7F) << (7 * prefix_len);
+            ++prefix_len;
+            if ((byte & 0x80) == 0) {
+              break;
+            }
+          }
+        }
+
+        if (frame_len > max_frame_size) {
+          return Status::TOO_LARGE;
+        }
+        skip(prefix_len);
+        has_header = true;
+      }
+
+      if (buffered < frame_len) {
+        return Status::INCOMPLETE;
+      }
+
+      if (frame_len == 0) {
+        frame = std::string_view();
+      } else if (segments.front().end - segments.front().begin >= frame_len) {
+        // 한 청크 안에 들어 있으면 복사하지 않는다
+        frame = std::string_view(segments.front().chunk + segments.front().begin, frame_len);
+      } else {
+        scratch.resize(frame_len);
+        peek(frame_len, &scratch[0]);
+        frame = scratch;
+      }
+      return Status::READY;
+    }
+
+    /**
+     * @brief next() 가 준비한 프레임을 버퍼에서 지운다.
+     */
+    void consume() {
+      skip(frame_len);
+      has_header = false;
+      frame_len = 0;
+      if (scratch.capacity() > ChunkPool::CHUNK_SIZE) {
+        std::string().swap(scratch); // 큰 프레임 뒤에 메모리를 잡고 있지 않도록
+      }
+    }
+};
+
+#endif
@@ -0,0 +1,797 @@
+/**
+ * @file json_scanner.h
+ * @brief 수신한 JSON 프레임의 구조 문자 위치를 SIMD 로 찾고 UTF-8 을 검증하는 stage-1 스캐너와
+ *        그 결과 위에서 동작하는 평평한(flat) 객체 추출기
+ *
+ * stage 1 은 입력을 64바이트 블록 단위로 훑어 `{ } [ ] : ,` 와 문자열 경계(`"`)의 위치를
+ * 비트마스크로 만들고, 같은 패스에서 UTF-8 유효성과 문자열 안의 제어 문자를 검사한다.
+ * 블록 분류는 실행 시점에 AVX2 / SSE4.2 / 스칼라 중 CPU 가 지원하는 가장 빠른 구현을 고른다.
+ *
+ * stage 2 (parse_flat_object) 는 stage 1 의 구조 문자 인덱스만 따라가며 CSChat 처럼
+ * 값이 문자열/정수/bool/null 뿐인 최상위 객체를 바로 json 으로 만든다.
+ * 중첩 객체나 실수처럼 처리하지 않는 입력은 false 를 돌려주고, 호출자는 json::parse 로 넘어간다.
+ * split_batch 는 같은 방식으로 CSBatch 프레임을 안쪽 메시지 범위로만 나누어, 배치 전체의 DOM 을 만들지 않는다.
+ */
+
+#ifndef CHAT_SERVER_JSON_SCANNER_H
+#define CHAT_SERVER_JSON_SCANNER_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define JSON_SCANNER_X86 1
+#endif
+
+#include "nlohmann/json.hpp"
+
+/**
+ * @brief JSON stage-1 스캐너
+ */
+class JsonScanner {
+  public:
+    /**
+     * @brief 블록 분류 구현 종류
+     */
+    enum class Backend {
+      AUTO,   ///< CPU 가 지원하는 가장 빠른 구현
+      SCALAR, ///< 바이트 단위 구현
+      SSE42,  ///< 16바이트 SSE4.2 구현
+      AVX2,   ///< 32바이트 AVX2 구현
+    };
+
+    /**
+     * @brief 입력을 훑어 구조 문자 위치를 structurals 에 채운다.
+     *
+     * @param data 입력 데이터
+     * @param len 입력 길이
+     * @param structurals 구조 문자(`{}[]:,` 와 문자열 양 끝의 `"`)의 오프셋이 오름차순으로 담긴다
+     * @param backend 사용할 구현, AUTO 면 실행 시점에 선택
+     * @return UTF-8 이 올바르고, 문자열이 닫혀 있고, 문자열 안에 제어 문자가 없으면 true
+     */
+    static bool scan(const char *data, size_t len, std::vector<uint32_t> &structurals, Backend backend = Backend::AUTO) {
+      BlockFn classify = select(backend);
+      if (classify == nullptr) {
+        return false;
+      }
+
+      structurals.clear();
+      structurals.reserve(len / 4 + 64);
+
+      const uint8_t *in = reinterpret_cast<const uint8_t *>(data);
+      Utf8State utf8;
+      uint64_t prev_escaped = 0;
+      uint64_t prev_in_string = 0;
+      uint64_t bad = 0;
+
+      size_t offset = 0;
+      alignas(64) uint8_t tail[64];
+      while (offset < len) {
+        const uint8_t *block = in + offset;
+        if (len - offset < 64) {
+          // 마지막 블록은 공백으로 채운 복사본을 쓴다 (공백은 ASCII 이고 구조 문자가 아니다)
+          memset(tail, ' ', sizeof(tail));
+          memcpy(tail, block, len - offset);
+          block = tail;
+        }
+
+        RawBlock raw;
+        classify(block, raw, utf8);
+
+        uint64_t escaped = find_escaped(raw.backslash, prev_escaped);
+        uint64_t quotes = raw.quote & ~escaped;
+        uint64_t in_string = prefix_xor(quotes) ^ prev_in_string;
+        prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+        bad |= raw.control & in_string;
+        flatten(static_cast<uint32_t>(offset), (raw.op & ~in_string) | quotes, structurals);
+        offset += 64;
+      }
+
+      return bad == 0 && prev_in_string == 0 && utf8_finish(utf8, classify);
+    }
+
+    /**
+     * @brief 현재 CPU 에서 AUTO 가 고르는 구현의 이름.
+     */
+    static const char *backend_name() {
+      BlockFn fn = select(Backend::AUTO);
+#ifdef JSON_SCANNER_X86
+      if (fn == &block_avx2) return "avx2";
+      if (fn == &block_sse42) return "sse4.2";
+#endif
+      return "scalar";
+    }
+
+    /**
+     * @brief 최상위가 평평한 객체인 JSON 을 stage 1 결과로 바로 추출.
+     *
+     * 값은 문자열, 정수, true, false, null 만 허용한다.
+     * 그 밖의 입력(중첩 값, 실수, 문법 오류 등)은 false 를 돌려주며 out 은 정의되지 않는다.
+     *
+     * @param serialized 수신한 JSON 프레임
+     * @param out 추출 결과
+     * @param backend 사용할 stage 1 구현
+     * @return 추출에 성공하면 true
+     */
+    static bool parse_flat_object(std::string_view serialized, nlohmann::json &out, Backend backend = Backend::AUTO) {
+      thread_local std::vector<uint32_t> structurals;
+      const char *data = serialized.data();
+      size_t len = serialized.length();
+
+      if (!scan(data, len, structurals, backend) || structurals.empty()) {
+        return false;
+      }
+
+      size_t n = structurals.size();
+      size_t i = 0;
+      if (data[structurals[0]] != '{' || !is_blank(data, 0, structurals[0])) {
+        return false;
+      }
+
+      out = nlohmann::json::object();
+      uint32_t prev = structurals[0];
+      ++i;
+
+      if (i < n && data[structurals[i]] == '}') {
+        prev = structurals[i++];
+      } else {
+        while (true) {
+          // "key"
+          if (i + 2 >= n || data[structurals[i]] != '"' || !is_blank(data, prev + 1, structurals[i])) {
+            return false;
+          }
+          std::string key;
+          if (!unescape(data + structurals[i] + 1, structurals[i + 1] - structurals[i] - 1, key)) {
+            return false;
+          }
+          // :
+          if (data[structurals[i + 2]] != ':' || !is_blank(data, structurals[i + 1] + 1, structurals[i + 2])) {
+            return false;
+          }
+          prev = structurals[i + 2];
+          i += 3;
+          if (i >= n) {
+            return false;
+          }
+
+          // value
+          char c = data[structurals[i]];
+          if (c == '"') {
+            if (i + 1 >= n || !is_blank(data, prev + 1, structurals[i])) {
+              return false;
+            }
+            std::string value;
+            if (!unescape(data + structurals[i] + 1, structurals[i + 1] - structurals[i] - 1, value)) {
+              return false;
+            }
+            out[key] = std::move(value);
+            prev = structurals[i + 1];
+            i += 2;
+          } else if (c == ',' || c == '}') {
+            if (!parse_scalar(data + prev + 1, structurals[i] - prev - 1, out[key])) {
+              return false;
+            }
+            prev = structurals[i] - 1; // 값 자체는 공백 검사 대상이 아니다
+          } else {
+            return false;
+          }
+
+          // , 또는 }
+          if (i >= n || !is_blank(data, prev + 1, structurals[i])) {
+            return false;
+          }
+          c = data[structurals[i]];
+          prev = structurals[i++];
+          if (c == '}') {
+            break;
+          } else if (c != ',') {
+            return false;
+          }
+        }
+      }
+
+      return i == n && is_blank(data, prev + 1, static_cast<uint32_t>(len));
+    }
+
+    /**
+     * @brief {"type": "CSBatch", "messages": [{...}, ...]} 배치 프레임을 DOM 없이 안쪽 메시지 단위로 나눈다.
+     *
+     * 안쪽 객체는 괄호 짝만 맞춰 잘라내므로 호출한 쪽이 각각 파싱하면서 검증해야 한다.
+     * messages 가 아닌 키의 값은 문자열 또는 스칼라만 허용하며, 그 밖의 입력은 false 를 돌려준다.
+     *
+     * @param serialized 수신한 JSON 프레임
+     * @param entries messages 배열의 각 객체. serialized 를 가리킨다.
+     * @param backend 사용할 stage 1 구현
+     * @return 배치 프레임이면 true
+     */
+    static bool split_batch(std::string_view serialized, std::vector<std::string_view> &entries, Backend backend = Backend::AUTO) {
+      thread_local std::vector<uint32_t> structurals;
+      const char *data = serialized.data();
+      size_t len = serialized.length();
+      entries.clear();
+
+      if (!scan(data, len, structurals, backend) || structurals.empty()) {
+        return false;
+      }
+
+      size_t n = structurals.size();
+      if (data[structurals[0]] != '{' || !is_blank(data, 0, structurals[0])) {
+        return false;
+      }
+
+      std::string type;
+      bool has_messages = false;
+      uint32_t prev = structurals[0];
+      size_t i = 1;
+      while (true) {
+        // "key" :
+        if (i + 3 >= n || data[structurals[i]] != '"' || !is_blank(data, prev + 1, structurals[i])) {
+          return false;
+        }
+        std::string key;
+        if (!unescape(data + structurals[i] + 1, structurals[i + 1] - structurals[i] - 1, key)) {
+          return false;
+        }
+        if (data[structurals[i + 2]] != ':' || !is_blank(data, structurals[i + 1] + 1, structurals[i + 2])) {
+          return false;
+        }
+        prev = structurals[i + 2];
+        i += 3;
+
+        char c = data[structurals[i]];
+        if (key == "messages") {
+          // [ {...}, {...} ]
+          if (c != '[' || has_messages || !is_blank(data, prev + 1, structurals[i])) {
+            return false;
+          }
+          has_messages = true;
+          prev = structurals[i++];
+          if (i < n && data[structurals[i]] == ']' && is_blank(data, prev + 1, structurals[i])) {
+            prev = structurals[i++];
+          } else {
+            while (true) {
+              if (i >= n || data[structurals[i]] != '{' || !is_blank(data, prev + 1, structurals[i])) {
+                return false;
+              }
+              size_t begin = i;
+              int depth = 0;
+              for (; i < n; ++i) {
+                char b = data[structurals[i]];
+                if (b == '{' || b == '[') {
+                  ++depth;
+                } else if (b == '}' || b == ']') {
+                  if (--depth == 0) {
+                    break;
+                  }
+                }
+              }
+              if (i >= n) {
+                return false;
+              }
+              entries.push_back(serialized.substr(structurals[begin], structurals[i] - structurals[begin] + 1));
+              prev = structurals[i++];
+
+              if (i >= n || !is_blank(data, prev + 1, structurals[i])) {
+                return false;
+              }
+              c = data[structurals[i]];
+              prev = structurals[i++];
+              if (c == ']') {
+                break;
+              } else if (c != ',') {
+                return false;
+              }
+            }
+          }
+        } else if (c == '"') {
+          std::string value;
+          if (i + 1 >= n || !is_blank(data, prev + 1, structurals[i]) ||
+              !unescape(data + structurals[i] + 1, structurals[i + 1] - structurals[i] - 1, value)) {
+            return false;
+          }
+          if (key == "type") {
+            type = std::move(value);
+          }
+          prev = structurals[i + 1];
+          i += 2;
+        } else if (c == ',' || c == '}') {
+          nlohmann::json scalar;
+          if (!parse_scalar(data + prev + 1, structurals[i] - prev - 1, scalar)) {
+            return false;
+          }
+          prev = structurals[i] - 1; // 값 자체는 공백 검사 대상이 아니다
+        } else {
+          return false;
+        }
+
+        // , 또는 }
+        if (i >= n || !is_blank(data, prev + 1, structurals[i])) {
+          return false;
+        }
+        c = data[structurals[i]];
+        prev = structurals[i++];
+        if (c == '}') {
+          break;
+        } else if (c != ',') {
+          return false;
+        }
+      }
+
+      return i == n && is_blank(data, prev + 1, static_cast<uint32_t>(len)) && type == "CSBatch" && has_messages;
+    }
+
+  private:
+    /**
+     * @brief 64바이트 블록 하나의 분류 결과. 비트 i 는 블록의 i 번째 바이트를 뜻한다.
+     */
+    struct RawBlock {
+      uint64_t quote;     ///< `"`
+      uint64_t backslash; ///< `\`
+      uint64_t op;        ///< `{ } [ ] : ,`
+      uint64_t control;   ///< 0x20 미만의 제어 문자
+    };
+
+    /**
+     * @brief 블록 경계를 넘어 이어지는 UTF-8 검증 상태.
+     *
+     * SIMD 구현은 직전 입력 32바이트와 누적 오류 벡터를, 스칼라 구현은 남은 연속 바이트 수와
+     * 다음 바이트의 허용 범위를 보관한다.
+     */
+    struct Utf8State {
+      alignas(32) uint8_t prev_input[32] = {};
+      alignas(32) uint8_t prev_incomplete[32] = {};
+      alignas(32) uint8_t error[32] = {};
+      int pending = 0;         ///< 스칼라: 아직 받아야 하는 연속 바이트 수
+      uint8_t next_lo = 0x80;  ///< 스칼라: 다음 연속 바이트의 최솟값
+      uint8_t next_hi = 0xBF;  ///< 스칼라: 다음 연속 바이트의 최댓값
+      bool scalar_error = false;
+    };
+
+    using BlockFn = void (*)(const uint8_t *, RawBlock &, Utf8State &);
+
+    static BlockFn select(Backend backend) {
+#ifdef JSON_SCANNER_X86
+      static const bool has_avx2 = __builtin_cpu_supports("avx2");
+      static const bool has_sse42 = __builtin_cpu_supports("sse4.2");
+      switch (backend) {
+        case Backend::AUTO:
+          return has_avx2 ? &block_avx2 : (has_sse42 ? &block_sse42 : &block_scalar);
+        case Backend::AVX2:
+          return has_avx2 ? &block_avx2 : nullptr;
+        case Backend::SSE42:
+          return has_sse42 ? &block_sse42 : nullptr;
+        case Backend::SCALAR:
+          return &block_scalar;
+      }
+      return nullptr;
+#else
+      return (backend == Backend::AUTO || backend == Backend::SCALAR) ? &block_scalar : nullptr;
+#endif
+    }
+
+    static uint64_t prefix_xor(uint64_t bits) {
+      bits ^= bits << 1;
+      bits ^= bits << 2;
+      bits ^= bits << 4;
+      bits ^= bits << 8;
+      bits ^= bits << 16;
+      bits ^= bits << 32;
+      return bits;
+    }
+
+    /**
+     * @brief 홀수 길이의 역슬래시 연속 바로 뒤에 오는(즉 이스케이프된) 문자의 마스크.
+     */
+    static uint64_t find_escaped(uint64_t backslash, uint64_t &prev_escaped) {
+      const uint64_t even_bits = 0x5555555555555555ULL;
+      backslash &= ~prev_escaped;
+      uint64_t follows_escape = (backslash << 1) | prev_escaped;
+      uint64_t odd_sequence_starts = backslash & ~even_bits & ~follows_escape;
+      uint64_t sequences_starting_on_even_bits;
+      prev_escaped = __builtin_add_overflow(odd_sequence_starts, backslash, &sequences_starting_on_even_bits);
+      uint64_t invert_mask = sequences_starting_on_even_bits << 1;
+      return (even_bits ^ invert_mask) & follows_escape;
+    }
+
+    static void flatten(uint32_t base, uint64_t bits, std::vector<uint32_t> &out) {
+      size_t size = out.size();
+      out.resize(size + __builtin_popcountll(bits));
+      uint32_t *dst = out.data() + size;
+      while (bits != 0) {
+        *dst++ = base + __builtin_ctzll(bits);
+        bits &= bits - 1;
+      }
+    }
+
+    static bool utf8_finish(const Utf8State &st, BlockFn classify) {
+      if (classify == &block_scalar) {
+        return !st.scalar_error && st.pending == 0;
+      }
+      uint8_t acc = 0;
+      for (int i = 0; i < 32; ++i) {
+        acc |= st.error[i] | st.prev_incomplete[i];
+      }
+      return acc == 0;
+    }
+
+    static void block_scalar(const uint8_t *in, RawBlock &raw, Utf8State &st) {
+      raw = RawBlock{0, 0, 0, 0};
+      for (int i = 0; i < 64; ++i) {
+        uint8_t c = in[i];
+        uint64_t bit = 1ULL << i;
+        switch (c) {
+          case '"': raw.quote |= bit; break;
+          case '\\': raw.backslash |= bit; break;
+          case '{': case '}': case '[': case ']': case ':': case ',': raw.op |= bit; break;
+          default: if (c < 0x20) raw.control |= bit; break;
+        }
+
+        if (st.pending > 0) {
+          if (c < st.next_lo || c > st.next_hi) {
+            st.scalar_error = true;
+          }
+          st.next_lo = 0x80;
+          st.next_hi = 0xBF;
+          --st.pending;
+        } else if (c >= 0x80) {
+          if (c >= 0xC2 && c <= 0xDF) {
+            st.pending = 1;
+          } else if (c >= 0xE0 && c <= 0xEF) {
+            st.pending = 2;
+            if (c == 0xE0) st.next_lo = 0xA0;       // overlong
+            else if (c == 0xED) st.next_hi = 0x9F;  // surrogate
+          } else if (c >= 0xF0 && c <= 0xF4) {
+            st.pending = 3;
+            if (c == 0xF0) st.next_lo = 0x90;       // overlong
+            else if (c == 0xF4) st.next_hi = 0x8F;  // U+10FFFF 초과
+          } else {
+            st.scalar_error = true;
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief 바이트 단위 구현이 허용하는 문자열 조각의 공백 여부.
+     */
+    static bool is_blank(const char *data, uint32_t begin, uint32_t end) {
+      for (uint32_t i = begin; i < end; ++i) {
+        char c = data[i];
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    static bool parse_scalar(const char *p, size_t len, nlohmann::json &out) {
+      while (len > 0 && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) {
+        ++p;
+        --len;
+      }
+      while (len > 0 && (p[len - 1] == ' ' || p[len - 1] == '\t' || p[len - 1] == '\n' || p[len - 1] == '\r')) {
+        --len;
+      }
+      if (len == 4 && memcmp(p, "true", 4) == 0) {
+        out = true;
+        return true;
+      } else if (len == 5 && memcmp(p, "false", 5) == 0) {
+        out = false;
+        return true;
+      } else if (len == 4 && memcmp(p, "null", 4) == 0) {
+        out = nullptr;
+        return true;
+      }
+
+      bool negative = (len > 0 && *p == '-');
+      if (negative) {
+        ++p;
+        --len;
+      }
+      // 정수만 처리한다. 선행 0, 18자리를 넘는 수, 실수는 json::parse 로 넘긴다.
+      if (len == 0 || len > 18 || (len > 1 && *p == '0')) {
+        return false;
+      }
+      uint64_t value = 0;
+      for (size_t i = 0; i < len; ++i) {
+        if (p[i] < '0' || p[i] > '9') {
+          return false;
+        }
+        value = value * 10 + (p[i] - '0');
+      }
+      if (negative) {
+        out = -static_cast<int64_t>(value);
+      } else {
+        out = value;
+      }
+      return true;
+    }
+
+    static int hex_value(char c) {
+      if (c >= '0' && c <= '9') return c - '0';
+      if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+      if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+      return -1;
+    }
+
+    static bool read_hex4(const char *p, const char *end, uint32_t &code) {
+      if (end - p < 4) {
+        return false;
+      }
+      code = 0;
+      for (int i = 0; i < 4; ++i) {
+        int v = hex_value(p[i]);
+        if (v < 0) {
+          return false;
+        }
+        code = (code << 4) | v;
+      }
+      return true;
+    }
+
+    static void append_utf8(uint32_t code, std::string &out) {
+      if (code < 0x80) {
+        out.push_back(static_cast<char>(code));
+      } else if (code < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+      } else if (code < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+      } else {
+        out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+      }
+    }
+
+    /**
+     * @brief 따옴표 사이의 문자열을 이스케이프 해제. 역슬래시가 없으면 그대로 복사한다.
+     */
+    static bool unescape(const char *p, size_t len, std::string &out) {
+      const char *end = p + len;
+      const char *bs = static_cast<const char *>(memchr(p, '\\', len));
+      if (bs == nullptr) {
+        out.assign(p, len);
+        return true;
+      }
+
+      out.reserve(len);
+      out.assign(p, bs);
+      p = bs;
+      while (p < end) {
+        if (*p != '\\') {
+          out.push_back(*p++);
+          continue;
+        }
+        if (++p == end) {
+          return false;
+        }
+        switch (*p++) {
+          case '"': out.push_back('"'); break;
+          case '\\': out.push_back('\\'); break;
+          case '/': out.push_back('/'); break;
+          case 'b': out.push_back('\b'); break;
+          case 'f': out.push_back('\f'); break;
+          case 'n': out.push_back('\n'); break;
+          case 'r': out.push_back('\r'); break;
+          case 't': out.push_back('\t'); break;
+          case 'u': {
+            uint32_t code;
+            if (!read_hex4(p, end, code)) {
+              return false;
+            }
+            p += 4;
+            if (code >= 0xD800 && code <= 0xDBFF) {
+              uint32_t low;
+              if (end - p < 6 || p[0] != '\\' || p[1] != 'u' || !read_hex4(p + 2, end, low)
+                  || low < 0xDC00 || low > 0xDFFF) {
+                return false;
+              }
+              p += 6;
+              code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+            } else if (code >= 0xDC00 && code <= 0xDFFF) {
+              return false;
+            }
+            append_utf8(code, out);
+            break;
+          }
+          default:
+            return false;
+        }
+      }
+      return true;
+    }
+
+#ifdef JSON_SCANNER_X86
+    // UTF-8 검증 룩업 테이블의 오류 비트 (Keiser & Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte")
+    static constexpr uint8_t TOO_SHORT = 1 << 0;
+    static constexpr uint8_t TOO_LONG = 1 << 1;
+    static constexpr uint8_t OVERLONG_3 = 1 << 2;
+    static constexpr uint8_t TOO_LARGE = 1 << 3;
+    static constexpr uint8_t SURROGATE = 1 << 4;
+    static constexpr uint8_t OVERLONG_2 = 1 << 5;
+    static constexpr uint8_t TOO_LARGE_1000 = 1 << 6;
+    static constexpr uint8_t OVERLONG_4 = 1 << 6;
+    static constexpr uint8_t TWO_CONTS = 1 << 7;
+    static constexpr uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+#define JSON_SCANNER_BYTE_1_HIGH \
+      TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, \
+      TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS, \
+      TOO_SHORT | OVERLONG_2, \
+      TOO_SHORT, \
+      TOO_SHORT | OVERLONG_3 | SURROGATE, \
+      TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+#define JSON_SCANNER_BYTE_1_LOW \
+      CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4, \
+      CARRY | OVERLONG_2, \
+      CARRY, \
+      CARRY, \
+      CARRY | TOO_LARGE, \
+      CARRY | TOO_LARGE | TOO_LARGE_1000, \
+      CARRY | TOO_LARGE | TOO_LARGE_1000, \
+      CARRY | TOO_LARGE | TOO_LARGE_1000, \
+      CARRY | TOO_LARGE | TOO_LARGE_1000, \
+      CARRY | TOO_LARGE | TOO_LARGE_1000, \
+      CARRY | TOO_LARGE | TOO_LARGE_1000, \
+      CARRY | TOO_LARGE | TOO_LARGE_1000, \
+      CARRY | TOO_LARGE | TOO_LARGE_1000, \
+      CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE, \
+      CARRY | TOO_LARGE | TOO_LARGE_1000, \
+      CARRY | TOO_LARGE | TOO_LARGE_1000
+#define JSON_SCANNER_BYTE_2_HIGH \
+      TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, \
+      TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4, \
+      TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE, \
+      TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, \
+      TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, \
+      TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+#define JSON_SCANNER_INCOMPLETE_TAIL \
+      0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, \
+      0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+
+    __attribute__((target("sse4.2")))
+    static __m128i utf8_errors_sse42(__m128i input, __m128i prev_input) {
+      const __m128i low_nibble = _mm_set1_epi8(0x0F);
+      const __m128i byte_1_high_table = _mm_setr_epi8(JSON_SCANNER_BYTE_1_HIGH);
+      const __m128i byte_1_low_table = _mm_setr_epi8(JSON_SCANNER_BYTE_1_LOW);
+      const __m128i byte_2_high_table = _mm_setr_epi8(JSON_SCANNER_BYTE_2_HIGH);
+
+      __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+      __m128i byte_1_high = _mm_shuffle_epi8(byte_1_high_table, _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble));
+      __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, low_nibble));
+      __m128i byte_2_high = _mm_shuffle_epi8(byte_2_high_table, _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble));
+      __m128i special = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+      __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+      __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+      __m128i is_third = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+      __m128i is_fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+      __m128i must23_80 = _mm_and_si128(_mm_or_si128(is_third, is_fourth), _mm_set1_epi8(static_cast<char>(0x80)));
+      return _mm_xor_si128(must23_80, special);
+    }
+
+    __attribute__((target("sse4.2")))
+    static void block_sse42(const uint8_t *in, RawBlock &raw, Utf8State &st) {
+      const __m128i incomplete_max = _mm_setr_epi8(JSON_SCANNER_INCOMPLETE_TAIL);
+      const __m128i control_max = _mm_set1_epi8(0x1F);
+      __m128i prev_input = _mm_load_si128(reinterpret_cast<const __m128i *>(st.prev_input + 16));
+      __m128i prev_incomplete = _mm_load_si128(reinterpret_cast<const __m128i *>(st.prev_incomplete));
+      __m128i error = _mm_load_si128(reinterpret_cast<const __m128i *>(st.error));
+
+      raw = RawBlock{0, 0, 0, 0};
+      for (int i = 0; i < 4; ++i) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 16 * i));
+        int shift = 16 * i;
+
+        raw.quote |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('"'))))) << shift;
+        raw.backslash |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))))) << shift;
+        // '[' ']' '{' '}' 는 0x20 비트만 다르다
+        __m128i folded = _mm_or_si128(v, _mm_set1_epi8(0x20));
+        __m128i op = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')), _mm_cmpeq_epi8(folded, _mm_set1_epi8('}'))),
+          _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(':')), _mm_cmpeq_epi8(v, _mm_set1_epi8(','))));
+        raw.op |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(op))) << shift;
+        __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(v, control_max), v);
+        raw.control |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(control))) << shift;
+
+        if (_mm_movemask_epi8(v) == 0) {
+          error = _mm_or_si128(error, prev_incomplete);
+        } else {
+          error = _mm_or_si128(error, utf8_errors_sse42(v, prev_input));
+          prev_incomplete = _mm_subs_epu8(v, incomplete_max);
+        }
+        prev_input = v;
+      }
+
+      _mm_store_si128(reinterpret_cast<__m128i *>(st.prev_input + 16), prev_input);
+      _mm_store_si128(reinterpret_cast<__m128i *>(st.prev_incomplete), prev_incomplete);
+      _mm_store_si128(reinterpret_cast<__m128i *>(st.error), error);
+    }
+
+    __attribute__((target("avx2")))
+    static __m256i utf8_prev_avx2(__m256i input, __m256i prev_input, int n) {
+      __m256i shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+      switch (n) {
+        case 1: return _mm256_alignr_epi8(input, shifted, 15);
+        case 2: return _mm256_alignr_epi8(input, shifted, 14);
+        default: return _mm256_alignr_epi8(input, shifted, 13);
+      }
+    }
+
+    __attribute__((target("avx2")))
+    static __m256i utf8_errors_avx2(__m256i input, __m256i prev_input) {
+      const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+      const __m256i byte_1_high_table = _mm256_setr_epi8(JSON_SCANNER_BYTE_1_HIGH, JSON_SCANNER_BYTE_1_HIGH);
+      const __m256i byte_1_low_table = _mm256_setr_epi8(JSON_SCANNER_BYTE_1_LOW, JSON_SCANNER_BYTE_1_LOW);
+      const __m256i byte_2_high_table = _mm256_setr_epi8(JSON_SCANNER_BYTE_2_HIGH, JSON_SCANNER_BYTE_2_HIGH);
+
+      __m256i prev1 = utf8_prev_avx2(input, prev_input, 1);
+      __m256i byte_1_high = _mm256_shuffle_epi8(byte_1_high_table, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble));
+      __m256i byte_1_low = _mm256_shuffle_epi8(byte_1_low_table, _mm256_and_si256(prev1, low_nibble));
+      __m256i byte_2_high = _mm256_shuffle_epi8(byte_2_high_table, _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble));
+      __m256i special = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+      __m256i prev2 = utf8_prev_avx2(input, prev_input, 2);
+      __m256i prev3 = utf8_prev_avx2(input, prev_input, 3);
+      __m256i is_third = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+      __m256i is_fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+      __m256i must23_80 = _mm256_and_si256(_mm256_or_si256(is_third, is_fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+      return _mm256_xor_si256(must23_80, special);
+    }
+
+    __attribute__((target("avx2")))
+    static void block_avx2(const uint8_t *in, RawBlock &raw, Utf8State &st) {
+      const __m256i incomplete_max = _mm256_setr_epi8(
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        JSON_SCANNER_INCOMPLETE_TAIL);
+      const __m256i control_max = _mm256_set1_epi8(0x1F);
+      __m256i prev_input = _mm256_load_si256(reinterpret_cast<const __m256i *>(st.prev_input));
+      __m256i prev_incomplete = _mm256_load_si256(reinterpret_cast<const __m256i *>(st.prev_incomplete));
+      __m256i error = _mm256_load_si256(reinterpret_cast<const __m256i *>(st.error));
+
+      raw = RawBlock{0, 0, 0, 0};
+      for (int i = 0; i < 2; ++i) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + 32 * i));
+        int shift = 32 * i;
+
+        raw.quote |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"'))))) << shift;
+        raw.backslash |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'))))) << shift;
+        __m256i folded = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+        __m256i op = _mm256_or_si256(
+          _mm256_or_si256(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')), _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}'))),
+          _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(':')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8(','))));
+        raw.op |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(op))) << shift;
+        __m256i control = _mm256_cmpeq_epi8(_mm256_min_epu8(v, control_max), v);
+        raw.control |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(control))) << shift;
+
+        if (_mm256_movemask_epi8(v) == 0) {
+          error = _mm256_or_si256(error, prev_incomplete);
+        } else {
+          error = _mm256_or_si256(error, utf8_errors_avx2(v, prev_input));
+          prev_incomplete = _mm256_subs_epu8(v, incomplete_max);
+        }
+        prev_input = v;
+      }
+
+      _mm256_store_si256(reinterpret_cast<__m256i *>(st.prev_input), prev_input);
+      _mm256_store_si256(reinterpret_cast<__m256i *>(st.prev_incomplete), prev_incomplete);
+      _mm256_store_si256(reinterpret_cast<__m256i *>(st.error), error);
+    }
+
+#undef JSON_SCANNER_BYTE_1_HIGH
+#undef JSON_SCANNER_BYTE_1_LOW
+#undef JSON_SCANNER_BYTE_2_HIGH
+#undef JSON_SCANNER_INCOMPLETE_TAIL
+#endif
+};
+
+#endif
@@ -0,0 +1,254 @@
+/**
+ * @file lock_profile.h
+ * @brief 잡은 횟수, 경합, 기다린 시간과 잡고 있던 시간을 재는 mutex
+ *
+ * 락을 고치기 전에 어느 락이 어디서 실제로 비용을 치르는지 보려고 쓴다. ProfiledLock 을 만든 함수와 줄을
+ * 호출 위치로 삼아 위치마다 잡은 횟수와 가장 오래 잡은 시간을 남긴다.
+ *
+ * 기록은 ProfiledMutex::set_enabled(true) 로 켠다. 끈 동안에는 std::mutex 에 플래그 하나를 읽는 비용만 더해진다.
+ */
+
+#ifndef CHAT_SERVER_LOCK_PROFILE_H
+#define CHAT_SERVER_LOCK_PROFILE_H
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "metrics.h"
+
+/**
+ * @brief 잡은 위치별 통계를 남기는 mutex. ProfiledLock 으로 잡는다.
+ */
+class ProfiledMutex {
+  public:
+    static const size_t MAX_SITES = 64; ///< 위치별 통계를 남길 수 있는 호출 위치 수, 넘는 위치는 지표에만 든다
+
+  private:
+    /**
+     * @brief 호출 위치 하나의 통계
+     */
+    struct Site {
+      std::atomic<uint64_t> key {0}; ///< function 과 line 으로 만든 값, 0 이면 빈 칸
+      std::atomic<const char *> function {nullptr};
+      std::atomic<int> line {0};
+      std::atomic<uint64_t> acquisitions {0};
+      std::atomic<uint64_t> contended {0};
+      std::atomic<uint64_t> wait_ns {0};
+      std::atomic<uint64_t> hold_ns {0};
+      std::atomic<uint64_t> max_hold_ns {0};
+    };
+
+    std::mutex mutex;
+    std::string name;
+    Counter &acquisitions;
+    Counter &contended;
+    Histogram &wait_histogram;
+    Histogram &hold_histogram;
+    Site sites[MAX_SITES];
+
+    // 락을 잡은 쓰레드만 읽고 쓴다
+    Site *holder = nullptr; ///< 지금 잡고 있는 위치, 기록하지 않고 잡았으면 nullptr
+    uint64_t acquired_ns = 0;
+
+    static std::atomic<bool> &enabled_flag() {
+      static std::atomic<bool> flag {false};
+      return flag;
+    }
+
+    /**
+     * @brief 호출 위치의 칸을 찾거나 비어 있는 칸을 차지한다. 칸이 모자라면 nullptr.
+     */
+    Site *site(const char *function, int line) {
+      uint64_t key = (reinterpret_cast<uintptr_t>(function) << 16) ^ static_cast<uint64_t>(line) ^ 1;
+      size_t start = static_cast<size_t>(key * 0x9E3779B97F4A7C15ull >> 58) % MAX_SITES;
+      for (size_t i = 0; i < MAX_SITES; ++i) {
+        Site &candidate = sites[(start + i) % MAX_SITES];
+        uint64_t current = candidate.key.load(std::memory_order_acquire);
+        if (current == 0 && candidate.key.compare_exchange_strong(current, key, std::memory_order_acq_rel)) {
+          candidate.line.store(line, std::memory_order_relaxed);
+          candidate.function.store(function, std::memory_order_release);
+          return &candidate;
+        }
+        if (current == key) {
+          return &candidate;
+        }
+      }
+      return nullptr;
+    }
+
+    static void update_max(std::atomic<uint64_t> &target, uint64_t value) {
+      uint64_t current = target.load(std::memory_order_relaxed);
+      while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+      }
+    }
+
+    static std::string format_us(uint64_t ns) {
+      char buffer[32];
+      snprintf(buffer, sizeof(buffer), "%.1f", ns / 1000.0);
+      return buffer;
+    }
+
+  public:
+    /**
+     * @brief 생성자
+     *
+     * @param name 지표의 lock 라벨과 보고서에 쓸 이름, 예) "room"
+     */
+    explicit ProfiledMutex(const std::string &name)
+      : name(name),
+        acquisitions(MetricsRegistry::instance().counter("chat_lock_acquisitions_total", "락을 잡은 횟수", "lock=\"" + name + "\"")),
+        contended(MetricsRegistry::instance().counter("chat_lock_contended_total", "다른 쓰레드가 잡고 있어 기다린 횟수", "lock=\"" + name + "\"")),
+        wait_histogram(MetricsRegistry::instance().histogram("chat_lock_wait_seconds", "락을 잡기까지 기다린 시간", "lock=\"" + name + "\"", 1e-9)),
+        hold_histogram(MetricsRegistry::instance().histogram("chat_lock_hold_seconds", "락을 잡고 있던 시간", "lock=\"" + name + "\"", 1e-9)) {}
+
+    ProfiledMutex(const ProfiledMutex &) = delete;
+    ProfiledMutex &operator=(const ProfiledMutex &) = delete;
+
+    /**
+     * @brief 모든 ProfiledMutex 의 기록을 켜거나 끈다.
+     */
+    static void set_enabled(bool enabled) {
+      enabled_flag().store(enabled);
+    }
+
+    static bool enabled() {
+      return enabled_flag().load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 락을 잡는다. 기록 중이면 먼저 try_lock 해 보고 실패한 경우만 경합으로 센다.
+     *
+     * @param function 호출한 함수 이름, 문자열 리터럴이어야 한다
+     * @param line 호출한 줄
+     */
+    void lock(const char *function, int line) {
+      if (!enabled()) {
+        mutex.lock();
+        holder = nullptr;
+        return;
+      }
+
+      uint64_t wait = 0;
+      bool was_contended = !mutex.try_lock();
+      if (was_contended) {
+        uint64_t wait_start = metric_now_ns();
+        mutex.lock();
+        acquired_ns = metric_now_ns();
+        wait = acquired_ns - wait_start;
+      } else {
+        acquired_ns = metric_now_ns();
+      }
+
+      acquisitions.inc();
+      wait_histogram.observe(wait);
+      holder = site(function, line);
+      if (was_contended) {
+        contended.inc();
+      }
+      if (holder != nullptr) {
+        holder->acquisitions.fetch_add(1, std::memory_order_relaxed);
+        if (was_contended) {
+          holder->contended.fetch_add(1, std::memory_order_relaxed);
+          holder->wait_ns.fetch_add(wait, std::memory_order_relaxed);
+        }
+      }
+    }
+
+    void unlock() {
+      if (holder != nullptr) {
+        uint64_t hold = metric_now_ns() - acquired_ns;
+        hold_histogram.observe(hold);
+        holder->hold_ns.fetch_add(hold, std::memory_order_relaxed);
+        update_max(holder->max_hold_ns, hold);
+        holder = nullptr;
+      }
+      mutex.unlock();
+    }
+
+    /**
+     * @brief 호출 위치별 통계 표. 잡고 있던 시간의 합이 큰 위치부터 쓴다.
+     */
+    std::string report() {
+      struct Row {
+        std::string site;
+        uint64_t acquisitions, contended, wait_ns, hold_ns, max_hold_ns;
+      };
+      std::vector<Row> rows;
+      for (auto &entry : sites) {
+        const char *function = entry.function.load(std::memory_order_acquire);
+        if (function == nullptr) {
+          continue;
+        }
+        rows.push_back(Row {std::string(function) + ":" + std::to_string(entry.line.load(std::memory_order_relaxed)),
+                            entry.acquisitions.load(std::memory_order_relaxed), entry.contended.load(std::memory_order_relaxed),
+                            entry.wait_ns.load(std::memory_order_relaxed), entry.hold_ns.load(std::memory_order_relaxed),
+                            entry.max_hold_ns.load(std::memory_order_relaxed)});
+      }
+      std::sort(rows.begin(), rows.end(), [](const Row &a, const Row &b) {return a.hold_ns > b.hold_ns;});
+
+      HistogramSnapshot wait = wait_histogram.snapshot();
+      HistogramSnapshot hold = hold_histogram.snapshot();
+      std::string out = "lock " + name + ": acquisitions=" + std::to_string(acquisitions.value()) +
+                        " contended=" + std::to_string(contended.value()) +
+                        " wait p50/p99/max us=" + format_us(wait.quantile(0.5)) + "/" + format_us(wait.quantile(0.99)) + "/" + format_us(wait.quantile(1)) +
+                        " hold p50/p99/max us=" + format_us(hold.quantile(0.5)) + "/" + format_us(hold.quantile(0.99)) + "/" + format_us(hold.quantile(1)) + "\n";
+      if (!rows.empty()) {
+        const Row &longest = *std::max_element(rows.begin(), rows.end(), [](const Row &a, const Row &b) {return a.max_hold_ns < b.max_hold_ns;});
+        out += "  longest hold: " + longest.site + " " + format_us(longest.max_hold_ns) + " us\n";
+      }
+      out += "  site                                     acquired  contended    wait us    hold us   avg hold   max hold\n";
+      for (auto &row : rows) {
+        char line[256];
+        snprintf(line, sizeof(line), "  %-40s %8llu %10llu %10s %10s %10s %10s\n", row.site.c_str(), (unsigned long long) row.acquisitions,
+                 (unsigned long long) row.contended, format_us(row.wait_ns).c_str(), format_us(row.hold_ns).c_str(),
+                 format_us(row.acquisitions == 0 ? 0 : row.hold_ns / row.acquisitions).c_str(), format_us(row.max_hold_ns).c_str());
+        out += line;
+      }
+      return out;
+    }
+};
+
+/**
+ * @brief ProfiledMutex 를 범위 동안 잡는 RAII. unique_lock 처럼 condition_variable_any 와 함께 쓸 수 있다.
+ *
+ * 기본 인자로 만든 쪽의 함수 이름과 줄을 받아 호출 위치로 기록한다.
+ */
+class ProfiledLock {
+  private:
+    ProfiledMutex &mutex;
+    const char *function;
+    int line;
+    bool owns = false;
+
+  public:
+    explicit ProfiledLock(ProfiledMutex &mutex, const char *function = __builtin_FUNCTION(), int line = __builtin_LINE())
+      : mutex(mutex), function(function), line(line) {
+      lock();
+    }
+
+    ProfiledLock(const ProfiledLock &) = delete;
+    ProfiledLock &operator=(const ProfiledLock &) = delete;
+
+    ~ProfiledLock() {
+      if (owns) {
+        unlock();
+      }
+    }
+
+    void lock() {
+      mutex.lock(function, line);
+      owns = true;
+    }
+
+    void unlock() {
+      owns = false;
+      mutex.unlock();
+    }
+};
+
+#endif
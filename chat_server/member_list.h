@@ -0,0 +1,105 @@
+/**
+ * @file member_list.h
+ * @brief 방 멤버를 연속된 배열에 담는 목록
+ *
+ * 브로드캐스트는 방 멤버 전체를 처음부터 끝까지 훑는다. 멤버를 트리 노드나 Client 포인터 너머에 두면
+ * 멤버마다 캐시 미스가 나므로, 전송에 필요한 값(소켓, 포맷, 프레이밍)을 배열에 직접 담아 순서대로 읽게 한다.
+ *
+ * 삭제는 마지막 원소를 빈 자리로 옮기는 swap-remove 라 배열에 구멍이 생기지 않는다.
+ * 키 -> 위치 인덱스를 따로 두어 삭제할 원소를 O(1) 에 찾는다. 멤버의 순서는 유지되지 않는다.
+ */
+
+#ifndef CHAT_SERVER_MEMBER_LIST_H
+#define CHAT_SERVER_MEMBER_LIST_H
+
+#include <stdint.h>
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 정수 키(소켓 번호)로 찾을 수 있는 연속 배열 목록
+ *
+ * @tparam Value 멤버 하나의 값
+ */
+template <typename Value>
+class DenseMemberList {
+  private:
+    std::vector<Value> values; ///< 멤버 값들, 브로드캐스트가 훑는 배열
+    std::vector<int> keys; ///< values[i] 의 키
+    std::unordered_map<int, uint32_t> positions; ///< 키 -> values 안의 위치
+
+  public:
+    using iterator = typename std::vector<Value>::iterator;
+    using const_iterator = typename std::vector<Value>::const_iterator;
+
+    /**
+     * @brief 멤버를 추가. 이미 있으면 아무것도 하지 않는다.
+     *
+     * @param key 키
+     * @param value 값
+     * @return 새로 추가했으면 true
+     */
+    bool insert(int key, Value value) {
+      auto result = positions.emplace(key, static_cast<uint32_t>(values.size()));
+      if (!result.second) {
+        return false;
+      }
+      values.push_back(std::move(value));
+      keys.push_back(key);
+      return true;
+    }
+
+    /**
+     * @brief 멤버를 지운다. 마지막 멤버가 지운 자리로 옮겨진다.
+     *
+     * @param key 키
+     * @return 지웠으면 true
+     */
+    bool erase(int key) {
+      auto it = positions.find(key);
+      if (it == positions.end()) {
+        return false;
+      }
+      uint32_t position = it->second;
+      positions.erase(it);
+
+      uint32_t last = static_cast<uint32_t>(values.size() - 1);
+      if (position != last) {
+        values[position] = std::move(values[last]);
+        keys[position] = keys[last];
+        positions[keys[position]] = position;
+      }
+      values.pop_back();
+      keys.pop_back();
+      return true;
+    }
+
+    /**
+     * @brief key 의 값, 없으면 nullptr
+     */
+    Value *find(int key) {
+      auto it = positions.find(key);
+      return it == positions.end() ? nullptr : &values[it->second];
+    }
+
+    /**
+     * @brief 모든 멤버를 지운다.
+     */
+    void clear() {
+      values.clear();
+      keys.clear();
+      positions.clear();
+    }
+
+    //getter
+    size_t size() const {return values.size();}
+    bool empty() const {return values.empty();}
+    iterator begin() {return values.begin();}
+    iterator end() {return values.end();}
+    const_iterator begin() const {return values.begin();}
+    const_iterator end() const {return values.end();}
+};
+
+#endif
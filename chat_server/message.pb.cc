@@ -50,7 +50,13 @@ struct CSNameDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSNameDefaultTypeInternal _CSName_default_instance_;
 PROTOBUF_CONSTEXPR CSRooms::CSRooms(
-    ::_pbi::ConstantInitialized) {}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.titleprefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.limit_)*/0
+  , /*decltype(_impl_.sort_)*/0} {}
 struct CSRoomsDefaultTypeInternal {
   PROTOBUF_CONSTEXPR CSRoomsDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -60,6 +66,21 @@ struct CSRoomsDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSRoomsDefaultTypeInternal _CSRooms_default_instance_;
+PROTOBUF_CONSTEXPR CSSearchRooms::CSSearchRooms(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.query_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.limit_)*/0} {}
+struct CSSearchRoomsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSSearchRoomsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSSearchRoomsDefaultTypeInternal() {}
+  union {
+    CSSearchRooms _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSSearchRoomsDefaultTypeInternal _CSSearchRooms_default_instance_;
 PROTOBUF_CONSTEXPR CSCreateRoom::CSCreateRoom(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_._has_bits_)*/{}
@@ -89,7 +110,10 @@ struct CSJoinRoomDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSJoinRoomDefaultTypeInternal _CSJoinRoom_default_instance_;
 PROTOBUF_CONSTEXPR CSLeaveRoom::CSLeaveRoom(
-    ::_pbi::ConstantInitialized) {}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.roomid_)*/0} {}
 struct CSLeaveRoomDefaultTypeInternal {
   PROTOBUF_CONSTEXPR CSLeaveRoomDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -103,7 +127,8 @@ PROTOBUF_CONSTEXPR CSChat::CSChat(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_._has_bits_)*/{}
   , /*decltype(_impl_._cached_size_)*/{}
-  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.roomid_)*/0} {}
 struct CSChatDefaultTypeInternal {
   PROTOBUF_CONSTEXPR CSChatDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -156,8 +181,10 @@ struct SCRoomsResult_RoomInfoDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SCRoomsResult_RoomInfoDefaultTypeInternal _SCRoomsResult_RoomInfo_default_instance_;
 PROTOBUF_CONSTEXPR SCRoomsResult::SCRoomsResult(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.rooms_)*/{}
-  , /*decltype(_impl_._cached_size_)*/{}} {}
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.rooms_)*/{}
+  , /*decltype(_impl_.nextcursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
 struct SCRoomsResultDefaultTypeInternal {
   PROTOBUF_CONSTEXPR SCRoomsResultDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -214,7 +241,8 @@ PROTOBUF_CONSTEXPR SCChat::SCChat(
     /*decltype(_impl_._has_bits_)*/{}
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_.member_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.roomid_)*/0} {}
 struct SCChatDefaultTypeInternal {
   PROTOBUF_CONSTEXPR SCChatDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -238,9 +266,50 @@ struct SCSystemMessageDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SCSystemMessageDefaultTypeInternal _SCSystemMessage_default_instance_;
+PROTOBUF_CONSTEXPR BatchEntry::BatchEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/0} {}
+struct BatchEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchEntryDefaultTypeInternal() {}
+  union {
+    BatchEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchEntryDefaultTypeInternal _BatchEntry_default_instance_;
+PROTOBUF_CONSTEXPR CSBatch::CSBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CSBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CSBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CSBatchDefaultTypeInternal() {}
+  union {
+    CSBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CSBatchDefaultTypeInternal _CSBatch_default_instance_;
+PROTOBUF_CONSTEXPR SCBatch::SCBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SCBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SCBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SCBatchDefaultTypeInternal() {}
+  union {
+    SCBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SCBatchDefaultTypeInternal _SCBatch_default_instance_;
 }  // namespace mju
-static ::_pb::Metadata file_level_metadata_message_2eproto[16];
-static const ::_pb::EnumDescriptor* file_level_enum_descriptors_message_2eproto[1];
+static ::_pb::Metadata file_level_metadata_message_2eproto[20];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_message_2eproto[2];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_message_2eproto = nullptr;
 
 const uint32_t TableStruct_message_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -260,12 +329,30 @@ const uint32_t TableStruct_message_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::mju::CSName, _impl_.name_),
   0,
-  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mju::CSRooms, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::mju::CSRooms, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mju::CSRooms, _impl_.cursor_),
+  PROTOBUF_FIELD_OFFSET(::mju::CSRooms, _impl_.limit_),
+  PROTOBUF_FIELD_OFFSET(::mju::CSRooms, _impl_.titleprefix_),
+  PROTOBUF_FIELD_OFFSET(::mju::CSRooms, _impl_.sort_),
+  0,
+  2,
+  1,
+  3,
+  PROTOBUF_FIELD_OFFSET(::mju::CSSearchRooms, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::mju::CSSearchRooms, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mju::CSSearchRooms, _impl_.query_),
+  PROTOBUF_FIELD_OFFSET(::mju::CSSearchRooms, _impl_.limit_),
+  0,
+  1,
   PROTOBUF_FIELD_OFFSET(::mju::CSCreateRoom, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::mju::CSCreateRoom, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -282,12 +369,14 @@ const uint32_t TableStruct_message_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::mju::CSJoinRoom, _impl_.roomid_),
   0,
-  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mju::CSLeaveRoom, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::mju::CSLeaveRoom, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mju::CSLeaveRoom, _impl_.roomid_),
+  0,
   PROTOBUF_FIELD_OFFSET(::mju::CSChat, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::mju::CSChat, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -295,7 +384,9 @@ const uint32_t TableStruct_message_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::mju::CSChat, _impl_.text_),
+  PROTOBUF_FIELD_OFFSET(::mju::CSChat, _impl_.roomid_),
   0,
+  1,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::mju::CSShutdown, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -322,13 +413,16 @@ const uint32_t TableStruct_message_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   1,
   0,
   ~0u,
-  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mju::SCRoomsResult, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::mju::SCRoomsResult, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::mju::SCRoomsResult, _impl_.rooms_),
+  PROTOBUF_FIELD_OFFSET(::mju::SCRoomsResult, _impl_.nextcursor_),
+  ~0u,
+  0,
   PROTOBUF_FIELD_OFFSET(::mju::SCCreateRoomResult, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::mju::SCCreateRoomResult, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -361,8 +455,10 @@ const uint32_t TableStruct_message_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::mju::SCChat, _impl_.member_),
   PROTOBUF_FIELD_OFFSET(::mju::SCChat, _impl_.text_),
+  PROTOBUF_FIELD_OFFSET(::mju::SCChat, _impl_.roomid_),
   0,
   1,
+  2,
   PROTOBUF_FIELD_OFFSET(::mju::SCSystemMessage, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::mju::SCSystemMessage, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -371,30 +467,59 @@ const uint32_t TableStruct_message_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::mju::SCSystemMessage, _impl_.text_),
   0,
+  PROTOBUF_FIELD_OFFSET(::mju::BatchEntry, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::mju::BatchEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mju::BatchEntry, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::mju::BatchEntry, _impl_.body_),
+  1,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mju::CSBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mju::CSBatch, _impl_.messages_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mju::SCBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::mju::SCBatch, _impl_.messages_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, 7, -1, sizeof(::mju::Type)},
   { 8, 15, -1, sizeof(::mju::CSName)},
-  { 16, -1, -1, sizeof(::mju::CSRooms)},
-  { 22, 29, -1, sizeof(::mju::CSCreateRoom)},
-  { 30, 37, -1, sizeof(::mju::CSJoinRoom)},
-  { 38, -1, -1, sizeof(::mju::CSLeaveRoom)},
-  { 44, 51, -1, sizeof(::mju::CSChat)},
-  { 52, -1, -1, sizeof(::mju::CSShutdown)},
-  { 58, 65, -1, sizeof(::mju::SCNameResult)},
-  { 66, 75, -1, sizeof(::mju::SCRoomsResult_RoomInfo)},
-  { 78, -1, -1, sizeof(::mju::SCRoomsResult)},
-  { 85, 92, -1, sizeof(::mju::SCCreateRoomResult)},
-  { 93, 100, -1, sizeof(::mju::SCJoinRoomResult)},
-  { 101, 108, -1, sizeof(::mju::SCLeaveRoomResult)},
-  { 109, 117, -1, sizeof(::mju::SCChat)},
-  { 119, 126, -1, sizeof(::mju::SCSystemMessage)},
+  { 16, 26, -1, sizeof(::mju::CSRooms)},
+  { 30, 38, -1, sizeof(::mju::CSSearchRooms)},
+  { 40, 47, -1, sizeof(::mju::CSCreateRoom)},
+  { 48, 55, -1, sizeof(::mju::CSJoinRoom)},
+  { 56, 63, -1, sizeof(::mju::CSLeaveRoom)},
+  { 64, 72, -1, sizeof(::mju::CSChat)},
+  { 74, -1, -1, sizeof(::mju::CSShutdown)},
+  { 80, 87, -1, sizeof(::mju::SCNameResult)},
+  { 88, 97, -1, sizeof(::mju::SCRoomsResult_RoomInfo)},
+  { 100, 108, -1, sizeof(::mju::SCRoomsResult)},
+  { 110, 117, -1, sizeof(::mju::SCCreateRoomResult)},
+  { 118, 125, -1, sizeof(::mju::SCJoinRoomResult)},
+  { 126, 133, -1, sizeof(::mju::SCLeaveRoomResult)},
+  { 134, 143, -1, sizeof(::mju::SCChat)},
+  { 146, 153, -1, sizeof(::mju::SCSystemMessage)},
+  { 154, 162, -1, sizeof(::mju::BatchEntry)},
+  { 164, -1, -1, sizeof(::mju::CSBatch)},
+  { 171, -1, -1, sizeof(::mju::SCBatch)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::mju::_Type_default_instance_._instance,
   &::mju::_CSName_default_instance_._instance,
   &::mju::_CSRooms_default_instance_._instance,
+  &::mju::_CSSearchRooms_default_instance_._instance,
   &::mju::_CSCreateRoom_default_instance_._instance,
   &::mju::_CSJoinRoom_default_instance_._instance,
   &::mju::_CSLeaveRoom_default_instance_._instance,
@@ -408,34 +533,48 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::mju::_SCLeaveRoomResult_default_instance_._instance,
   &::mju::_SCChat_default_instance_._instance,
   &::mju::_SCSystemMessage_default_instance_._instance,
+  &::mju::_BatchEntry_default_instance_._instance,
+  &::mju::_CSBatch_default_instance_._instance,
+  &::mju::_SCBatch_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_message_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\rmessage.proto\022\003mju\"\346\001\n\004Type\022#\n\004type\030\001 "
-  "\002(\0162\025.mju.Type.MessageType\"\270\001\n\013MessageTy"
+  "\n\rmessage.proto\022\003mju\"\227\002\n\004Type\022#\n\004type\030\001 "
+  "\002(\0162\025.mju.Type.MessageType\"\351\001\n\013MessageTy"
   "pe\022\013\n\007CS_NAME\020\000\022\014\n\010CS_ROOMS\020\001\022\022\n\016CS_CREA"
   "TE_ROOM\020\002\022\020\n\014CS_JOIN_ROOM\020\003\022\021\n\rCS_LEAVE_"
-  "ROOM\020\004\022\013\n\007CS_CHAT\020\005\022\017\n\013CS_SHUTDOWN\020\006\022\023\n\017"
-  "SC_ROOMS_RESULT\020\007\022\013\n\007SC_CHAT\020\010\022\025\n\021SC_SYS"
-  "TEM_MESSAGE\020\t\"\026\n\006CSName\022\014\n\004name\030\001 \002(\t\"\t\n"
-  "\007CSRooms\"\035\n\014CSCreateRoom\022\r\n\005title\030\001 \001(\t\""
-  "\034\n\nCSJoinRoom\022\016\n\006roomId\030\001 \002(\005\"\r\n\013CSLeave"
-  "Room\"\026\n\006CSChat\022\014\n\004text\030\001 \002(\t\"\014\n\nCSShutdo"
-  "wn\"\035\n\014SCNameResult\022\r\n\005error\030\001 \001(\t\"w\n\rSCR"
-  "oomsResult\022*\n\005rooms\030\001 \003(\0132\033.mju.SCRoomsR"
-  "esult.RoomInfo\032:\n\010RoomInfo\022\016\n\006roomId\030\001 \002"
-  "(\005\022\r\n\005title\030\002 \001(\t\022\017\n\007members\030\003 \003(\t\"#\n\022SC"
-  "CreateRoomResult\022\r\n\005error\030\001 \001(\t\"!\n\020SCJoi"
-  "nRoomResult\022\r\n\005error\030\001 \001(\t\"\"\n\021SCLeaveRoo"
-  "mResult\022\r\n\005error\030\001 \001(\t\"&\n\006SCChat\022\016\n\006memb"
-  "er\030\001 \002(\t\022\014\n\004text\030\002 \002(\t\"\037\n\017SCSystemMessag"
-  "e\022\014\n\004text\030\001 \002(\t"
+  "ROOM\020\004\022\013\n\007CS_CHAT\020\005\022\017\n\013CS_SHUTDOWN\020\006\022\014\n\010"
+  "CS_BATCH\020\n\022\023\n\017CS_SEARCH_ROOMS\020\014\022\023\n\017SC_RO"
+  "OMS_RESULT\020\007\022\013\n\007SC_CHAT\020\010\022\025\n\021SC_SYSTEM_M"
+  "ESSAGE\020\t\022\014\n\010SC_BATCH\020\013\"\026\n\006CSName\022\014\n\004name"
+  "\030\001 \002(\t\"\211\001\n\007CSRooms\022\016\n\006cursor\030\001 \001(\t\022\r\n\005li"
+  "mit\030\002 \001(\005\022\023\n\013titlePrefix\030\003 \001(\t\022\037\n\004sort\030\004"
+  " \001(\0162\021.mju.CSRooms.Sort\")\n\004Sort\022\006\n\002ID\020\000\022"
+  "\013\n\007MEMBERS\020\001\022\014\n\010ACTIVITY\020\002\"-\n\rCSSearchRo"
+  "oms\022\r\n\005query\030\001 \002(\t\022\r\n\005limit\030\002 \001(\005\"\035\n\014CSC"
+  "reateRoom\022\r\n\005title\030\001 \001(\t\"\034\n\nCSJoinRoom\022\016"
+  "\n\006roomId\030\001 \002(\005\"\035\n\013CSLeaveRoom\022\016\n\006roomId\030"
+  "\001 \001(\005\"&\n\006CSChat\022\014\n\004text\030\001 \002(\t\022\016\n\006roomId\030"
+  "\002 \001(\005\"\014\n\nCSShutdown\"\035\n\014SCNameResult\022\r\n\005e"
+  "rror\030\001 \001(\t\"\213\001\n\rSCRoomsResult\022*\n\005rooms\030\001 "
+  "\003(\0132\033.mju.SCRoomsResult.RoomInfo\022\022\n\nnext"
+  "Cursor\030\002 \001(\t\032:\n\010RoomInfo\022\016\n\006roomId\030\001 \002(\005"
+  "\022\r\n\005title\030\002 \001(\t\022\017\n\007members\030\003 \003(\t\"#\n\022SCCr"
+  "eateRoomResult\022\r\n\005error\030\001 \001(\t\"!\n\020SCJoinR"
+  "oomResult\022\r\n\005error\030\001 \001(\t\"\"\n\021SCLeaveRoomR"
+  "esult\022\r\n\005error\030\001 \001(\t\"6\n\006SCChat\022\016\n\006member"
+  "\030\001 \002(\t\022\014\n\004text\030\002 \002(\t\022\016\n\006roomId\030\003 \001(\005\"\037\n\017"
+  "SCSystemMessage\022\014\n\004text\030\001 \002(\t\"\?\n\nBatchEn"
+  "try\022#\n\004type\030\001 \002(\0162\025.mju.Type.MessageType"
+  "\022\014\n\004body\030\002 \001(\014\",\n\007CSBatch\022!\n\010messages\030\001 "
+  "\003(\0132\017.mju.BatchEntry\",\n\007SCBatch\022!\n\010messa"
+  "ges\030\001 \003(\0132\017.mju.BatchEntry"
   ;
 static ::_pbi::once_flag descriptor_table_message_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_message_2eproto = {
-    false, false, 735, descriptor_table_protodef_message_2eproto,
+    false, false, 1186, descriptor_table_protodef_message_2eproto,
     "message.proto",
-    &descriptor_table_message_2eproto_once, nullptr, 0, 16,
+    &descriptor_table_message_2eproto_once, nullptr, 0, 20,
     schemas, file_default_instances, TableStruct_message_2eproto::offsets,
     file_level_metadata_message_2eproto, file_level_enum_descriptors_message_2eproto,
     file_level_service_descriptors_message_2eproto,
@@ -463,6 +602,9 @@ bool Type_MessageType_IsValid(int value) {
     case 7:
     case 8:
     case 9:
+    case 10:
+    case 11:
+    case 12:
       return true;
     default:
       return false;
@@ -477,13 +619,39 @@ constexpr Type_MessageType Type::CS_JOIN_ROOM;
 constexpr Type_MessageType Type::CS_LEAVE_ROOM;
 constexpr Type_MessageType Type::CS_CHAT;
 constexpr Type_MessageType Type::CS_SHUTDOWN;
+constexpr Type_MessageType Type::CS_BATCH;
+constexpr Type_MessageType Type::CS_SEARCH_ROOMS;
 constexpr Type_MessageType Type::SC_ROOMS_RESULT;
 constexpr Type_MessageType Type::SC_CHAT;
 constexpr Type_MessageType Type::SC_SYSTEM_MESSAGE;
+constexpr Type_MessageType Type::SC_BATCH;
 constexpr Type_MessageType Type::MessageType_MIN;
 constexpr Type_MessageType Type::MessageType_MAX;
 constexpr int Type::MessageType_ARRAYSIZE;
 #endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CSRooms_Sort_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_message_2eproto);
+  return file_level_enum_descriptors_message_2eproto[1];
+}
+bool CSRooms_Sort_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr CSRooms_Sort CSRooms::ID;
+constexpr CSRooms_Sort CSRooms::MEMBERS;
+constexpr CSRooms_Sort CSRooms::ACTIVITY;
+constexpr CSRooms_Sort CSRooms::Sort_MIN;
+constexpr CSRooms_Sort CSRooms::Sort_MAX;
+constexpr int CSRooms::Sort_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
@@ -910,95 +1078,85 @@ void CSName::InternalSwap(CSName* other) {
 
 class CSRooms::_Internal {
  public:
-};
-
-CSRooms::CSRooms(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:mju.CSRooms)
-}
-CSRooms::CSRooms(const CSRooms& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  CSRooms* const _this = this; (void)_this;
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:mju.CSRooms)
-}
-
-
-
-
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSRooms::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSRooms::GetClassData() const { return &_class_data_; }
-
-
-
-
-
-
-
-::PROTOBUF_NAMESPACE_ID::Metadata CSRooms::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
-      file_level_metadata_message_2eproto[2]);
-}
-
-// ===================================================================
-
-class CSCreateRoom::_Internal {
- public:
-  using HasBits = decltype(std::declval<CSCreateRoom>()._impl_._has_bits_);
-  static void set_has_title(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<CSRooms>()._impl_._has_bits_);
+  static void set_has_cursor(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_limit(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_titleprefix(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_sort(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
 };
 
-CSCreateRoom::CSCreateRoom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+CSRooms::CSRooms(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mju.CSCreateRoom)
+  // @@protoc_insertion_point(arena_constructor:mju.CSRooms)
 }
-CSCreateRoom::CSCreateRoom(const CSCreateRoom& from)
+CSRooms::CSRooms(const CSRooms& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  CSCreateRoom* const _this = this; (void)_this;
+  CSRooms* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.title_){}};
+    , decltype(_impl_.cursor_){}
+    , decltype(_impl_.titleprefix_){}
+    , decltype(_impl_.limit_){}
+    , decltype(_impl_.sort_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.title_.InitDefault();
+  _impl_.cursor_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.title_.Set("", GetArenaForAllocation());
+    _impl_.cursor_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_title()) {
-    _this->_impl_.title_.Set(from._internal_title(), 
+  if (from._internal_has_cursor()) {
+    _this->_impl_.cursor_.Set(from._internal_cursor(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:mju.CSCreateRoom)
+  _impl_.titleprefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.titleprefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_titleprefix()) {
+    _this->_impl_.titleprefix_.Set(from._internal_titleprefix(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.limit_, &from._impl_.limit_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sort_) -
+    reinterpret_cast<char*>(&_impl_.limit_)) + sizeof(_impl_.sort_));
+  // @@protoc_insertion_point(copy_constructor:mju.CSRooms)
 }
 
-inline void CSCreateRoom::SharedCtor(
+inline void CSRooms::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.title_){}
+    , decltype(_impl_.cursor_){}
+    , decltype(_impl_.titleprefix_){}
+    , decltype(_impl_.limit_){0}
+    , decltype(_impl_.sort_){0}
   };
-  _impl_.title_.InitDefault();
+  _impl_.cursor_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.title_.Set("", GetArenaForAllocation());
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.titleprefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.titleprefix_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-CSCreateRoom::~CSCreateRoom() {
-  // @@protoc_insertion_point(destructor:mju.CSCreateRoom)
+CSRooms::~CSRooms() {
+  // @@protoc_insertion_point(destructor:mju.CSRooms)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1006,48 +1164,93 @@ CSCreateRoom::~CSCreateRoom() {
   SharedDtor();
 }
 
-inline void CSCreateRoom::SharedDtor() {
+inline void CSRooms::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.title_.Destroy();
+  _impl_.cursor_.Destroy();
+  _impl_.titleprefix_.Destroy();
 }
 
-void CSCreateRoom::SetCachedSize(int size) const {
+void CSRooms::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void CSCreateRoom::Clear() {
-// @@protoc_insertion_point(message_clear_start:mju.CSCreateRoom)
+void CSRooms::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.CSRooms)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.title_.ClearNonDefaultToEmpty();
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.cursor_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.titleprefix_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.limit_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.sort_) -
+        reinterpret_cast<char*>(&_impl_.limit_)) + sizeof(_impl_.sort_));
   }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* CSCreateRoom::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CSRooms::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // optional string title = 1;
+      // optional string cursor = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_title();
+          auto str = _internal_mutable_cursor();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
           #ifndef NDEBUG
-          ::_pbi::VerifyUTF8(str, "mju.CSCreateRoom.title");
+          ::_pbi::VerifyUTF8(str, "mju.CSRooms.cursor");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 limit = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_limit(&has_bits);
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string titlePrefix = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_titleprefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "mju.CSRooms.titlePrefix");
           #endif  // !NDEBUG
         } else
           goto handle_unusual;
         continue;
+      // optional .mju.CSRooms.Sort sort = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::mju::CSRooms_Sort_IsValid(val))) {
+            _internal_set_sort(static_cast<::mju::CSRooms_Sort>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(4, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1072,145 +1275,228 @@ failure:
 #undef CHK_
 }
 
-uint8_t* CSCreateRoom::_InternalSerialize(
+uint8_t* CSRooms::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mju.CSCreateRoom)
+  // @@protoc_insertion_point(serialize_to_array_start:mju.CSRooms)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  // optional string title = 1;
+  // optional string cursor = 1;
   if (cached_has_bits & 0x00000001u) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->_internal_title().data(), static_cast<int>(this->_internal_title().length()),
+      this->_internal_cursor().data(), static_cast<int>(this->_internal_cursor().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
-      "mju.CSCreateRoom.title");
+      "mju.CSRooms.cursor");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_title(), target);
+        1, this->_internal_cursor(), target);
+  }
+
+  // optional int32 limit = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_limit(), target);
+  }
+
+  // optional string titlePrefix = 3;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_titleprefix().data(), static_cast<int>(this->_internal_titleprefix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "mju.CSRooms.titlePrefix");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_titleprefix(), target);
+  }
+
+  // optional .mju.CSRooms.Sort sort = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_sort(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mju.CSCreateRoom)
+  // @@protoc_insertion_point(serialize_to_array_end:mju.CSRooms)
   return target;
 }
 
-size_t CSCreateRoom::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mju.CSCreateRoom)
+size_t CSRooms::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.CSRooms)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // optional string title = 1;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_title());
-  }
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string cursor = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_cursor());
+    }
+
+    // optional string titlePrefix = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_titleprefix());
+    }
 
+    // optional int32 limit = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_limit());
+    }
+
+    // optional .mju.CSRooms.Sort sort = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_sort());
+    }
+
+  }
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSCreateRoom::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSRooms::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    CSCreateRoom::MergeImpl
+    CSRooms::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSCreateRoom::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSRooms::GetClassData() const { return &_class_data_; }
 
 
-void CSCreateRoom::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<CSCreateRoom*>(&to_msg);
-  auto& from = static_cast<const CSCreateRoom&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mju.CSCreateRoom)
+void CSRooms::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSRooms*>(&to_msg);
+  auto& from = static_cast<const CSRooms&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.CSRooms)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_title()) {
-    _this->_internal_set_title(from._internal_title());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_cursor(from._internal_cursor());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_titleprefix(from._internal_titleprefix());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.limit_ = from._impl_.limit_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.sort_ = from._impl_.sort_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CSCreateRoom::CopyFrom(const CSCreateRoom& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mju.CSCreateRoom)
+void CSRooms::CopyFrom(const CSRooms& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.CSRooms)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CSCreateRoom::IsInitialized() const {
+bool CSRooms::IsInitialized() const {
   return true;
 }
 
-void CSCreateRoom::InternalSwap(CSCreateRoom* other) {
+void CSRooms::InternalSwap(CSRooms* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.title_, lhs_arena,
-      &other->_impl_.title_, rhs_arena
+      &_impl_.cursor_, lhs_arena,
+      &other->_impl_.cursor_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.titleprefix_, lhs_arena,
+      &other->_impl_.titleprefix_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CSRooms, _impl_.sort_)
+      + sizeof(CSRooms::_impl_.sort_)
+      - PROTOBUF_FIELD_OFFSET(CSRooms, _impl_.limit_)>(
+          reinterpret_cast<char*>(&_impl_.limit_),
+          reinterpret_cast<char*>(&other->_impl_.limit_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata CSCreateRoom::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CSRooms::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
-      file_level_metadata_message_2eproto[3]);
+      file_level_metadata_message_2eproto[2]);
 }
 
 // ===================================================================
 
-class CSJoinRoom::_Internal {
+class CSSearchRooms::_Internal {
  public:
-  using HasBits = decltype(std::declval<CSJoinRoom>()._impl_._has_bits_);
-  static void set_has_roomid(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<CSSearchRooms>()._impl_._has_bits_);
+  static void set_has_query(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_limit(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
   static bool MissingRequiredFields(const HasBits& has_bits) {
     return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
   }
 };
 
-CSJoinRoom::CSJoinRoom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+CSSearchRooms::CSSearchRooms(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mju.CSJoinRoom)
+  // @@protoc_insertion_point(arena_constructor:mju.CSSearchRooms)
 }
-CSJoinRoom::CSJoinRoom(const CSJoinRoom& from)
+CSSearchRooms::CSSearchRooms(const CSSearchRooms& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  CSJoinRoom* const _this = this; (void)_this;
+  CSSearchRooms* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.roomid_){}};
+    , decltype(_impl_.query_){}
+    , decltype(_impl_.limit_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.roomid_ = from._impl_.roomid_;
-  // @@protoc_insertion_point(copy_constructor:mju.CSJoinRoom)
+  _impl_.query_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.query_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_query()) {
+    _this->_impl_.query_.Set(from._internal_query(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.limit_ = from._impl_.limit_;
+  // @@protoc_insertion_point(copy_constructor:mju.CSSearchRooms)
 }
 
-inline void CSJoinRoom::SharedCtor(
+inline void CSSearchRooms::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.roomid_){0}
+    , decltype(_impl_.query_){}
+    , decltype(_impl_.limit_){0}
   };
+  _impl_.query_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.query_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-CSJoinRoom::~CSJoinRoom() {
-  // @@protoc_insertion_point(destructor:mju.CSJoinRoom)
+CSSearchRooms::~CSSearchRooms() {
+  // @@protoc_insertion_point(destructor:mju.CSSearchRooms)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1218,37 +1504,54 @@ CSJoinRoom::~CSJoinRoom() {
   SharedDtor();
 }
 
-inline void CSJoinRoom::SharedDtor() {
+inline void CSSearchRooms::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.query_.Destroy();
 }
 
-void CSJoinRoom::SetCachedSize(int size) const {
+void CSSearchRooms::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void CSJoinRoom::Clear() {
-// @@protoc_insertion_point(message_clear_start:mju.CSJoinRoom)
+void CSSearchRooms::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.CSSearchRooms)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.roomid_ = 0;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.query_.ClearNonDefaultToEmpty();
+  }
+  _impl_.limit_ = 0;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* CSJoinRoom::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CSSearchRooms::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // required int32 roomId = 1;
+      // required string query = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _Internal::set_has_roomid(&has_bits);
-          _impl_.roomid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_query();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "mju.CSSearchRooms.query");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 limit = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_limit(&has_bits);
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1277,184 +1580,172 @@ failure:
 #undef CHK_
 }
 
-uint8_t* CSJoinRoom::_InternalSerialize(
+uint8_t* CSSearchRooms::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mju.CSJoinRoom)
+  // @@protoc_insertion_point(serialize_to_array_start:mju.CSSearchRooms)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  // required int32 roomId = 1;
+  // required string query = 1;
   if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_query().data(), static_cast<int>(this->_internal_query().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "mju.CSSearchRooms.query");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_query(), target);
+  }
+
+  // optional int32 limit = 2;
+  if (cached_has_bits & 0x00000002u) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_roomid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_limit(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mju.CSJoinRoom)
+  // @@protoc_insertion_point(serialize_to_array_end:mju.CSSearchRooms)
   return target;
 }
 
-size_t CSJoinRoom::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mju.CSJoinRoom)
+size_t CSSearchRooms::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.CSSearchRooms)
   size_t total_size = 0;
 
-  // required int32 roomId = 1;
-  if (_internal_has_roomid()) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_roomid());
+  // required string query = 1;
+  if (_internal_has_query()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_query());
   }
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // optional int32 limit = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_limit());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSJoinRoom::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSSearchRooms::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    CSJoinRoom::MergeImpl
+    CSSearchRooms::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSJoinRoom::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSSearchRooms::GetClassData() const { return &_class_data_; }
 
 
-void CSJoinRoom::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<CSJoinRoom*>(&to_msg);
-  auto& from = static_cast<const CSJoinRoom&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mju.CSJoinRoom)
+void CSSearchRooms::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSSearchRooms*>(&to_msg);
+  auto& from = static_cast<const CSSearchRooms&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.CSSearchRooms)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_roomid()) {
-    _this->_internal_set_roomid(from._internal_roomid());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_query(from._internal_query());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.limit_ = from._impl_.limit_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CSJoinRoom::CopyFrom(const CSJoinRoom& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mju.CSJoinRoom)
+void CSSearchRooms::CopyFrom(const CSSearchRooms& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.CSSearchRooms)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CSJoinRoom::IsInitialized() const {
+bool CSSearchRooms::IsInitialized() const {
   if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CSJoinRoom::InternalSwap(CSJoinRoom* other) {
+void CSSearchRooms::InternalSwap(CSSearchRooms* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.roomid_, other->_impl_.roomid_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata CSJoinRoom::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
-      file_level_metadata_message_2eproto[4]);
-}
-
-// ===================================================================
-
-class CSLeaveRoom::_Internal {
- public:
-};
-
-CSLeaveRoom::CSLeaveRoom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:mju.CSLeaveRoom)
-}
-CSLeaveRoom::CSLeaveRoom(const CSLeaveRoom& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  CSLeaveRoom* const _this = this; (void)_this;
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:mju.CSLeaveRoom)
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.query_, lhs_arena,
+      &other->_impl_.query_, rhs_arena
+  );
+  swap(_impl_.limit_, other->_impl_.limit_);
 }
 
-
-
-
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSLeaveRoom::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSLeaveRoom::GetClassData() const { return &_class_data_; }
-
-
-
-
-
-
-
-::PROTOBUF_NAMESPACE_ID::Metadata CSLeaveRoom::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CSSearchRooms::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
-      file_level_metadata_message_2eproto[5]);
+      file_level_metadata_message_2eproto[3]);
 }
 
 // ===================================================================
 
-class CSChat::_Internal {
+class CSCreateRoom::_Internal {
  public:
-  using HasBits = decltype(std::declval<CSChat>()._impl_._has_bits_);
-  static void set_has_text(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<CSCreateRoom>()._impl_._has_bits_);
+  static void set_has_title(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
-  }
 };
 
-CSChat::CSChat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+CSCreateRoom::CSCreateRoom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mju.CSChat)
+  // @@protoc_insertion_point(arena_constructor:mju.CSCreateRoom)
 }
-CSChat::CSChat(const CSChat& from)
+CSCreateRoom::CSCreateRoom(const CSCreateRoom& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  CSChat* const _this = this; (void)_this;
+  CSCreateRoom* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.text_){}};
+    , decltype(_impl_.title_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.text_.InitDefault();
+  _impl_.title_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.text_.Set("", GetArenaForAllocation());
+    _impl_.title_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_text()) {
-    _this->_impl_.text_.Set(from._internal_text(), 
+  if (from._internal_has_title()) {
+    _this->_impl_.title_.Set(from._internal_title(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:mju.CSChat)
+  // @@protoc_insertion_point(copy_constructor:mju.CSCreateRoom)
 }
 
-inline void CSChat::SharedCtor(
+inline void CSCreateRoom::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.text_){}
+    , decltype(_impl_.title_){}
   };
-  _impl_.text_.InitDefault();
+  _impl_.title_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.text_.Set("", GetArenaForAllocation());
+    _impl_.title_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-CSChat::~CSChat() {
-  // @@protoc_insertion_point(destructor:mju.CSChat)
+CSCreateRoom::~CSCreateRoom() {
+  // @@protoc_insertion_point(destructor:mju.CSCreateRoom)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1462,44 +1753,44 @@ CSChat::~CSChat() {
   SharedDtor();
 }
 
-inline void CSChat::SharedDtor() {
+inline void CSCreateRoom::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.text_.Destroy();
+  _impl_.title_.Destroy();
 }
 
-void CSChat::SetCachedSize(int size) const {
+void CSCreateRoom::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void CSChat::Clear() {
-// @@protoc_insertion_point(message_clear_start:mju.CSChat)
+void CSCreateRoom::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.CSCreateRoom)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
-    _impl_.text_.ClearNonDefaultToEmpty();
+    _impl_.title_.ClearNonDefaultToEmpty();
   }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* CSChat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CSCreateRoom::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // required string text = 1;
+      // optional string title = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_text();
+          auto str = _internal_mutable_title();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
           #ifndef NDEBUG
-          ::_pbi::VerifyUTF8(str, "mju.CSChat.text");
+          ::_pbi::VerifyUTF8(str, "mju.CSCreateRoom.title");
           #endif  // !NDEBUG
         } else
           goto handle_unusual;
@@ -1528,192 +1819,145 @@ failure:
 #undef CHK_
 }
 
-uint8_t* CSChat::_InternalSerialize(
+uint8_t* CSCreateRoom::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mju.CSChat)
+  // @@protoc_insertion_point(serialize_to_array_start:mju.CSCreateRoom)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  // required string text = 1;
+  // optional string title = 1;
   if (cached_has_bits & 0x00000001u) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      this->_internal_title().data(), static_cast<int>(this->_internal_title().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
-      "mju.CSChat.text");
+      "mju.CSCreateRoom.title");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_text(), target);
+        1, this->_internal_title(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mju.CSChat)
+  // @@protoc_insertion_point(serialize_to_array_end:mju.CSCreateRoom)
   return target;
 }
 
-size_t CSChat::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mju.CSChat)
+size_t CSCreateRoom::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.CSCreateRoom)
   size_t total_size = 0;
 
-  // required string text = 1;
-  if (_internal_has_text()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_text());
-  }
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // optional string title = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_title());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSChat::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSCreateRoom::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    CSChat::MergeImpl
+    CSCreateRoom::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSChat::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSCreateRoom::GetClassData() const { return &_class_data_; }
 
 
-void CSChat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<CSChat*>(&to_msg);
-  auto& from = static_cast<const CSChat&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mju.CSChat)
+void CSCreateRoom::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSCreateRoom*>(&to_msg);
+  auto& from = static_cast<const CSCreateRoom&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.CSCreateRoom)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_text()) {
-    _this->_internal_set_text(from._internal_text());
-  }
+  if (from._internal_has_title()) {
+    _this->_internal_set_title(from._internal_title());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CSChat::CopyFrom(const CSChat& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mju.CSChat)
+void CSCreateRoom::CopyFrom(const CSCreateRoom& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.CSCreateRoom)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CSChat::IsInitialized() const {
-  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+bool CSCreateRoom::IsInitialized() const {
   return true;
 }
 
-void CSChat::InternalSwap(CSChat* other) {
+void CSCreateRoom::InternalSwap(CSCreateRoom* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.text_, lhs_arena,
-      &other->_impl_.text_, rhs_arena
+      &_impl_.title_, lhs_arena,
+      &other->_impl_.title_, rhs_arena
   );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata CSChat::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
-      file_level_metadata_message_2eproto[6]);
-}
-
-// ===================================================================
-
-class CSShutdown::_Internal {
- public:
-};
-
-CSShutdown::CSShutdown(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:mju.CSShutdown)
-}
-CSShutdown::CSShutdown(const CSShutdown& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  CSShutdown* const _this = this; (void)_this;
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:mju.CSShutdown)
-}
-
-
-
-
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSShutdown::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSShutdown::GetClassData() const { return &_class_data_; }
-
-
-
-
-
-
-
-::PROTOBUF_NAMESPACE_ID::Metadata CSShutdown::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CSCreateRoom::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
-      file_level_metadata_message_2eproto[7]);
+      file_level_metadata_message_2eproto[4]);
 }
 
 // ===================================================================
 
-class SCNameResult::_Internal {
+class CSJoinRoom::_Internal {
  public:
-  using HasBits = decltype(std::declval<SCNameResult>()._impl_._has_bits_);
-  static void set_has_error(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<CSJoinRoom>()._impl_._has_bits_);
+  static void set_has_roomid(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
 };
 
-SCNameResult::SCNameResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+CSJoinRoom::CSJoinRoom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mju.SCNameResult)
+  // @@protoc_insertion_point(arena_constructor:mju.CSJoinRoom)
 }
-SCNameResult::SCNameResult(const SCNameResult& from)
+CSJoinRoom::CSJoinRoom(const CSJoinRoom& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SCNameResult* const _this = this; (void)_this;
+  CSJoinRoom* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.error_){}};
+    , decltype(_impl_.roomid_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.error_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.error_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_error()) {
-    _this->_impl_.error_.Set(from._internal_error(), 
-      _this->GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:mju.SCNameResult)
+  _this->_impl_.roomid_ = from._impl_.roomid_;
+  // @@protoc_insertion_point(copy_constructor:mju.CSJoinRoom)
 }
 
-inline void SCNameResult::SharedCtor(
+inline void CSJoinRoom::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.error_){}
+    , decltype(_impl_.roomid_){0}
   };
-  _impl_.error_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.error_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SCNameResult::~SCNameResult() {
-  // @@protoc_insertion_point(destructor:mju.SCNameResult)
+CSJoinRoom::~CSJoinRoom() {
+  // @@protoc_insertion_point(destructor:mju.CSJoinRoom)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1721,45 +1965,38 @@ SCNameResult::~SCNameResult() {
   SharedDtor();
 }
 
-inline void SCNameResult::SharedDtor() {
+inline void CSJoinRoom::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.error_.Destroy();
 }
 
-void SCNameResult::SetCachedSize(int size) const {
+void CSJoinRoom::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SCNameResult::Clear() {
-// @@protoc_insertion_point(message_clear_start:mju.SCNameResult)
+void CSJoinRoom::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.CSJoinRoom)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.error_.ClearNonDefaultToEmpty();
-  }
+  _impl_.roomid_ = 0;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SCNameResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CSJoinRoom::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // optional string error = 1;
+      // required int32 roomId = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_error();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_roomid(&has_bits);
+          _impl_.roomid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          #ifndef NDEBUG
-          ::_pbi::VerifyUTF8(str, "mju.SCNameResult.error");
-          #endif  // !NDEBUG
         } else
           goto handle_unusual;
         continue;
@@ -1787,164 +2024,130 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SCNameResult::_InternalSerialize(
+uint8_t* CSJoinRoom::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mju.SCNameResult)
+  // @@protoc_insertion_point(serialize_to_array_start:mju.CSJoinRoom)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  // optional string error = 1;
+  // required int32 roomId = 1;
   if (cached_has_bits & 0x00000001u) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
-      "mju.SCNameResult.error");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_error(), target);
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_roomid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mju.SCNameResult)
+  // @@protoc_insertion_point(serialize_to_array_end:mju.CSJoinRoom)
   return target;
 }
 
-size_t SCNameResult::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mju.SCNameResult)
+size_t CSJoinRoom::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.CSJoinRoom)
   size_t total_size = 0;
 
+  // required int32 roomId = 1;
+  if (_internal_has_roomid()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_roomid());
+  }
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // optional string error = 1;
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_error());
-  }
-
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCNameResult::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSJoinRoom::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SCNameResult::MergeImpl
+    CSJoinRoom::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCNameResult::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSJoinRoom::GetClassData() const { return &_class_data_; }
 
 
-void SCNameResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SCNameResult*>(&to_msg);
-  auto& from = static_cast<const SCNameResult&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCNameResult)
+void CSJoinRoom::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSJoinRoom*>(&to_msg);
+  auto& from = static_cast<const CSJoinRoom&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.CSJoinRoom)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_error()) {
-    _this->_internal_set_error(from._internal_error());
+  if (from._internal_has_roomid()) {
+    _this->_internal_set_roomid(from._internal_roomid());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SCNameResult::CopyFrom(const SCNameResult& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCNameResult)
+void CSJoinRoom::CopyFrom(const CSJoinRoom& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.CSJoinRoom)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SCNameResult::IsInitialized() const {
+bool CSJoinRoom::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void SCNameResult::InternalSwap(SCNameResult* other) {
+void CSJoinRoom::InternalSwap(CSJoinRoom* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.error_, lhs_arena,
-      &other->_impl_.error_, rhs_arena
-  );
+  swap(_impl_.roomid_, other->_impl_.roomid_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SCNameResult::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CSJoinRoom::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
-      file_level_metadata_message_2eproto[8]);
+      file_level_metadata_message_2eproto[5]);
 }
 
 // ===================================================================
 
-class SCRoomsResult_RoomInfo::_Internal {
+class CSLeaveRoom::_Internal {
  public:
-  using HasBits = decltype(std::declval<SCRoomsResult_RoomInfo>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<CSLeaveRoom>()._impl_._has_bits_);
   static void set_has_roomid(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
-  static void set_has_title(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
-  }
 };
 
-SCRoomsResult_RoomInfo::SCRoomsResult_RoomInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+CSLeaveRoom::CSLeaveRoom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mju.SCRoomsResult.RoomInfo)
+  // @@protoc_insertion_point(arena_constructor:mju.CSLeaveRoom)
 }
-SCRoomsResult_RoomInfo::SCRoomsResult_RoomInfo(const SCRoomsResult_RoomInfo& from)
+CSLeaveRoom::CSLeaveRoom(const CSLeaveRoom& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SCRoomsResult_RoomInfo* const _this = this; (void)_this;
+  CSLeaveRoom* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.members_){from._impl_.members_}
-    , decltype(_impl_.title_){}
     , decltype(_impl_.roomid_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.title_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.title_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_title()) {
-    _this->_impl_.title_.Set(from._internal_title(), 
-      _this->GetArenaForAllocation());
-  }
   _this->_impl_.roomid_ = from._impl_.roomid_;
-  // @@protoc_insertion_point(copy_constructor:mju.SCRoomsResult.RoomInfo)
+  // @@protoc_insertion_point(copy_constructor:mju.CSLeaveRoom)
 }
 
-inline void SCRoomsResult_RoomInfo::SharedCtor(
+inline void CSLeaveRoom::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.members_){arena}
-    , decltype(_impl_.title_){}
     , decltype(_impl_.roomid_){0}
   };
-  _impl_.title_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.title_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SCRoomsResult_RoomInfo::~SCRoomsResult_RoomInfo() {
-  // @@protoc_insertion_point(destructor:mju.SCRoomsResult.RoomInfo)
+CSLeaveRoom::~CSLeaveRoom() {
+  // @@protoc_insertion_point(destructor:mju.CSLeaveRoom)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1952,40 +2155,33 @@ SCRoomsResult_RoomInfo::~SCRoomsResult_RoomInfo() {
   SharedDtor();
 }
 
-inline void SCRoomsResult_RoomInfo::SharedDtor() {
+inline void CSLeaveRoom::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.members_.~RepeatedPtrField();
-  _impl_.title_.Destroy();
 }
 
-void SCRoomsResult_RoomInfo::SetCachedSize(int size) const {
+void CSLeaveRoom::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SCRoomsResult_RoomInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:mju.SCRoomsResult.RoomInfo)
+void CSLeaveRoom::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.CSLeaveRoom)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.members_.Clear();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.title_.ClearNonDefaultToEmpty();
-  }
   _impl_.roomid_ = 0;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SCRoomsResult_RoomInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CSLeaveRoom::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // required int32 roomId = 1;
+      // optional int32 roomId = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
           _Internal::set_has_roomid(&has_bits);
@@ -1994,35 +2190,6 @@ const char* SCRoomsResult_RoomInfo::_InternalParse(const char* ptr, ::_pbi::Pars
         } else
           goto handle_unusual;
         continue;
-      // optional string title = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_title();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          #ifndef NDEBUG
-          ::_pbi::VerifyUTF8(str, "mju.SCRoomsResult.RoomInfo.title");
-          #endif  // !NDEBUG
-        } else
-          goto handle_unusual;
-        continue;
-      // repeated string members = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            auto str = _internal_add_members();
-            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(ptr);
-            #ifndef NDEBUG
-            ::_pbi::VerifyUTF8(str, "mju.SCRoomsResult.RoomInfo.members");
-            #endif  // !NDEBUG
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
-        } else
-          goto handle_unusual;
-        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2047,174 +2214,151 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SCRoomsResult_RoomInfo::_InternalSerialize(
+uint8_t* CSLeaveRoom::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mju.SCRoomsResult.RoomInfo)
+  // @@protoc_insertion_point(serialize_to_array_start:mju.CSLeaveRoom)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  // required int32 roomId = 1;
-  if (cached_has_bits & 0x00000002u) {
+  // optional int32 roomId = 1;
+  if (cached_has_bits & 0x00000001u) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_roomid(), target);
   }
 
-  // optional string title = 2;
-  if (cached_has_bits & 0x00000001u) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->_internal_title().data(), static_cast<int>(this->_internal_title().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
-      "mju.SCRoomsResult.RoomInfo.title");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_title(), target);
-  }
-
-  // repeated string members = 3;
-  for (int i = 0, n = this->_internal_members_size(); i < n; i++) {
-    const auto& s = this->_internal_members(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
-      s.data(), static_cast<int>(s.length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
-      "mju.SCRoomsResult.RoomInfo.members");
-    target = stream->WriteString(3, s, target);
-  }
-
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mju.SCRoomsResult.RoomInfo)
+  // @@protoc_insertion_point(serialize_to_array_end:mju.CSLeaveRoom)
   return target;
 }
 
-size_t SCRoomsResult_RoomInfo::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mju.SCRoomsResult.RoomInfo)
+size_t CSLeaveRoom::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.CSLeaveRoom)
   size_t total_size = 0;
 
-  // required int32 roomId = 1;
-  if (_internal_has_roomid()) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_roomid());
-  }
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated string members = 3;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.members_.size());
-  for (int i = 0, n = _impl_.members_.size(); i < n; i++) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      _impl_.members_.Get(i));
-  }
-
-  // optional string title = 2;
+  // optional int32 roomId = 1;
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_title());
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_roomid());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCRoomsResult_RoomInfo::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSLeaveRoom::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SCRoomsResult_RoomInfo::MergeImpl
+    CSLeaveRoom::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCRoomsResult_RoomInfo::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSLeaveRoom::GetClassData() const { return &_class_data_; }
 
 
-void SCRoomsResult_RoomInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SCRoomsResult_RoomInfo*>(&to_msg);
-  auto& from = static_cast<const SCRoomsResult_RoomInfo&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCRoomsResult.RoomInfo)
+void CSLeaveRoom::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSLeaveRoom*>(&to_msg);
+  auto& from = static_cast<const CSLeaveRoom&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.CSLeaveRoom)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.members_.MergeFrom(from._impl_.members_);
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_internal_set_title(from._internal_title());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_impl_.roomid_ = from._impl_.roomid_;
-    }
-    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  if (from._internal_has_roomid()) {
+    _this->_internal_set_roomid(from._internal_roomid());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SCRoomsResult_RoomInfo::CopyFrom(const SCRoomsResult_RoomInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCRoomsResult.RoomInfo)
+void CSLeaveRoom::CopyFrom(const CSLeaveRoom& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.CSLeaveRoom)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SCRoomsResult_RoomInfo::IsInitialized() const {
-  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+bool CSLeaveRoom::IsInitialized() const {
   return true;
 }
 
-void SCRoomsResult_RoomInfo::InternalSwap(SCRoomsResult_RoomInfo* other) {
+void CSLeaveRoom::InternalSwap(CSLeaveRoom* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.members_.InternalSwap(&other->_impl_.members_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.title_, lhs_arena,
-      &other->_impl_.title_, rhs_arena
-  );
   swap(_impl_.roomid_, other->_impl_.roomid_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SCRoomsResult_RoomInfo::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CSLeaveRoom::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
-      file_level_metadata_message_2eproto[9]);
+      file_level_metadata_message_2eproto[6]);
 }
 
 // ===================================================================
 
-class SCRoomsResult::_Internal {
+class CSChat::_Internal {
  public:
+  using HasBits = decltype(std::declval<CSChat>()._impl_._has_bits_);
+  static void set_has_text(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_roomid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
 };
 
-SCRoomsResult::SCRoomsResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+CSChat::CSChat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mju.SCRoomsResult)
+  // @@protoc_insertion_point(arena_constructor:mju.CSChat)
 }
-SCRoomsResult::SCRoomsResult(const SCRoomsResult& from)
+CSChat::CSChat(const CSChat& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SCRoomsResult* const _this = this; (void)_this;
+  CSChat* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.rooms_){from._impl_.rooms_}
-    , /*decltype(_impl_._cached_size_)*/{}};
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.roomid_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:mju.SCRoomsResult)
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_text()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.roomid_ = from._impl_.roomid_;
+  // @@protoc_insertion_point(copy_constructor:mju.CSChat)
 }
 
-inline void SCRoomsResult::SharedCtor(
+inline void CSChat::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.rooms_){arena}
+      decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.roomid_){0}
   };
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SCRoomsResult::~SCRoomsResult() {
-  // @@protoc_insertion_point(destructor:mju.SCRoomsResult)
+CSChat::~CSChat() {
+  // @@protoc_insertion_point(destructor:mju.CSChat)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2222,41 +2366,55 @@ SCRoomsResult::~SCRoomsResult() {
   SharedDtor();
 }
 
-inline void SCRoomsResult::SharedDtor() {
+inline void CSChat::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.rooms_.~RepeatedPtrField();
+  _impl_.text_.Destroy();
 }
 
-void SCRoomsResult::SetCachedSize(int size) const {
+void CSChat::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SCRoomsResult::Clear() {
-// @@protoc_insertion_point(message_clear_start:mju.SCRoomsResult)
+void CSChat::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.CSChat)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.rooms_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.text_.ClearNonDefaultToEmpty();
+  }
+  _impl_.roomid_ = 0;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SCRoomsResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CSChat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .mju.SCRoomsResult.RoomInfo rooms = 1;
+      // required string text = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_rooms(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "mju.CSChat.text");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 roomId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_roomid(&has_bits);
+          _impl_.roomid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -2276,6 +2434,7 @@ const char* SCRoomsResult::_InternalParse(const char* ptr, ::_pbi::ParseContext*
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -2283,109 +2442,178 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SCRoomsResult::_InternalSerialize(
+uint8_t* CSChat::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mju.SCRoomsResult)
+  // @@protoc_insertion_point(serialize_to_array_start:mju.CSChat)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .mju.SCRoomsResult.RoomInfo rooms = 1;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_rooms_size()); i < n; i++) {
-    const auto& repfield = this->_internal_rooms(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string text = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "mju.CSChat.text");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_text(), target);
+  }
+
+  // optional int32 roomId = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_roomid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mju.SCRoomsResult)
+  // @@protoc_insertion_point(serialize_to_array_end:mju.CSChat)
   return target;
 }
 
-size_t SCRoomsResult::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mju.SCRoomsResult)
+size_t CSChat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.CSChat)
   size_t total_size = 0;
 
+  // required string text = 1;
+  if (_internal_has_text()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
+  }
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .mju.SCRoomsResult.RoomInfo rooms = 1;
-  total_size += 1UL * this->_internal_rooms_size();
-  for (const auto& msg : this->_impl_.rooms_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // optional int32 roomId = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_roomid());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCRoomsResult::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSChat::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SCRoomsResult::MergeImpl
+    CSChat::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCRoomsResult::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSChat::GetClassData() const { return &_class_data_; }
 
 
-void SCRoomsResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SCRoomsResult*>(&to_msg);
-  auto& from = static_cast<const SCRoomsResult&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCRoomsResult)
+void CSChat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSChat*>(&to_msg);
+  auto& from = static_cast<const CSChat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.CSChat)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.rooms_.MergeFrom(from._impl_.rooms_);
-  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_text(from._internal_text());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.roomid_ = from._impl_.roomid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SCRoomsResult::CopyFrom(const SCRoomsResult& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCRoomsResult)
+void CSChat::CopyFrom(const CSChat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.CSChat)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SCRoomsResult::IsInitialized() const {
-  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.rooms_))
-    return false;
+bool CSChat::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void SCRoomsResult::InternalSwap(SCRoomsResult* other) {
+void CSChat::InternalSwap(CSChat* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.rooms_.InternalSwap(&other->_impl_.rooms_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+  swap(_impl_.roomid_, other->_impl_.roomid_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SCRoomsResult::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CSChat::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
-      file_level_metadata_message_2eproto[10]);
+      file_level_metadata_message_2eproto[7]);
 }
 
 // ===================================================================
 
-class SCCreateRoomResult::_Internal {
+class CSShutdown::_Internal {
  public:
-  using HasBits = decltype(std::declval<SCCreateRoomResult>()._impl_._has_bits_);
+};
+
+CSShutdown::CSShutdown(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:mju.CSShutdown)
+}
+CSShutdown::CSShutdown(const CSShutdown& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  CSShutdown* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:mju.CSShutdown)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSShutdown::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSShutdown::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata CSShutdown::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
+      file_level_metadata_message_2eproto[8]);
+}
+
+// ===================================================================
+
+class SCNameResult::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SCNameResult>()._impl_._has_bits_);
   static void set_has_error(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
 };
 
-SCCreateRoomResult::SCCreateRoomResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SCNameResult::SCNameResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mju.SCCreateRoomResult)
+  // @@protoc_insertion_point(arena_constructor:mju.SCNameResult)
 }
-SCCreateRoomResult::SCCreateRoomResult(const SCCreateRoomResult& from)
+SCNameResult::SCNameResult(const SCNameResult& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SCCreateRoomResult* const _this = this; (void)_this;
+  SCNameResult* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
@@ -2400,10 +2628,10 @@ SCCreateRoomResult::SCCreateRoomResult(const SCCreateRoomResult& from)
     _this->_impl_.error_.Set(from._internal_error(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:mju.SCCreateRoomResult)
+  // @@protoc_insertion_point(copy_constructor:mju.SCNameResult)
 }
 
-inline void SCCreateRoomResult::SharedCtor(
+inline void SCNameResult::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -2418,8 +2646,8 @@ inline void SCCreateRoomResult::SharedCtor(
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SCCreateRoomResult::~SCCreateRoomResult() {
-  // @@protoc_insertion_point(destructor:mju.SCCreateRoomResult)
+SCNameResult::~SCNameResult() {
+  // @@protoc_insertion_point(destructor:mju.SCNameResult)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2427,17 +2655,17 @@ SCCreateRoomResult::~SCCreateRoomResult() {
   SharedDtor();
 }
 
-inline void SCCreateRoomResult::SharedDtor() {
+inline void SCNameResult::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.error_.Destroy();
 }
 
-void SCCreateRoomResult::SetCachedSize(int size) const {
+void SCNameResult::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SCCreateRoomResult::Clear() {
-// @@protoc_insertion_point(message_clear_start:mju.SCCreateRoomResult)
+void SCNameResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.SCNameResult)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -2450,7 +2678,7 @@ void SCCreateRoomResult::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SCCreateRoomResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SCNameResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
@@ -2464,7 +2692,7 @@ const char* SCCreateRoomResult::_InternalParse(const char* ptr, ::_pbi::ParseCon
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
           #ifndef NDEBUG
-          ::_pbi::VerifyUTF8(str, "mju.SCCreateRoomResult.error");
+          ::_pbi::VerifyUTF8(str, "mju.SCNameResult.error");
           #endif  // !NDEBUG
         } else
           goto handle_unusual;
@@ -2493,9 +2721,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SCCreateRoomResult::_InternalSerialize(
+uint8_t* SCNameResult::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mju.SCCreateRoomResult)
+  // @@protoc_insertion_point(serialize_to_array_start:mju.SCNameResult)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -2505,7 +2733,7 @@ uint8_t* SCCreateRoomResult::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
       this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
-      "mju.SCCreateRoomResult.error");
+      "mju.SCNameResult.error");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_error(), target);
   }
@@ -2514,12 +2742,12 @@ uint8_t* SCCreateRoomResult::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mju.SCCreateRoomResult)
+  // @@protoc_insertion_point(serialize_to_array_end:mju.SCNameResult)
   return target;
 }
 
-size_t SCCreateRoomResult::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mju.SCCreateRoomResult)
+size_t SCNameResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.SCNameResult)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -2537,17 +2765,17 @@ size_t SCCreateRoomResult::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCCreateRoomResult::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCNameResult::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SCCreateRoomResult::MergeImpl
+    SCNameResult::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCCreateRoomResult::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCNameResult::GetClassData() const { return &_class_data_; }
 
 
-void SCCreateRoomResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SCCreateRoomResult*>(&to_msg);
-  auto& from = static_cast<const SCCreateRoomResult&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCCreateRoomResult)
+void SCNameResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SCNameResult*>(&to_msg);
+  auto& from = static_cast<const SCNameResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCNameResult)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -2558,18 +2786,18 @@ void SCCreateRoomResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, con
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SCCreateRoomResult::CopyFrom(const SCCreateRoomResult& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCCreateRoomResult)
+void SCNameResult::CopyFrom(const SCNameResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCNameResult)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SCCreateRoomResult::IsInitialized() const {
+bool SCNameResult::IsInitialized() const {
   return true;
 }
 
-void SCCreateRoomResult::InternalSwap(SCCreateRoomResult* other) {
+void SCNameResult::InternalSwap(SCNameResult* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
@@ -2581,65 +2809,1621 @@ void SCCreateRoomResult::InternalSwap(SCCreateRoomResult* other) {
   );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SCCreateRoomResult::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SCNameResult::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
-      file_level_metadata_message_2eproto[11]);
+      file_level_metadata_message_2eproto[9]);
 }
 
 // ===================================================================
 
-class SCJoinRoomResult::_Internal {
+class SCRoomsResult_RoomInfo::_Internal {
  public:
-  using HasBits = decltype(std::declval<SCJoinRoomResult>()._impl_._has_bits_);
-  static void set_has_error(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<SCRoomsResult_RoomInfo>()._impl_._has_bits_);
+  static void set_has_roomid(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_title(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
 };
 
-SCJoinRoomResult::SCJoinRoomResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SCRoomsResult_RoomInfo::SCRoomsResult_RoomInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mju.SCJoinRoomResult)
+  // @@protoc_insertion_point(arena_constructor:mju.SCRoomsResult.RoomInfo)
 }
-SCJoinRoomResult::SCJoinRoomResult(const SCJoinRoomResult& from)
+SCRoomsResult_RoomInfo::SCRoomsResult_RoomInfo(const SCRoomsResult_RoomInfo& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SCJoinRoomResult* const _this = this; (void)_this;
+  SCRoomsResult_RoomInfo* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.error_){}};
+    , decltype(_impl_.members_){from._impl_.members_}
+    , decltype(_impl_.title_){}
+    , decltype(_impl_.roomid_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.error_.InitDefault();
+  _impl_.title_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.error_.Set("", GetArenaForAllocation());
+    _impl_.title_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_error()) {
-    _this->_impl_.error_.Set(from._internal_error(), 
+  if (from._internal_has_title()) {
+    _this->_impl_.title_.Set(from._internal_title(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:mju.SCJoinRoomResult)
+  _this->_impl_.roomid_ = from._impl_.roomid_;
+  // @@protoc_insertion_point(copy_constructor:mju.SCRoomsResult.RoomInfo)
 }
 
-inline void SCJoinRoomResult::SharedCtor(
+inline void SCRoomsResult_RoomInfo::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.error_){}
+    , decltype(_impl_.members_){arena}
+    , decltype(_impl_.title_){}
+    , decltype(_impl_.roomid_){0}
   };
-  _impl_.error_.InitDefault();
+  _impl_.title_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.title_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SCRoomsResult_RoomInfo::~SCRoomsResult_RoomInfo() {
+  // @@protoc_insertion_point(destructor:mju.SCRoomsResult.RoomInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SCRoomsResult_RoomInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.members_.~RepeatedPtrField();
+  _impl_.title_.Destroy();
+}
+
+void SCRoomsResult_RoomInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SCRoomsResult_RoomInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.SCRoomsResult.RoomInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.members_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.title_.ClearNonDefaultToEmpty();
+  }
+  _impl_.roomid_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SCRoomsResult_RoomInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required int32 roomId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_roomid(&has_bits);
+          _impl_.roomid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string title = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_title();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "mju.SCRoomsResult.RoomInfo.title");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string members = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_members();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            #ifndef NDEBUG
+            ::_pbi::VerifyUTF8(str, "mju.SCRoomsResult.RoomInfo.members");
+            #endif  // !NDEBUG
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SCRoomsResult_RoomInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mju.SCRoomsResult.RoomInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required int32 roomId = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_roomid(), target);
+  }
+
+  // optional string title = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_title().data(), static_cast<int>(this->_internal_title().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "mju.SCRoomsResult.RoomInfo.title");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_title(), target);
+  }
+
+  // repeated string members = 3;
+  for (int i = 0, n = this->_internal_members_size(); i < n; i++) {
+    const auto& s = this->_internal_members(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "mju.SCRoomsResult.RoomInfo.members");
+    target = stream->WriteString(3, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mju.SCRoomsResult.RoomInfo)
+  return target;
+}
+
+size_t SCRoomsResult_RoomInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.SCRoomsResult.RoomInfo)
+  size_t total_size = 0;
+
+  // required int32 roomId = 1;
+  if (_internal_has_roomid()) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_roomid());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string members = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.members_.size());
+  for (int i = 0, n = _impl_.members_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.members_.Get(i));
+  }
+
+  // optional string title = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_title());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCRoomsResult_RoomInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SCRoomsResult_RoomInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCRoomsResult_RoomInfo::GetClassData() const { return &_class_data_; }
+
+
+void SCRoomsResult_RoomInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SCRoomsResult_RoomInfo*>(&to_msg);
+  auto& from = static_cast<const SCRoomsResult_RoomInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCRoomsResult.RoomInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.members_.MergeFrom(from._impl_.members_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_title(from._internal_title());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.roomid_ = from._impl_.roomid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SCRoomsResult_RoomInfo::CopyFrom(const SCRoomsResult_RoomInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCRoomsResult.RoomInfo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SCRoomsResult_RoomInfo::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SCRoomsResult_RoomInfo::InternalSwap(SCRoomsResult_RoomInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.members_.InternalSwap(&other->_impl_.members_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.title_, lhs_arena,
+      &other->_impl_.title_, rhs_arena
+  );
+  swap(_impl_.roomid_, other->_impl_.roomid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SCRoomsResult_RoomInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
+      file_level_metadata_message_2eproto[10]);
+}
+
+// ===================================================================
+
+class SCRoomsResult::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SCRoomsResult>()._impl_._has_bits_);
+  static void set_has_nextcursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+SCRoomsResult::SCRoomsResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mju.SCRoomsResult)
+}
+SCRoomsResult::SCRoomsResult(const SCRoomsResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SCRoomsResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rooms_){from._impl_.rooms_}
+    , decltype(_impl_.nextcursor_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.nextcursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nextcursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_nextcursor()) {
+    _this->_impl_.nextcursor_.Set(from._internal_nextcursor(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:mju.SCRoomsResult)
+}
+
+inline void SCRoomsResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rooms_){arena}
+    , decltype(_impl_.nextcursor_){}
+  };
+  _impl_.nextcursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.nextcursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SCRoomsResult::~SCRoomsResult() {
+  // @@protoc_insertion_point(destructor:mju.SCRoomsResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SCRoomsResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rooms_.~RepeatedPtrField();
+  _impl_.nextcursor_.Destroy();
+}
+
+void SCRoomsResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SCRoomsResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.SCRoomsResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rooms_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.nextcursor_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SCRoomsResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .mju.SCRoomsResult.RoomInfo rooms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rooms(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string nextCursor = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_nextcursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "mju.SCRoomsResult.nextCursor");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SCRoomsResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mju.SCRoomsResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .mju.SCRoomsResult.RoomInfo rooms = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rooms_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rooms(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string nextCursor = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_nextcursor().data(), static_cast<int>(this->_internal_nextcursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "mju.SCRoomsResult.nextCursor");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_nextcursor(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mju.SCRoomsResult)
+  return target;
+}
+
+size_t SCRoomsResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.SCRoomsResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .mju.SCRoomsResult.RoomInfo rooms = 1;
+  total_size += 1UL * this->_internal_rooms_size();
+  for (const auto& msg : this->_impl_.rooms_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional string nextCursor = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_nextcursor());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCRoomsResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SCRoomsResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCRoomsResult::GetClassData() const { return &_class_data_; }
+
+
+void SCRoomsResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SCRoomsResult*>(&to_msg);
+  auto& from = static_cast<const SCRoomsResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCRoomsResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rooms_.MergeFrom(from._impl_.rooms_);
+  if (from._internal_has_nextcursor()) {
+    _this->_internal_set_nextcursor(from._internal_nextcursor());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SCRoomsResult::CopyFrom(const SCRoomsResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCRoomsResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SCRoomsResult::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.rooms_))
+    return false;
+  return true;
+}
+
+void SCRoomsResult::InternalSwap(SCRoomsResult* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.rooms_.InternalSwap(&other->_impl_.rooms_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.nextcursor_, lhs_arena,
+      &other->_impl_.nextcursor_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SCRoomsResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
+      file_level_metadata_message_2eproto[11]);
+}
+
+// ===================================================================
+
+class SCCreateRoomResult::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SCCreateRoomResult>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+SCCreateRoomResult::SCCreateRoomResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mju.SCCreateRoomResult)
+}
+SCCreateRoomResult::SCCreateRoomResult(const SCCreateRoomResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SCCreateRoomResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.error_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:mju.SCCreateRoomResult)
+}
+
+inline void SCCreateRoomResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.error_){}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SCCreateRoomResult::~SCCreateRoomResult() {
+  // @@protoc_insertion_point(destructor:mju.SCCreateRoomResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SCCreateRoomResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_.Destroy();
+}
+
+void SCCreateRoomResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SCCreateRoomResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.SCCreateRoomResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SCCreateRoomResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string error = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "mju.SCCreateRoomResult.error");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SCCreateRoomResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mju.SCCreateRoomResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string error = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "mju.SCCreateRoomResult.error");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_error(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mju.SCCreateRoomResult)
+  return target;
+}
+
+size_t SCCreateRoomResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.SCCreateRoomResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string error = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCCreateRoomResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SCCreateRoomResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCCreateRoomResult::GetClassData() const { return &_class_data_; }
+
+
+void SCCreateRoomResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SCCreateRoomResult*>(&to_msg);
+  auto& from = static_cast<const SCCreateRoomResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCCreateRoomResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_error()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SCCreateRoomResult::CopyFrom(const SCCreateRoomResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCCreateRoomResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SCCreateRoomResult::IsInitialized() const {
+  return true;
+}
+
+void SCCreateRoomResult::InternalSwap(SCCreateRoomResult* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SCCreateRoomResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
+      file_level_metadata_message_2eproto[12]);
+}
+
+// ===================================================================
+
+class SCJoinRoomResult::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SCJoinRoomResult>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+SCJoinRoomResult::SCJoinRoomResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mju.SCJoinRoomResult)
+}
+SCJoinRoomResult::SCJoinRoomResult(const SCJoinRoomResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SCJoinRoomResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.error_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:mju.SCJoinRoomResult)
+}
+
+inline void SCJoinRoomResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.error_){}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SCJoinRoomResult::~SCJoinRoomResult() {
+  // @@protoc_insertion_point(destructor:mju.SCJoinRoomResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SCJoinRoomResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_.Destroy();
+}
+
+void SCJoinRoomResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SCJoinRoomResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.SCJoinRoomResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SCJoinRoomResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string error = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "mju.SCJoinRoomResult.error");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SCJoinRoomResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mju.SCJoinRoomResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string error = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "mju.SCJoinRoomResult.error");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_error(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mju.SCJoinRoomResult)
+  return target;
+}
+
+size_t SCJoinRoomResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.SCJoinRoomResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string error = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCJoinRoomResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SCJoinRoomResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCJoinRoomResult::GetClassData() const { return &_class_data_; }
+
+
+void SCJoinRoomResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SCJoinRoomResult*>(&to_msg);
+  auto& from = static_cast<const SCJoinRoomResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCJoinRoomResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_error()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SCJoinRoomResult::CopyFrom(const SCJoinRoomResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCJoinRoomResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SCJoinRoomResult::IsInitialized() const {
+  return true;
+}
+
+void SCJoinRoomResult::InternalSwap(SCJoinRoomResult* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SCJoinRoomResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
+      file_level_metadata_message_2eproto[13]);
+}
+
+// ===================================================================
+
+class SCLeaveRoomResult::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SCLeaveRoomResult>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+SCLeaveRoomResult::SCLeaveRoomResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mju.SCLeaveRoomResult)
+}
+SCLeaveRoomResult::SCLeaveRoomResult(const SCLeaveRoomResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SCLeaveRoomResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.error_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:mju.SCLeaveRoomResult)
+}
+
+inline void SCLeaveRoomResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.error_){}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SCLeaveRoomResult::~SCLeaveRoomResult() {
+  // @@protoc_insertion_point(destructor:mju.SCLeaveRoomResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SCLeaveRoomResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_.Destroy();
+}
+
+void SCLeaveRoomResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SCLeaveRoomResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.SCLeaveRoomResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SCLeaveRoomResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string error = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "mju.SCLeaveRoomResult.error");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SCLeaveRoomResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mju.SCLeaveRoomResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string error = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "mju.SCLeaveRoomResult.error");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_error(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mju.SCLeaveRoomResult)
+  return target;
+}
+
+size_t SCLeaveRoomResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.SCLeaveRoomResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string error = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCLeaveRoomResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SCLeaveRoomResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCLeaveRoomResult::GetClassData() const { return &_class_data_; }
+
+
+void SCLeaveRoomResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SCLeaveRoomResult*>(&to_msg);
+  auto& from = static_cast<const SCLeaveRoomResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCLeaveRoomResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_error()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SCLeaveRoomResult::CopyFrom(const SCLeaveRoomResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCLeaveRoomResult)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SCLeaveRoomResult::IsInitialized() const {
+  return true;
+}
+
+void SCLeaveRoomResult::InternalSwap(SCLeaveRoomResult* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SCLeaveRoomResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
+      file_level_metadata_message_2eproto[14]);
+}
+
+// ===================================================================
+
+class SCChat::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SCChat>()._impl_._has_bits_);
+  static void set_has_member(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_text(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_roomid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+SCChat::SCChat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mju.SCChat)
+}
+SCChat::SCChat(const SCChat& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SCChat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.member_){}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.roomid_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.member_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.member_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_member()) {
+    _this->_impl_.member_.Set(from._internal_member(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_text()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.roomid_ = from._impl_.roomid_;
+  // @@protoc_insertion_point(copy_constructor:mju.SCChat)
+}
+
+inline void SCChat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.member_){}
+    , decltype(_impl_.text_){}
+    , decltype(_impl_.roomid_){0}
+  };
+  _impl_.member_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.member_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SCChat::~SCChat() {
+  // @@protoc_insertion_point(destructor:mju.SCChat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SCChat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.member_.Destroy();
+  _impl_.text_.Destroy();
+}
+
+void SCChat::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SCChat::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.SCChat)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.member_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.text_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.roomid_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SCChat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string member = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_member();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "mju.SCChat.member");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // required string text = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "mju.SCChat.text");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 roomId = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_roomid(&has_bits);
+          _impl_.roomid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SCChat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mju.SCChat)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string member = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_member().data(), static_cast<int>(this->_internal_member().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "mju.SCChat.member");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_member(), target);
+  }
+
+  // required string text = 2;
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "mju.SCChat.text");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_text(), target);
+  }
+
+  // optional int32 roomId = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_roomid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mju.SCChat)
+  return target;
+}
+
+size_t SCChat::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:mju.SCChat)
+  size_t total_size = 0;
+
+  if (_internal_has_member()) {
+    // required string member = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_member());
+  }
+
+  if (_internal_has_text()) {
+    // required string text = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
+  }
+
+  return total_size;
+}
+size_t SCChat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.SCChat)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string member = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_member());
+
+    // required string text = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional int32 roomId = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000004u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_roomid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCChat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SCChat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCChat::GetClassData() const { return &_class_data_; }
+
+
+void SCChat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SCChat*>(&to_msg);
+  auto& from = static_cast<const SCChat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCChat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_member(from._internal_member());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_text(from._internal_text());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.roomid_ = from._impl_.roomid_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SCChat::CopyFrom(const SCChat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCChat)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SCChat::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SCChat::InternalSwap(SCChat* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.member_, lhs_arena,
+      &other->_impl_.member_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+  swap(_impl_.roomid_, other->_impl_.roomid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SCChat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
+      file_level_metadata_message_2eproto[15]);
+}
+
+// ===================================================================
+
+class SCSystemMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SCSystemMessage>()._impl_._has_bits_);
+  static void set_has_text(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+SCSystemMessage::SCSystemMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:mju.SCSystemMessage)
+}
+SCSystemMessage::SCSystemMessage(const SCSystemMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SCSystemMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.text_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_text()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:mju.SCSystemMessage)
+}
+
+inline void SCSystemMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.text_){}
+  };
+  _impl_.text_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.error_.Set("", GetArenaForAllocation());
+    _impl_.text_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SCJoinRoomResult::~SCJoinRoomResult() {
-  // @@protoc_insertion_point(destructor:mju.SCJoinRoomResult)
+SCSystemMessage::~SCSystemMessage() {
+  // @@protoc_insertion_point(destructor:mju.SCSystemMessage)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2647,44 +4431,44 @@ SCJoinRoomResult::~SCJoinRoomResult() {
   SharedDtor();
 }
 
-inline void SCJoinRoomResult::SharedDtor() {
+inline void SCSystemMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.error_.Destroy();
+  _impl_.text_.Destroy();
 }
 
-void SCJoinRoomResult::SetCachedSize(int size) const {
+void SCSystemMessage::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SCJoinRoomResult::Clear() {
-// @@protoc_insertion_point(message_clear_start:mju.SCJoinRoomResult)
+void SCSystemMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.SCSystemMessage)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
-    _impl_.error_.ClearNonDefaultToEmpty();
+    _impl_.text_.ClearNonDefaultToEmpty();
   }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SCJoinRoomResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SCSystemMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // optional string error = 1;
+      // required string text = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_error();
+          auto str = _internal_mutable_text();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
           #ifndef NDEBUG
-          ::_pbi::VerifyUTF8(str, "mju.SCJoinRoomResult.error");
+          ::_pbi::VerifyUTF8(str, "mju.SCSystemMessage.text");
           #endif  // !NDEBUG
         } else
           goto handle_unusual;
@@ -2713,153 +4497,161 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SCJoinRoomResult::_InternalSerialize(
+uint8_t* SCSystemMessage::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mju.SCJoinRoomResult)
+  // @@protoc_insertion_point(serialize_to_array_start:mju.SCSystemMessage)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  // optional string error = 1;
+  // required string text = 1;
   if (cached_has_bits & 0x00000001u) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
-      "mju.SCJoinRoomResult.error");
+      "mju.SCSystemMessage.text");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_error(), target);
+        1, this->_internal_text(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mju.SCJoinRoomResult)
+  // @@protoc_insertion_point(serialize_to_array_end:mju.SCSystemMessage)
   return target;
 }
 
-size_t SCJoinRoomResult::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mju.SCJoinRoomResult)
+size_t SCSystemMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.SCSystemMessage)
   size_t total_size = 0;
 
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // optional string error = 1;
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
+  // required string text = 1;
+  if (_internal_has_text()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_error());
+        this->_internal_text());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCJoinRoomResult::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCSystemMessage::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SCJoinRoomResult::MergeImpl
+    SCSystemMessage::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCJoinRoomResult::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCSystemMessage::GetClassData() const { return &_class_data_; }
 
 
-void SCJoinRoomResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SCJoinRoomResult*>(&to_msg);
-  auto& from = static_cast<const SCJoinRoomResult&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCJoinRoomResult)
+void SCSystemMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SCSystemMessage*>(&to_msg);
+  auto& from = static_cast<const SCSystemMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCSystemMessage)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_error()) {
-    _this->_internal_set_error(from._internal_error());
+  if (from._internal_has_text()) {
+    _this->_internal_set_text(from._internal_text());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SCJoinRoomResult::CopyFrom(const SCJoinRoomResult& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCJoinRoomResult)
+void SCSystemMessage::CopyFrom(const SCSystemMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCSystemMessage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SCJoinRoomResult::IsInitialized() const {
+bool SCSystemMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void SCJoinRoomResult::InternalSwap(SCJoinRoomResult* other) {
+void SCSystemMessage::InternalSwap(SCSystemMessage* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.error_, lhs_arena,
-      &other->_impl_.error_, rhs_arena
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
   );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SCJoinRoomResult::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SCSystemMessage::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
-      file_level_metadata_message_2eproto[12]);
+      file_level_metadata_message_2eproto[16]);
 }
 
 // ===================================================================
 
-class SCLeaveRoomResult::_Internal {
+class BatchEntry::_Internal {
  public:
-  using HasBits = decltype(std::declval<SCLeaveRoomResult>()._impl_._has_bits_);
-  static void set_has_error(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<BatchEntry>()._impl_._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_body(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
 };
 
-SCLeaveRoomResult::SCLeaveRoomResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+BatchEntry::BatchEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mju.SCLeaveRoomResult)
+  // @@protoc_insertion_point(arena_constructor:mju.BatchEntry)
 }
-SCLeaveRoomResult::SCLeaveRoomResult(const SCLeaveRoomResult& from)
+BatchEntry::BatchEntry(const BatchEntry& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SCLeaveRoomResult* const _this = this; (void)_this;
+  BatchEntry* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.error_){}};
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.type_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.error_.InitDefault();
+  _impl_.body_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.error_.Set("", GetArenaForAllocation());
+    _impl_.body_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_error()) {
-    _this->_impl_.error_.Set(from._internal_error(), 
+  if (from._internal_has_body()) {
+    _this->_impl_.body_.Set(from._internal_body(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:mju.SCLeaveRoomResult)
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:mju.BatchEntry)
 }
 
-inline void SCLeaveRoomResult::SharedCtor(
+inline void BatchEntry::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.error_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.type_){0}
   };
-  _impl_.error_.InitDefault();
+  _impl_.body_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.error_.Set("", GetArenaForAllocation());
+    _impl_.body_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SCLeaveRoomResult::~SCLeaveRoomResult() {
-  // @@protoc_insertion_point(destructor:mju.SCLeaveRoomResult)
+BatchEntry::~BatchEntry() {
+  // @@protoc_insertion_point(destructor:mju.BatchEntry)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2867,45 +4659,56 @@ SCLeaveRoomResult::~SCLeaveRoomResult() {
   SharedDtor();
 }
 
-inline void SCLeaveRoomResult::SharedDtor() {
+inline void BatchEntry::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.error_.Destroy();
+  _impl_.body_.Destroy();
 }
 
-void SCLeaveRoomResult::SetCachedSize(int size) const {
+void BatchEntry::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SCLeaveRoomResult::Clear() {
-// @@protoc_insertion_point(message_clear_start:mju.SCLeaveRoomResult)
+void BatchEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.BatchEntry)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
-    _impl_.error_.ClearNonDefaultToEmpty();
+    _impl_.body_.ClearNonDefaultToEmpty();
   }
+  _impl_.type_ = 0;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SCLeaveRoomResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* BatchEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // optional string error = 1;
+      // required .mju.Type.MessageType type = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_error();
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::mju::Type_MessageType_IsValid(val))) {
+            _internal_set_type(static_cast<::mju::Type_MessageType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes body = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_body();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          #ifndef NDEBUG
-          ::_pbi::VerifyUTF8(str, "mju.SCLeaveRoomResult.error");
-          #endif  // !NDEBUG
         } else
           goto handle_unusual;
         continue;
@@ -2933,173 +4736,152 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SCLeaveRoomResult::_InternalSerialize(
+uint8_t* BatchEntry::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mju.SCLeaveRoomResult)
+  // @@protoc_insertion_point(serialize_to_array_start:mju.BatchEntry)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  // optional string error = 1;
+  // required .mju.Type.MessageType type = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional bytes body = 2;
   if (cached_has_bits & 0x00000001u) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
-      "mju.SCLeaveRoomResult.error");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_error(), target);
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_body(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mju.SCLeaveRoomResult)
+  // @@protoc_insertion_point(serialize_to_array_end:mju.BatchEntry)
   return target;
 }
 
-size_t SCLeaveRoomResult::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mju.SCLeaveRoomResult)
+size_t BatchEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.BatchEntry)
   size_t total_size = 0;
 
+  // required .mju.Type.MessageType type = 1;
+  if (_internal_has_type()) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // optional string error = 1;
+  // optional bytes body = 2;
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_error());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_body());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCLeaveRoomResult::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchEntry::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SCLeaveRoomResult::MergeImpl
+    BatchEntry::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCLeaveRoomResult::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchEntry::GetClassData() const { return &_class_data_; }
 
 
-void SCLeaveRoomResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SCLeaveRoomResult*>(&to_msg);
-  auto& from = static_cast<const SCLeaveRoomResult&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCLeaveRoomResult)
+void BatchEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchEntry*>(&to_msg);
+  auto& from = static_cast<const BatchEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.BatchEntry)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_error()) {
-    _this->_internal_set_error(from._internal_error());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_body(from._internal_body());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SCLeaveRoomResult::CopyFrom(const SCLeaveRoomResult& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCLeaveRoomResult)
+void BatchEntry::CopyFrom(const BatchEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.BatchEntry)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SCLeaveRoomResult::IsInitialized() const {
+bool BatchEntry::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void SCLeaveRoomResult::InternalSwap(SCLeaveRoomResult* other) {
+void BatchEntry::InternalSwap(BatchEntry* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.error_, lhs_arena,
-      &other->_impl_.error_, rhs_arena
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
   );
+  swap(_impl_.type_, other->_impl_.type_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SCLeaveRoomResult::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata BatchEntry::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
-      file_level_metadata_message_2eproto[13]);
+      file_level_metadata_message_2eproto[17]);
 }
 
 // ===================================================================
 
-class SCChat::_Internal {
+class CSBatch::_Internal {
  public:
-  using HasBits = decltype(std::declval<SCChat>()._impl_._has_bits_);
-  static void set_has_member(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
-  static void set_has_text(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
-  static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
-  }
 };
 
-SCChat::SCChat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+CSBatch::CSBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mju.SCChat)
+  // @@protoc_insertion_point(arena_constructor:mju.CSBatch)
 }
-SCChat::SCChat(const SCChat& from)
+CSBatch::CSBatch(const CSBatch& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SCChat* const _this = this; (void)_this;
+  CSBatch* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){from._impl_._has_bits_}
-    , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.member_){}
-    , decltype(_impl_.text_){}};
+      decltype(_impl_.messages_){from._impl_.messages_}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.member_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.member_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_member()) {
-    _this->_impl_.member_.Set(from._internal_member(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.text_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.text_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_text()) {
-    _this->_impl_.text_.Set(from._internal_text(), 
-      _this->GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:mju.SCChat)
+  // @@protoc_insertion_point(copy_constructor:mju.CSBatch)
 }
 
-inline void SCChat::SharedCtor(
+inline void CSBatch::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){}
+      decltype(_impl_.messages_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.member_){}
-    , decltype(_impl_.text_){}
   };
-  _impl_.member_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.member_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.text_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.text_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SCChat::~SCChat() {
-  // @@protoc_insertion_point(destructor:mju.SCChat)
+CSBatch::~CSBatch() {
+  // @@protoc_insertion_point(destructor:mju.CSBatch)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3107,63 +4889,41 @@ SCChat::~SCChat() {
   SharedDtor();
 }
 
-inline void SCChat::SharedDtor() {
+inline void CSBatch::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.member_.Destroy();
-  _impl_.text_.Destroy();
+  _impl_.messages_.~RepeatedPtrField();
 }
 
-void SCChat::SetCachedSize(int size) const {
+void CSBatch::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SCChat::Clear() {
-// @@protoc_insertion_point(message_clear_start:mju.SCChat)
+void CSBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.CSBatch)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _impl_.member_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _impl_.text_.ClearNonDefaultToEmpty();
-    }
-  }
-  _impl_._has_bits_.Clear();
+  _impl_.messages_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SCChat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CSBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // required string member = 1;
+      // repeated .mju.BatchEntry messages = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_member();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          #ifndef NDEBUG
-          ::_pbi::VerifyUTF8(str, "mju.SCChat.member");
-          #endif  // !NDEBUG
-        } else
-          goto handle_unusual;
-        continue;
-      // required string text = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_text();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          #ifndef NDEBUG
-          ::_pbi::VerifyUTF8(str, "mju.SCChat.text");
-          #endif  // !NDEBUG
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_messages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -3183,7 +4943,6 @@ const char* SCChat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
     CHK_(ptr != nullptr);
   }  // while
 message_done:
-  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -3191,203 +4950,125 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SCChat::_InternalSerialize(
+uint8_t* CSBatch::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mju.SCChat)
+  // @@protoc_insertion_point(serialize_to_array_start:mju.CSBatch)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  // required string member = 1;
-  if (cached_has_bits & 0x00000001u) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->_internal_member().data(), static_cast<int>(this->_internal_member().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
-      "mju.SCChat.member");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_member(), target);
-  }
-
-  // required string text = 2;
-  if (cached_has_bits & 0x00000002u) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
-      "mju.SCChat.text");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_text(), target);
+  // repeated .mju.BatchEntry messages = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_messages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_messages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mju.SCChat)
+  // @@protoc_insertion_point(serialize_to_array_end:mju.CSBatch)
   return target;
 }
 
-size_t SCChat::RequiredFieldsByteSizeFallback() const {
-// @@protoc_insertion_point(required_fields_byte_size_fallback_start:mju.SCChat)
-  size_t total_size = 0;
-
-  if (_internal_has_member()) {
-    // required string member = 1;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_member());
-  }
-
-  if (_internal_has_text()) {
-    // required string text = 2;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_text());
-  }
-
-  return total_size;
-}
-size_t SCChat::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mju.SCChat)
+size_t CSBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.CSBatch)
   size_t total_size = 0;
 
-  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
-    // required string member = 1;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_member());
-
-    // required string text = 2;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_text());
-
-  } else {
-    total_size += RequiredFieldsByteSizeFallback();
-  }
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated .mju.BatchEntry messages = 1;
+  total_size += 1UL * this->_internal_messages_size();
+  for (const auto& msg : this->_impl_.messages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCChat::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CSBatch::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SCChat::MergeImpl
+    CSBatch::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCChat::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CSBatch::GetClassData() const { return &_class_data_; }
 
 
-void SCChat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SCChat*>(&to_msg);
-  auto& from = static_cast<const SCChat&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCChat)
+void CSBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CSBatch*>(&to_msg);
+  auto& from = static_cast<const CSBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.CSBatch)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_internal_set_member(from._internal_member());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_internal_set_text(from._internal_text());
-    }
-  }
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SCChat::CopyFrom(const SCChat& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCChat)
+void CSBatch::CopyFrom(const CSBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.CSBatch)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SCChat::IsInitialized() const {
-  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+bool CSBatch::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.messages_))
+    return false;
   return true;
 }
 
-void SCChat::InternalSwap(SCChat* other) {
+void CSBatch::InternalSwap(CSBatch* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.member_, lhs_arena,
-      &other->_impl_.member_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.text_, lhs_arena,
-      &other->_impl_.text_, rhs_arena
-  );
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SCChat::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CSBatch::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
-      file_level_metadata_message_2eproto[14]);
+      file_level_metadata_message_2eproto[18]);
 }
 
 // ===================================================================
 
-class SCSystemMessage::_Internal {
+class SCBatch::_Internal {
  public:
-  using HasBits = decltype(std::declval<SCSystemMessage>()._impl_._has_bits_);
-  static void set_has_text(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
-  static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
-  }
 };
 
-SCSystemMessage::SCSystemMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SCBatch::SCBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:mju.SCSystemMessage)
+  // @@protoc_insertion_point(arena_constructor:mju.SCBatch)
 }
-SCSystemMessage::SCSystemMessage(const SCSystemMessage& from)
+SCBatch::SCBatch(const SCBatch& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SCSystemMessage* const _this = this; (void)_this;
+  SCBatch* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){from._impl_._has_bits_}
-    , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.text_){}};
+      decltype(_impl_.messages_){from._impl_.messages_}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.text_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.text_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_text()) {
-    _this->_impl_.text_.Set(from._internal_text(), 
-      _this->GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:mju.SCSystemMessage)
+  // @@protoc_insertion_point(copy_constructor:mju.SCBatch)
 }
 
-inline void SCSystemMessage::SharedCtor(
+inline void SCBatch::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){}
+      decltype(_impl_.messages_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.text_){}
   };
-  _impl_.text_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.text_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SCSystemMessage::~SCSystemMessage() {
-  // @@protoc_insertion_point(destructor:mju.SCSystemMessage)
+SCBatch::~SCBatch() {
+  // @@protoc_insertion_point(destructor:mju.SCBatch)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3395,45 +5076,41 @@ SCSystemMessage::~SCSystemMessage() {
   SharedDtor();
 }
 
-inline void SCSystemMessage::SharedDtor() {
+inline void SCBatch::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.text_.Destroy();
+  _impl_.messages_.~RepeatedPtrField();
 }
 
-void SCSystemMessage::SetCachedSize(int size) const {
+void SCBatch::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SCSystemMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:mju.SCSystemMessage)
+void SCBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:mju.SCBatch)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.text_.ClearNonDefaultToEmpty();
-  }
-  _impl_._has_bits_.Clear();
+  _impl_.messages_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SCSystemMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SCBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // required string text = 1;
+      // repeated .mju.BatchEntry messages = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_text();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          #ifndef NDEBUG
-          ::_pbi::VerifyUTF8(str, "mju.SCSystemMessage.text");
-          #endif  // !NDEBUG
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_messages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -3453,7 +5130,6 @@ const char* SCSystemMessage::_InternalParse(const char* ptr, ::_pbi::ParseContex
     CHK_(ptr != nullptr);
   }  // while
 message_done:
-  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -3461,97 +5137,88 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SCSystemMessage::_InternalSerialize(
+uint8_t* SCBatch::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:mju.SCSystemMessage)
+  // @@protoc_insertion_point(serialize_to_array_start:mju.SCBatch)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _impl_._has_bits_[0];
-  // required string text = 1;
-  if (cached_has_bits & 0x00000001u) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
-      "mju.SCSystemMessage.text");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_text(), target);
+  // repeated .mju.BatchEntry messages = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_messages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_messages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:mju.SCSystemMessage)
+  // @@protoc_insertion_point(serialize_to_array_end:mju.SCBatch)
   return target;
 }
 
-size_t SCSystemMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:mju.SCSystemMessage)
+size_t SCBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mju.SCBatch)
   size_t total_size = 0;
 
-  // required string text = 1;
-  if (_internal_has_text()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_text());
-  }
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated .mju.BatchEntry messages = 1;
+  total_size += 1UL * this->_internal_messages_size();
+  for (const auto& msg : this->_impl_.messages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCSystemMessage::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SCBatch::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SCSystemMessage::MergeImpl
+    SCBatch::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCSystemMessage::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SCBatch::GetClassData() const { return &_class_data_; }
 
 
-void SCSystemMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SCSystemMessage*>(&to_msg);
-  auto& from = static_cast<const SCSystemMessage&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCSystemMessage)
+void SCBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SCBatch*>(&to_msg);
+  auto& from = static_cast<const SCBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:mju.SCBatch)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_text()) {
-    _this->_internal_set_text(from._internal_text());
-  }
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SCSystemMessage::CopyFrom(const SCSystemMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCSystemMessage)
+void SCBatch::CopyFrom(const SCBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mju.SCBatch)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SCSystemMessage::IsInitialized() const {
-  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+bool SCBatch::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.messages_))
+    return false;
   return true;
 }
 
-void SCSystemMessage::InternalSwap(SCSystemMessage* other) {
+void SCBatch::InternalSwap(SCBatch* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.text_, lhs_arena,
-      &other->_impl_.text_, rhs_arena
-  );
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SCSystemMessage::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SCBatch::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_message_2eproto_getter, &descriptor_table_message_2eproto_once,
-      file_level_metadata_message_2eproto[15]);
+      file_level_metadata_message_2eproto[19]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -3569,6 +5236,10 @@ template<> PROTOBUF_NOINLINE ::mju::CSRooms*
 Arena::CreateMaybeMessage< ::mju::CSRooms >(Arena* arena) {
   return Arena::CreateMessageInternal< ::mju::CSRooms >(arena);
 }
+template<> PROTOBUF_NOINLINE ::mju::CSSearchRooms*
+Arena::CreateMaybeMessage< ::mju::CSSearchRooms >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mju::CSSearchRooms >(arena);
+}
 template<> PROTOBUF_NOINLINE ::mju::CSCreateRoom*
 Arena::CreateMaybeMessage< ::mju::CSCreateRoom >(Arena* arena) {
   return Arena::CreateMessageInternal< ::mju::CSCreateRoom >(arena);
@@ -3621,6 +5292,18 @@ template<> PROTOBUF_NOINLINE ::mju::SCSystemMessage*
 Arena::CreateMaybeMessage< ::mju::SCSystemMessage >(Arena* arena) {
   return Arena::CreateMessageInternal< ::mju::SCSystemMessage >(arena);
 }
+template<> PROTOBUF_NOINLINE ::mju::BatchEntry*
+Arena::CreateMaybeMessage< ::mju::BatchEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mju::BatchEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mju::CSBatch*
+Arena::CreateMaybeMessage< ::mju::CSBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mju::CSBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mju::SCBatch*
+Arena::CreateMaybeMessage< ::mju::SCBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::mju::SCBatch >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
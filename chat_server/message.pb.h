@@ -47,6 +47,12 @@ struct TableStruct_message_2eproto {
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_message_2eproto;
 namespace mju {
+class BatchEntry;
+struct BatchEntryDefaultTypeInternal;
+extern BatchEntryDefaultTypeInternal _BatchEntry_default_instance_;
+class CSBatch;
+struct CSBatchDefaultTypeInternal;
+extern CSBatchDefaultTypeInternal _CSBatch_default_instance_;
 class CSChat;
 struct CSChatDefaultTypeInternal;
 extern CSChatDefaultTypeInternal _CSChat_default_instance_;
@@ -65,9 +71,15 @@ extern CSNameDefaultTypeInternal _CSName_default_instance_;
 class CSRooms;
 struct CSRoomsDefaultTypeInternal;
 extern CSRoomsDefaultTypeInternal _CSRooms_default_instance_;
+class CSSearchRooms;
+struct CSSearchRoomsDefaultTypeInternal;
+extern CSSearchRoomsDefaultTypeInternal _CSSearchRooms_default_instance_;
 class CSShutdown;
 struct CSShutdownDefaultTypeInternal;
 extern CSShutdownDefaultTypeInternal _CSShutdown_default_instance_;
+class SCBatch;
+struct SCBatchDefaultTypeInternal;
+extern SCBatchDefaultTypeInternal _SCBatch_default_instance_;
 class SCChat;
 struct SCChatDefaultTypeInternal;
 extern SCChatDefaultTypeInternal _SCChat_default_instance_;
@@ -97,13 +109,17 @@ struct TypeDefaultTypeInternal;
 extern TypeDefaultTypeInternal _Type_default_instance_;
 }  // namespace mju
 PROTOBUF_NAMESPACE_OPEN
+template<> ::mju::BatchEntry* Arena::CreateMaybeMessage<::mju::BatchEntry>(Arena*);
+template<> ::mju::CSBatch* Arena::CreateMaybeMessage<::mju::CSBatch>(Arena*);
 template<> ::mju::CSChat* Arena::CreateMaybeMessage<::mju::CSChat>(Arena*);
 template<> ::mju::CSCreateRoom* Arena::CreateMaybeMessage<::mju::CSCreateRoom>(Arena*);
 template<> ::mju::CSJoinRoom* Arena::CreateMaybeMessage<::mju::CSJoinRoom>(Arena*);
 template<> ::mju::CSLeaveRoom* Arena::CreateMaybeMessage<::mju::CSLeaveRoom>(Arena*);
 template<> ::mju::CSName* Arena::CreateMaybeMessage<::mju::CSName>(Arena*);
 template<> ::mju::CSRooms* Arena::CreateMaybeMessage<::mju::CSRooms>(Arena*);
+template<> ::mju::CSSearchRooms* Arena::CreateMaybeMessage<::mju::CSSearchRooms>(Arena*);
 template<> ::mju::CSShutdown* Arena::CreateMaybeMessage<::mju::CSShutdown>(Arena*);
+template<> ::mju::SCBatch* Arena::CreateMaybeMessage<::mju::SCBatch>(Arena*);
 template<> ::mju::SCChat* Arena::CreateMaybeMessage<::mju::SCChat>(Arena*);
 template<> ::mju::SCCreateRoomResult* Arena::CreateMaybeMessage<::mju::SCCreateRoomResult>(Arena*);
 template<> ::mju::SCJoinRoomResult* Arena::CreateMaybeMessage<::mju::SCJoinRoomResult>(Arena*);
@@ -124,13 +140,16 @@ enum Type_MessageType : int {
   Type_MessageType_CS_LEAVE_ROOM = 4,
   Type_MessageType_CS_CHAT = 5,
   Type_MessageType_CS_SHUTDOWN = 6,
+  Type_MessageType_CS_BATCH = 10,
+  Type_MessageType_CS_SEARCH_ROOMS = 12,
   Type_MessageType_SC_ROOMS_RESULT = 7,
   Type_MessageType_SC_CHAT = 8,
-  Type_MessageType_SC_SYSTEM_MESSAGE = 9
+  Type_MessageType_SC_SYSTEM_MESSAGE = 9,
+  Type_MessageType_SC_BATCH = 11
 };
 bool Type_MessageType_IsValid(int value);
 constexpr Type_MessageType Type_MessageType_MessageType_MIN = Type_MessageType_CS_NAME;
-constexpr Type_MessageType Type_MessageType_MessageType_MAX = Type_MessageType_SC_SYSTEM_MESSAGE;
+constexpr Type_MessageType Type_MessageType_MessageType_MAX = Type_MessageType_CS_SEARCH_ROOMS;
 constexpr int Type_MessageType_MessageType_ARRAYSIZE = Type_MessageType_MessageType_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Type_MessageType_descriptor();
@@ -147,6 +166,30 @@ inline bool Type_MessageType_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Type_MessageType>(
     Type_MessageType_descriptor(), name, value);
 }
+enum CSRooms_Sort : int {
+  CSRooms_Sort_ID = 0,
+  CSRooms_Sort_MEMBERS = 1,
+  CSRooms_Sort_ACTIVITY = 2
+};
+bool CSRooms_Sort_IsValid(int value);
+constexpr CSRooms_Sort CSRooms_Sort_Sort_MIN = CSRooms_Sort_ID;
+constexpr CSRooms_Sort CSRooms_Sort_Sort_MAX = CSRooms_Sort_ACTIVITY;
+constexpr int CSRooms_Sort_Sort_ARRAYSIZE = CSRooms_Sort_Sort_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CSRooms_Sort_descriptor();
+template<typename T>
+inline const std::string& CSRooms_Sort_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, CSRooms_Sort>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function CSRooms_Sort_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    CSRooms_Sort_descriptor(), enum_t_value);
+}
+inline bool CSRooms_Sort_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CSRooms_Sort* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CSRooms_Sort>(
+    CSRooms_Sort_descriptor(), name, value);
+}
 // ===================================================================
 
 class Type final :
@@ -289,12 +332,18 @@ class Type final :
     Type_MessageType_CS_CHAT;
   static constexpr MessageType CS_SHUTDOWN =
     Type_MessageType_CS_SHUTDOWN;
+  static constexpr MessageType CS_BATCH =
+    Type_MessageType_CS_BATCH;
+  static constexpr MessageType CS_SEARCH_ROOMS =
+    Type_MessageType_CS_SEARCH_ROOMS;
   static constexpr MessageType SC_ROOMS_RESULT =
     Type_MessageType_SC_ROOMS_RESULT;
   static constexpr MessageType SC_CHAT =
     Type_MessageType_SC_CHAT;
   static constexpr MessageType SC_SYSTEM_MESSAGE =
     Type_MessageType_SC_SYSTEM_MESSAGE;
+  static constexpr MessageType SC_BATCH =
+    Type_MessageType_SC_BATCH;
   static inline bool MessageType_IsValid(int value) {
     return Type_MessageType_IsValid(value);
   }
@@ -521,9 +570,10 @@ class CSName final :
 // -------------------------------------------------------------------
 
 class CSRooms final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:mju.CSRooms) */ {
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mju.CSRooms) */ {
  public:
   inline CSRooms() : CSRooms(nullptr) {}
+  ~CSRooms() override;
   explicit PROTOBUF_CONSTEXPR CSRooms(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CSRooms(const CSRooms& from);
@@ -603,15 +653,29 @@ class CSRooms final :
   CSRooms* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CSRooms>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const CSRooms& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const CSRooms& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSRooms& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSRooms& from) {
+    CSRooms::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSRooms* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
@@ -630,8 +694,108 @@ class CSRooms final :
 
   // nested types ----------------------------------------------------
 
+  typedef CSRooms_Sort Sort;
+  static constexpr Sort ID =
+    CSRooms_Sort_ID;
+  static constexpr Sort MEMBERS =
+    CSRooms_Sort_MEMBERS;
+  static constexpr Sort ACTIVITY =
+    CSRooms_Sort_ACTIVITY;
+  static inline bool Sort_IsValid(int value) {
+    return CSRooms_Sort_IsValid(value);
+  }
+  static constexpr Sort Sort_MIN =
+    CSRooms_Sort_Sort_MIN;
+  static constexpr Sort Sort_MAX =
+    CSRooms_Sort_Sort_MAX;
+  static constexpr int Sort_ARRAYSIZE =
+    CSRooms_Sort_Sort_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Sort_descriptor() {
+    return CSRooms_Sort_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Sort_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Sort>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Sort_Name.");
+    return CSRooms_Sort_Name(enum_t_value);
+  }
+  static inline bool Sort_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Sort* value) {
+    return CSRooms_Sort_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kCursorFieldNumber = 1,
+    kTitlePrefixFieldNumber = 3,
+    kLimitFieldNumber = 2,
+    kSortFieldNumber = 4,
+  };
+  // optional string cursor = 1;
+  bool has_cursor() const;
+  private:
+  bool _internal_has_cursor() const;
+  public:
+  void clear_cursor();
+  const std::string& cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cursor();
+  PROTOBUF_NODISCARD std::string* release_cursor();
+  void set_allocated_cursor(std::string* cursor);
+  private:
+  const std::string& _internal_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cursor(const std::string& value);
+  std::string* _internal_mutable_cursor();
+  public:
+
+  // optional string titlePrefix = 3;
+  bool has_titleprefix() const;
+  private:
+  bool _internal_has_titleprefix() const;
+  public:
+  void clear_titleprefix();
+  const std::string& titleprefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_titleprefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_titleprefix();
+  PROTOBUF_NODISCARD std::string* release_titleprefix();
+  void set_allocated_titleprefix(std::string* titleprefix);
+  private:
+  const std::string& _internal_titleprefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_titleprefix(const std::string& value);
+  std::string* _internal_mutable_titleprefix();
+  public:
+
+  // optional int32 limit = 2;
+  bool has_limit() const;
+  private:
+  bool _internal_has_limit() const;
+  public:
+  void clear_limit();
+  int32_t limit() const;
+  void set_limit(int32_t value);
+  private:
+  int32_t _internal_limit() const;
+  void _internal_set_limit(int32_t value);
+  public:
+
+  // optional .mju.CSRooms.Sort sort = 4;
+  bool has_sort() const;
+  private:
+  bool _internal_has_sort() const;
+  public:
+  void clear_sort();
+  ::mju::CSRooms_Sort sort() const;
+  void set_sort(::mju::CSRooms_Sort value);
+  private:
+  ::mju::CSRooms_Sort _internal_sort() const;
+  void _internal_set_sort(::mju::CSRooms_Sort value);
+  public:
+
   // @@protoc_insertion_point(class_scope:mju.CSRooms)
  private:
   class _Internal;
@@ -640,7 +804,194 @@ class CSRooms final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cursor_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr titleprefix_;
+    int32_t limit_;
+    int sort_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSSearchRooms final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mju.CSSearchRooms) */ {
+ public:
+  inline CSSearchRooms() : CSSearchRooms(nullptr) {}
+  ~CSSearchRooms() override;
+  explicit PROTOBUF_CONSTEXPR CSSearchRooms(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSSearchRooms(const CSSearchRooms& from);
+  CSSearchRooms(CSSearchRooms&& from) noexcept
+    : CSSearchRooms() {
+    *this = ::std::move(from);
+  }
+
+  inline CSSearchRooms& operator=(const CSSearchRooms& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSSearchRooms& operator=(CSSearchRooms&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSSearchRooms& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSSearchRooms* internal_default_instance() {
+    return reinterpret_cast<const CSSearchRooms*>(
+               &_CSSearchRooms_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(CSSearchRooms& a, CSSearchRooms& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSSearchRooms* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSSearchRooms* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSSearchRooms* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSSearchRooms>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSSearchRooms& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSSearchRooms& from) {
+    CSSearchRooms::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSSearchRooms* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mju.CSSearchRooms";
+  }
+  protected:
+  explicit CSSearchRooms(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kQueryFieldNumber = 1,
+    kLimitFieldNumber = 2,
+  };
+  // required string query = 1;
+  bool has_query() const;
+  private:
+  bool _internal_has_query() const;
+  public:
+  void clear_query();
+  const std::string& query() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_query(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_query();
+  PROTOBUF_NODISCARD std::string* release_query();
+  void set_allocated_query(std::string* query);
+  private:
+  const std::string& _internal_query() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_query(const std::string& value);
+  std::string* _internal_mutable_query();
+  public:
+
+  // optional int32 limit = 2;
+  bool has_limit() const;
+  private:
+  bool _internal_has_limit() const;
+  public:
+  void clear_limit();
+  int32_t limit() const;
+  void set_limit(int32_t value);
+  private:
+  int32_t _internal_limit() const;
+  void _internal_set_limit(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mju.CSSearchRooms)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr query_;
+    int32_t limit_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
@@ -700,7 +1051,7 @@ class CSCreateRoom final :
                &_CSCreateRoom_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
   friend void swap(CSCreateRoom& a, CSCreateRoom& b) {
     a.Swap(&b);
@@ -865,7 +1216,7 @@ class CSJoinRoom final :
                &_CSJoinRoom_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
   friend void swap(CSJoinRoom& a, CSJoinRoom& b) {
     a.Swap(&b);
@@ -971,9 +1322,10 @@ class CSJoinRoom final :
 // -------------------------------------------------------------------
 
 class CSLeaveRoom final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:mju.CSLeaveRoom) */ {
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mju.CSLeaveRoom) */ {
  public:
   inline CSLeaveRoom() : CSLeaveRoom(nullptr) {}
+  ~CSLeaveRoom() override;
   explicit PROTOBUF_CONSTEXPR CSLeaveRoom(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   CSLeaveRoom(const CSLeaveRoom& from);
@@ -1024,7 +1376,7 @@ class CSLeaveRoom final :
                &_CSLeaveRoom_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    6;
 
   friend void swap(CSLeaveRoom& a, CSLeaveRoom& b) {
     a.Swap(&b);
@@ -1053,15 +1405,29 @@ class CSLeaveRoom final :
   CSLeaveRoom* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<CSLeaveRoom>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const CSLeaveRoom& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const CSLeaveRoom& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSLeaveRoom& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSLeaveRoom& from) {
+    CSLeaveRoom::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSLeaveRoom* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
@@ -1082,6 +1448,22 @@ class CSLeaveRoom final :
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kRoomIdFieldNumber = 1,
+  };
+  // optional int32 roomId = 1;
+  bool has_roomid() const;
+  private:
+  bool _internal_has_roomid() const;
+  public:
+  void clear_roomid();
+  int32_t roomid() const;
+  void set_roomid(int32_t value);
+  private:
+  int32_t _internal_roomid() const;
+  void _internal_set_roomid(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:mju.CSLeaveRoom)
  private:
   class _Internal;
@@ -1090,7 +1472,11 @@ class CSLeaveRoom final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t roomid_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1150,7 +1536,7 @@ class CSChat final :
                &_CSChat_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    7;
 
   friend void swap(CSChat& a, CSChat& b) {
     a.Swap(&b);
@@ -1224,6 +1610,7 @@ class CSChat final :
 
   enum : int {
     kTextFieldNumber = 1,
+    kRoomIdFieldNumber = 2,
   };
   // required string text = 1;
   bool has_text() const;
@@ -1243,6 +1630,19 @@ class CSChat final :
   std::string* _internal_mutable_text();
   public:
 
+  // optional int32 roomId = 2;
+  bool has_roomid() const;
+  private:
+  bool _internal_has_roomid() const;
+  public:
+  void clear_roomid();
+  int32_t roomid() const;
+  void set_roomid(int32_t value);
+  private:
+  int32_t _internal_roomid() const;
+  void _internal_set_roomid(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:mju.CSChat)
  private:
   class _Internal;
@@ -1254,6 +1654,7 @@ class CSChat final :
     ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    int32_t roomid_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
@@ -1314,7 +1715,7 @@ class CSShutdown final :
                &_CSShutdown_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    8;
 
   friend void swap(CSShutdown& a, CSShutdown& b) {
     a.Swap(&b);
@@ -1440,7 +1841,7 @@ class SCNameResult final :
                &_SCNameResult_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    9;
 
   friend void swap(SCNameResult& a, SCNameResult& b) {
     a.Swap(&b);
@@ -1605,7 +2006,7 @@ class SCRoomsResult_RoomInfo final :
                &_SCRoomsResult_RoomInfo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    10;
 
   friend void swap(SCRoomsResult_RoomInfo& a, SCRoomsResult_RoomInfo& b) {
     a.Swap(&b);
@@ -1811,7 +2212,7 @@ class SCRoomsResult final :
                &_SCRoomsResult_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    11;
 
   friend void swap(SCRoomsResult& a, SCRoomsResult& b) {
     a.Swap(&b);
@@ -1887,6 +2288,7 @@ class SCRoomsResult final :
 
   enum : int {
     kRoomsFieldNumber = 1,
+    kNextCursorFieldNumber = 2,
   };
   // repeated .mju.SCRoomsResult.RoomInfo rooms = 1;
   int rooms_size() const;
@@ -1906,6 +2308,24 @@ class SCRoomsResult final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mju::SCRoomsResult_RoomInfo >&
       rooms() const;
 
+  // optional string nextCursor = 2;
+  bool has_nextcursor() const;
+  private:
+  bool _internal_has_nextcursor() const;
+  public:
+  void clear_nextcursor();
+  const std::string& nextcursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_nextcursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_nextcursor();
+  PROTOBUF_NODISCARD std::string* release_nextcursor();
+  void set_allocated_nextcursor(std::string* nextcursor);
+  private:
+  const std::string& _internal_nextcursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nextcursor(const std::string& value);
+  std::string* _internal_mutable_nextcursor();
+  public:
+
   // @@protoc_insertion_point(class_scope:mju.SCRoomsResult)
  private:
   class _Internal;
@@ -1914,8 +2334,10 @@ class SCRoomsResult final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mju::SCRoomsResult_RoomInfo > rooms_;
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mju::SCRoomsResult_RoomInfo > rooms_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nextcursor_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
@@ -1977,7 +2399,7 @@ class SCCreateRoomResult final :
                &_SCCreateRoomResult_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    12;
 
   friend void swap(SCCreateRoomResult& a, SCCreateRoomResult& b) {
     a.Swap(&b);
@@ -2142,7 +2564,7 @@ class SCJoinRoomResult final :
                &_SCJoinRoomResult_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    13;
 
   friend void swap(SCJoinRoomResult& a, SCJoinRoomResult& b) {
     a.Swap(&b);
@@ -2307,7 +2729,7 @@ class SCLeaveRoomResult final :
                &_SCLeaveRoomResult_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    13;
+    14;
 
   friend void swap(SCLeaveRoomResult& a, SCLeaveRoomResult& b) {
     a.Swap(&b);
@@ -2472,7 +2894,7 @@ class SCChat final :
                &_SCChat_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    14;
+    15;
 
   friend void swap(SCChat& a, SCChat& b) {
     a.Swap(&b);
@@ -2547,6 +2969,7 @@ class SCChat final :
   enum : int {
     kMemberFieldNumber = 1,
     kTextFieldNumber = 2,
+    kRoomIdFieldNumber = 3,
   };
   // required string member = 1;
   bool has_member() const;
@@ -2584,6 +3007,19 @@ class SCChat final :
   std::string* _internal_mutable_text();
   public:
 
+  // optional int32 roomId = 3;
+  bool has_roomid() const;
+  private:
+  bool _internal_has_roomid() const;
+  public:
+  void clear_roomid();
+  int32_t roomid() const;
+  void set_roomid(int32_t value);
+  private:
+  int32_t _internal_roomid() const;
+  void _internal_set_roomid(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:mju.SCChat)
  private:
   class _Internal;
@@ -2599,6 +3035,7 @@ class SCChat final :
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr member_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    int32_t roomid_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
@@ -2660,7 +3097,7 @@ class SCSystemMessage final :
                &_SCSystemMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    15;
+    16;
 
   friend void swap(SCSystemMessage& a, SCSystemMessage& b) {
     a.Swap(&b);
@@ -2768,157 +3205,958 @@ class SCSystemMessage final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
-// ===================================================================
-
+// -------------------------------------------------------------------
 
-// ===================================================================
+class BatchEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mju.BatchEntry) */ {
+ public:
+  inline BatchEntry() : BatchEntry(nullptr) {}
+  ~BatchEntry() override;
+  explicit PROTOBUF_CONSTEXPR BatchEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Type
+  BatchEntry(const BatchEntry& from);
+  BatchEntry(BatchEntry&& from) noexcept
+    : BatchEntry() {
+    *this = ::std::move(from);
+  }
 
-// required .mju.Type.MessageType type = 1;
-inline bool Type::_internal_has_type() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline bool Type::has_type() const {
-  return _internal_has_type();
-}
-inline void Type::clear_type() {
-  _impl_.type_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline ::mju::Type_MessageType Type::_internal_type() const {
-  return static_cast< ::mju::Type_MessageType >(_impl_.type_);
-}
-inline ::mju::Type_MessageType Type::type() const {
-  // @@protoc_insertion_point(field_get:mju.Type.type)
-  return _internal_type();
-}
-inline void Type::_internal_set_type(::mju::Type_MessageType value) {
-  assert(::mju::Type_MessageType_IsValid(value));
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.type_ = value;
-}
-inline void Type::set_type(::mju::Type_MessageType value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:mju.Type.type)
-}
+  inline BatchEntry& operator=(const BatchEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchEntry& operator=(BatchEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// -------------------------------------------------------------------
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
 
-// CSName
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchEntry* internal_default_instance() {
+    return reinterpret_cast<const BatchEntry*>(
+               &_BatchEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
 
-// required string name = 1;
-inline bool CSName::_internal_has_name() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline bool CSName::has_name() const {
-  return _internal_has_name();
-}
-inline void CSName::clear_name() {
-  _impl_.name_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& CSName::name() const {
-  // @@protoc_insertion_point(field_get:mju.CSName.name)
-  return _internal_name();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void CSName::set_name(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:mju.CSName.name)
-}
-inline std::string* CSName::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:mju.CSName.name)
-  return _s;
-}
-inline const std::string& CSName::_internal_name() const {
-  return _impl_.name_.Get();
-}
-inline void CSName::_internal_set_name(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.name_.Set(value, GetArenaForAllocation());
-}
-inline std::string* CSName::_internal_mutable_name() {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.name_.Mutable(GetArenaForAllocation());
-}
-inline std::string* CSName::release_name() {
-  // @@protoc_insertion_point(field_release:mju.CSName.name)
-  if (!_internal_has_name()) {
-    return nullptr;
+  friend void swap(BatchEntry& a, BatchEntry& b) {
+    a.Swap(&b);
   }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.name_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+  inline void Swap(BatchEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
-}
-inline void CSName::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
+  void UnsafeArenaSwap(BatchEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+
+  // implements Message ----------------------------------------------
+
+  BatchEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchEntry>(arena);
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:mju.CSName.name)
-}
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchEntry& from) {
+    BatchEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// -------------------------------------------------------------------
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// CSRooms
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchEntry* other);
 
-// -------------------------------------------------------------------
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mju.BatchEntry";
+  }
+  protected:
+  explicit BatchEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
 
-// CSCreateRoom
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-// optional string title = 1;
-inline bool CSCreateRoom::_internal_has_title() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline bool CSCreateRoom::has_title() const {
-  return _internal_has_title();
-}
-inline void CSCreateRoom::clear_title() {
-  _impl_.title_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& CSCreateRoom::title() const {
-  // @@protoc_insertion_point(field_get:mju.CSCreateRoom.title)
-  return _internal_title();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void CSCreateRoom::set_title(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.title_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:mju.CSCreateRoom.title)
-}
-inline std::string* CSCreateRoom::mutable_title() {
-  std::string* _s = _internal_mutable_title();
-  // @@protoc_insertion_point(field_mutable:mju.CSCreateRoom.title)
-  return _s;
-}
-inline const std::string& CSCreateRoom::_internal_title() const {
-  return _impl_.title_.Get();
-}
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBodyFieldNumber = 2,
+    kTypeFieldNumber = 1,
+  };
+  // optional bytes body = 2;
+  bool has_body() const;
+  private:
+  bool _internal_has_body() const;
+  public:
+  void clear_body();
+  const std::string& body() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_body(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_body();
+  PROTOBUF_NODISCARD std::string* release_body();
+  void set_allocated_body(std::string* body);
+  private:
+  const std::string& _internal_body() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
+  std::string* _internal_mutable_body();
+  public:
+
+  // required .mju.Type.MessageType type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::mju::Type_MessageType type() const;
+  void set_type(::mju::Type_MessageType value);
+  private:
+  ::mju::Type_MessageType _internal_type() const;
+  void _internal_set_type(::mju::Type_MessageType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mju.BatchEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CSBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mju.CSBatch) */ {
+ public:
+  inline CSBatch() : CSBatch(nullptr) {}
+  ~CSBatch() override;
+  explicit PROTOBUF_CONSTEXPR CSBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CSBatch(const CSBatch& from);
+  CSBatch(CSBatch&& from) noexcept
+    : CSBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline CSBatch& operator=(const CSBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CSBatch& operator=(CSBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CSBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CSBatch* internal_default_instance() {
+    return reinterpret_cast<const CSBatch*>(
+               &_CSBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(CSBatch& a, CSBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CSBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CSBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CSBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CSBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CSBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CSBatch& from) {
+    CSBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CSBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mju.CSBatch";
+  }
+  protected:
+  explicit CSBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessagesFieldNumber = 1,
+  };
+  // repeated .mju.BatchEntry messages = 1;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  ::mju::BatchEntry* mutable_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mju::BatchEntry >*
+      mutable_messages();
+  private:
+  const ::mju::BatchEntry& _internal_messages(int index) const;
+  ::mju::BatchEntry* _internal_add_messages();
+  public:
+  const ::mju::BatchEntry& messages(int index) const;
+  ::mju::BatchEntry* add_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mju::BatchEntry >&
+      messages() const;
+
+  // @@protoc_insertion_point(class_scope:mju.CSBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mju::BatchEntry > messages_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SCBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mju.SCBatch) */ {
+ public:
+  inline SCBatch() : SCBatch(nullptr) {}
+  ~SCBatch() override;
+  explicit PROTOBUF_CONSTEXPR SCBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SCBatch(const SCBatch& from);
+  SCBatch(SCBatch&& from) noexcept
+    : SCBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline SCBatch& operator=(const SCBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SCBatch& operator=(SCBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SCBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SCBatch* internal_default_instance() {
+    return reinterpret_cast<const SCBatch*>(
+               &_SCBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(SCBatch& a, SCBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SCBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SCBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SCBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SCBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SCBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SCBatch& from) {
+    SCBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SCBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mju.SCBatch";
+  }
+  protected:
+  explicit SCBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessagesFieldNumber = 1,
+  };
+  // repeated .mju.BatchEntry messages = 1;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  ::mju::BatchEntry* mutable_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mju::BatchEntry >*
+      mutable_messages();
+  private:
+  const ::mju::BatchEntry& _internal_messages(int index) const;
+  ::mju::BatchEntry* _internal_add_messages();
+  public:
+  const ::mju::BatchEntry& messages(int index) const;
+  ::mju::BatchEntry* add_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mju::BatchEntry >&
+      messages() const;
+
+  // @@protoc_insertion_point(class_scope:mju.SCBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mju::BatchEntry > messages_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_message_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Type
+
+// required .mju.Type.MessageType type = 1;
+inline bool Type::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Type::has_type() const {
+  return _internal_has_type();
+}
+inline void Type::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::mju::Type_MessageType Type::_internal_type() const {
+  return static_cast< ::mju::Type_MessageType >(_impl_.type_);
+}
+inline ::mju::Type_MessageType Type::type() const {
+  // @@protoc_insertion_point(field_get:mju.Type.type)
+  return _internal_type();
+}
+inline void Type::_internal_set_type(::mju::Type_MessageType value) {
+  assert(::mju::Type_MessageType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.type_ = value;
+}
+inline void Type::set_type(::mju::Type_MessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:mju.Type.type)
+}
+
+// -------------------------------------------------------------------
+
+// CSName
+
+// required string name = 1;
+inline bool CSName::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSName::has_name() const {
+  return _internal_has_name();
+}
+inline void CSName::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSName::name() const {
+  // @@protoc_insertion_point(field_get:mju.CSName.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSName::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mju.CSName.name)
+}
+inline std::string* CSName::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:mju.CSName.name)
+  return _s;
+}
+inline const std::string& CSName::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CSName::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSName::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSName::release_name() {
+  // @@protoc_insertion_point(field_release:mju.CSName.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSName::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mju.CSName.name)
+}
+
+// -------------------------------------------------------------------
+
+// CSRooms
+
+// optional string cursor = 1;
+inline bool CSRooms::_internal_has_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSRooms::has_cursor() const {
+  return _internal_has_cursor();
+}
+inline void CSRooms::clear_cursor() {
+  _impl_.cursor_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSRooms::cursor() const {
+  // @@protoc_insertion_point(field_get:mju.CSRooms.cursor)
+  return _internal_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSRooms::set_cursor(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mju.CSRooms.cursor)
+}
+inline std::string* CSRooms::mutable_cursor() {
+  std::string* _s = _internal_mutable_cursor();
+  // @@protoc_insertion_point(field_mutable:mju.CSRooms.cursor)
+  return _s;
+}
+inline const std::string& CSRooms::_internal_cursor() const {
+  return _impl_.cursor_.Get();
+}
+inline void CSRooms::_internal_set_cursor(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSRooms::_internal_mutable_cursor() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSRooms::release_cursor() {
+  // @@protoc_insertion_point(field_release:mju.CSRooms.cursor)
+  if (!_internal_has_cursor()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.cursor_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSRooms::set_allocated_cursor(std::string* cursor) {
+  if (cursor != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.cursor_.SetAllocated(cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mju.CSRooms.cursor)
+}
+
+// optional int32 limit = 2;
+inline bool CSRooms::_internal_has_limit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CSRooms::has_limit() const {
+  return _internal_has_limit();
+}
+inline void CSRooms::clear_limit() {
+  _impl_.limit_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t CSRooms::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline int32_t CSRooms::limit() const {
+  // @@protoc_insertion_point(field_get:mju.CSRooms.limit)
+  return _internal_limit();
+}
+inline void CSRooms::_internal_set_limit(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.limit_ = value;
+}
+inline void CSRooms::set_limit(int32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:mju.CSRooms.limit)
+}
+
+// optional string titlePrefix = 3;
+inline bool CSRooms::_internal_has_titleprefix() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSRooms::has_titleprefix() const {
+  return _internal_has_titleprefix();
+}
+inline void CSRooms::clear_titleprefix() {
+  _impl_.titleprefix_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CSRooms::titleprefix() const {
+  // @@protoc_insertion_point(field_get:mju.CSRooms.titlePrefix)
+  return _internal_titleprefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSRooms::set_titleprefix(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.titleprefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mju.CSRooms.titlePrefix)
+}
+inline std::string* CSRooms::mutable_titleprefix() {
+  std::string* _s = _internal_mutable_titleprefix();
+  // @@protoc_insertion_point(field_mutable:mju.CSRooms.titlePrefix)
+  return _s;
+}
+inline const std::string& CSRooms::_internal_titleprefix() const {
+  return _impl_.titleprefix_.Get();
+}
+inline void CSRooms::_internal_set_titleprefix(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.titleprefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSRooms::_internal_mutable_titleprefix() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.titleprefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSRooms::release_titleprefix() {
+  // @@protoc_insertion_point(field_release:mju.CSRooms.titlePrefix)
+  if (!_internal_has_titleprefix()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.titleprefix_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.titleprefix_.IsDefault()) {
+    _impl_.titleprefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSRooms::set_allocated_titleprefix(std::string* titleprefix) {
+  if (titleprefix != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.titleprefix_.SetAllocated(titleprefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.titleprefix_.IsDefault()) {
+    _impl_.titleprefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mju.CSRooms.titlePrefix)
+}
+
+// optional .mju.CSRooms.Sort sort = 4;
+inline bool CSRooms::_internal_has_sort() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CSRooms::has_sort() const {
+  return _internal_has_sort();
+}
+inline void CSRooms::clear_sort() {
+  _impl_.sort_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::mju::CSRooms_Sort CSRooms::_internal_sort() const {
+  return static_cast< ::mju::CSRooms_Sort >(_impl_.sort_);
+}
+inline ::mju::CSRooms_Sort CSRooms::sort() const {
+  // @@protoc_insertion_point(field_get:mju.CSRooms.sort)
+  return _internal_sort();
+}
+inline void CSRooms::_internal_set_sort(::mju::CSRooms_Sort value) {
+  assert(::mju::CSRooms_Sort_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.sort_ = value;
+}
+inline void CSRooms::set_sort(::mju::CSRooms_Sort value) {
+  _internal_set_sort(value);
+  // @@protoc_insertion_point(field_set:mju.CSRooms.sort)
+}
+
+// -------------------------------------------------------------------
+
+// CSSearchRooms
+
+// required string query = 1;
+inline bool CSSearchRooms::_internal_has_query() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSSearchRooms::has_query() const {
+  return _internal_has_query();
+}
+inline void CSSearchRooms::clear_query() {
+  _impl_.query_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSSearchRooms::query() const {
+  // @@protoc_insertion_point(field_get:mju.CSSearchRooms.query)
+  return _internal_query();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSSearchRooms::set_query(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.query_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mju.CSSearchRooms.query)
+}
+inline std::string* CSSearchRooms::mutable_query() {
+  std::string* _s = _internal_mutable_query();
+  // @@protoc_insertion_point(field_mutable:mju.CSSearchRooms.query)
+  return _s;
+}
+inline const std::string& CSSearchRooms::_internal_query() const {
+  return _impl_.query_.Get();
+}
+inline void CSSearchRooms::_internal_set_query(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.query_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CSSearchRooms::_internal_mutable_query() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.query_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CSSearchRooms::release_query() {
+  // @@protoc_insertion_point(field_release:mju.CSSearchRooms.query)
+  if (!_internal_has_query()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.query_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.query_.IsDefault()) {
+    _impl_.query_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CSSearchRooms::set_allocated_query(std::string* query) {
+  if (query != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.query_.SetAllocated(query, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.query_.IsDefault()) {
+    _impl_.query_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mju.CSSearchRooms.query)
+}
+
+// optional int32 limit = 2;
+inline bool CSSearchRooms::_internal_has_limit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSSearchRooms::has_limit() const {
+  return _internal_has_limit();
+}
+inline void CSSearchRooms::clear_limit() {
+  _impl_.limit_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSSearchRooms::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline int32_t CSSearchRooms::limit() const {
+  // @@protoc_insertion_point(field_get:mju.CSSearchRooms.limit)
+  return _internal_limit();
+}
+inline void CSSearchRooms::_internal_set_limit(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.limit_ = value;
+}
+inline void CSSearchRooms::set_limit(int32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:mju.CSSearchRooms.limit)
+}
+
+// -------------------------------------------------------------------
+
+// CSCreateRoom
+
+// optional string title = 1;
+inline bool CSCreateRoom::_internal_has_title() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSCreateRoom::has_title() const {
+  return _internal_has_title();
+}
+inline void CSCreateRoom::clear_title() {
+  _impl_.title_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CSCreateRoom::title() const {
+  // @@protoc_insertion_point(field_get:mju.CSCreateRoom.title)
+  return _internal_title();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CSCreateRoom::set_title(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.title_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mju.CSCreateRoom.title)
+}
+inline std::string* CSCreateRoom::mutable_title() {
+  std::string* _s = _internal_mutable_title();
+  // @@protoc_insertion_point(field_mutable:mju.CSCreateRoom.title)
+  return _s;
+}
+inline const std::string& CSCreateRoom::_internal_title() const {
+  return _impl_.title_.Get();
+}
 inline void CSCreateRoom::_internal_set_title(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.title_.Set(value, GetArenaForAllocation());
@@ -2992,6 +4230,34 @@ inline void CSJoinRoom::set_roomid(int32_t value) {
 
 // CSLeaveRoom
 
+// optional int32 roomId = 1;
+inline bool CSLeaveRoom::_internal_has_roomid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CSLeaveRoom::has_roomid() const {
+  return _internal_has_roomid();
+}
+inline void CSLeaveRoom::clear_roomid() {
+  _impl_.roomid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t CSLeaveRoom::_internal_roomid() const {
+  return _impl_.roomid_;
+}
+inline int32_t CSLeaveRoom::roomid() const {
+  // @@protoc_insertion_point(field_get:mju.CSLeaveRoom.roomId)
+  return _internal_roomid();
+}
+inline void CSLeaveRoom::_internal_set_roomid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.roomid_ = value;
+}
+inline void CSLeaveRoom::set_roomid(int32_t value) {
+  _internal_set_roomid(value);
+  // @@protoc_insertion_point(field_set:mju.CSLeaveRoom.roomId)
+}
+
 // -------------------------------------------------------------------
 
 // CSChat
@@ -3064,6 +4330,34 @@ inline void CSChat::set_allocated_text(std::string* text) {
   // @@protoc_insertion_point(field_set_allocated:mju.CSChat.text)
 }
 
+// optional int32 roomId = 2;
+inline bool CSChat::_internal_has_roomid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CSChat::has_roomid() const {
+  return _internal_has_roomid();
+}
+inline void CSChat::clear_roomid() {
+  _impl_.roomid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t CSChat::_internal_roomid() const {
+  return _impl_.roomid_;
+}
+inline int32_t CSChat::roomid() const {
+  // @@protoc_insertion_point(field_get:mju.CSChat.roomId)
+  return _internal_roomid();
+}
+inline void CSChat::_internal_set_roomid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.roomid_ = value;
+}
+inline void CSChat::set_roomid(int32_t value) {
+  _internal_set_roomid(value);
+  // @@protoc_insertion_point(field_set:mju.CSChat.roomId)
+}
+
 // -------------------------------------------------------------------
 
 // CSShutdown
@@ -3359,6 +4653,74 @@ SCRoomsResult::rooms() const {
   return _impl_.rooms_;
 }
 
+// optional string nextCursor = 2;
+inline bool SCRoomsResult::_internal_has_nextcursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SCRoomsResult::has_nextcursor() const {
+  return _internal_has_nextcursor();
+}
+inline void SCRoomsResult::clear_nextcursor() {
+  _impl_.nextcursor_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SCRoomsResult::nextcursor() const {
+  // @@protoc_insertion_point(field_get:mju.SCRoomsResult.nextCursor)
+  return _internal_nextcursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SCRoomsResult::set_nextcursor(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.nextcursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mju.SCRoomsResult.nextCursor)
+}
+inline std::string* SCRoomsResult::mutable_nextcursor() {
+  std::string* _s = _internal_mutable_nextcursor();
+  // @@protoc_insertion_point(field_mutable:mju.SCRoomsResult.nextCursor)
+  return _s;
+}
+inline const std::string& SCRoomsResult::_internal_nextcursor() const {
+  return _impl_.nextcursor_.Get();
+}
+inline void SCRoomsResult::_internal_set_nextcursor(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.nextcursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SCRoomsResult::_internal_mutable_nextcursor() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.nextcursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SCRoomsResult::release_nextcursor() {
+  // @@protoc_insertion_point(field_release:mju.SCRoomsResult.nextCursor)
+  if (!_internal_has_nextcursor()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.nextcursor_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nextcursor_.IsDefault()) {
+    _impl_.nextcursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SCRoomsResult::set_allocated_nextcursor(std::string* nextcursor) {
+  if (nextcursor != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.nextcursor_.SetAllocated(nextcursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.nextcursor_.IsDefault()) {
+    _impl_.nextcursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mju.SCRoomsResult.nextCursor)
+}
+
 // -------------------------------------------------------------------
 
 // SCCreateRoomResult
@@ -3715,6 +5077,34 @@ inline void SCChat::set_allocated_text(std::string* text) {
   // @@protoc_insertion_point(field_set_allocated:mju.SCChat.text)
 }
 
+// optional int32 roomId = 3;
+inline bool SCChat::_internal_has_roomid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SCChat::has_roomid() const {
+  return _internal_has_roomid();
+}
+inline void SCChat::clear_roomid() {
+  _impl_.roomid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t SCChat::_internal_roomid() const {
+  return _impl_.roomid_;
+}
+inline int32_t SCChat::roomid() const {
+  // @@protoc_insertion_point(field_get:mju.SCChat.roomId)
+  return _internal_roomid();
+}
+inline void SCChat::_internal_set_roomid(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.roomid_ = value;
+}
+inline void SCChat::set_roomid(int32_t value) {
+  _internal_set_roomid(value);
+  // @@protoc_insertion_point(field_set:mju.SCChat.roomId)
+}
+
 // -------------------------------------------------------------------
 
 // SCSystemMessage
@@ -3787,6 +5177,195 @@ inline void SCSystemMessage::set_allocated_text(std::string* text) {
   // @@protoc_insertion_point(field_set_allocated:mju.SCSystemMessage.text)
 }
 
+// -------------------------------------------------------------------
+
+// BatchEntry
+
+// required .mju.Type.MessageType type = 1;
+inline bool BatchEntry::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool BatchEntry::has_type() const {
+  return _internal_has_type();
+}
+inline void BatchEntry::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::mju::Type_MessageType BatchEntry::_internal_type() const {
+  return static_cast< ::mju::Type_MessageType >(_impl_.type_);
+}
+inline ::mju::Type_MessageType BatchEntry::type() const {
+  // @@protoc_insertion_point(field_get:mju.BatchEntry.type)
+  return _internal_type();
+}
+inline void BatchEntry::_internal_set_type(::mju::Type_MessageType value) {
+  assert(::mju::Type_MessageType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void BatchEntry::set_type(::mju::Type_MessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:mju.BatchEntry.type)
+}
+
+// optional bytes body = 2;
+inline bool BatchEntry::_internal_has_body() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool BatchEntry::has_body() const {
+  return _internal_has_body();
+}
+inline void BatchEntry::clear_body() {
+  _impl_.body_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BatchEntry::body() const {
+  // @@protoc_insertion_point(field_get:mju.BatchEntry.body)
+  return _internal_body();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchEntry::set_body(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.body_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:mju.BatchEntry.body)
+}
+inline std::string* BatchEntry::mutable_body() {
+  std::string* _s = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:mju.BatchEntry.body)
+  return _s;
+}
+inline const std::string& BatchEntry::_internal_body() const {
+  return _impl_.body_.Get();
+}
+inline void BatchEntry::_internal_set_body(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.body_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchEntry::_internal_mutable_body() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.body_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchEntry::release_body() {
+  // @@protoc_insertion_point(field_release:mju.BatchEntry.body)
+  if (!_internal_has_body()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.body_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BatchEntry::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:mju.BatchEntry.body)
+}
+
+// -------------------------------------------------------------------
+
+// CSBatch
+
+// repeated .mju.BatchEntry messages = 1;
+inline int CSBatch::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int CSBatch::messages_size() const {
+  return _internal_messages_size();
+}
+inline void CSBatch::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline ::mju::BatchEntry* CSBatch::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:mju.CSBatch.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mju::BatchEntry >*
+CSBatch::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:mju.CSBatch.messages)
+  return &_impl_.messages_;
+}
+inline const ::mju::BatchEntry& CSBatch::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const ::mju::BatchEntry& CSBatch::messages(int index) const {
+  // @@protoc_insertion_point(field_get:mju.CSBatch.messages)
+  return _internal_messages(index);
+}
+inline ::mju::BatchEntry* CSBatch::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline ::mju::BatchEntry* CSBatch::add_messages() {
+  ::mju::BatchEntry* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:mju.CSBatch.messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mju::BatchEntry >&
+CSBatch::messages() const {
+  // @@protoc_insertion_point(field_list:mju.CSBatch.messages)
+  return _impl_.messages_;
+}
+
+// -------------------------------------------------------------------
+
+// SCBatch
+
+// repeated .mju.BatchEntry messages = 1;
+inline int SCBatch::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int SCBatch::messages_size() const {
+  return _internal_messages_size();
+}
+inline void SCBatch::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline ::mju::BatchEntry* SCBatch::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:mju.SCBatch.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mju::BatchEntry >*
+SCBatch::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:mju.SCBatch.messages)
+  return &_impl_.messages_;
+}
+inline const ::mju::BatchEntry& SCBatch::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const ::mju::BatchEntry& SCBatch::messages(int index) const {
+  // @@protoc_insertion_point(field_get:mju.SCBatch.messages)
+  return _internal_messages(index);
+}
+inline ::mju::BatchEntry* SCBatch::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline ::mju::BatchEntry* SCBatch::add_messages() {
+  ::mju::BatchEntry* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:mju.SCBatch.messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::mju::BatchEntry >&
+SCBatch::messages() const {
+  // @@protoc_insertion_point(field_list:mju.SCBatch.messages)
+  return _impl_.messages_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -3820,6 +5399,14 @@ inline void SCSystemMessage::set_allocated_text(std::string* text) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -3832,6 +5419,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::mju::Type_MessageType>() {
   return ::mju::Type_MessageType_descriptor();
 }
+template <> struct is_proto_enum< ::mju::CSRooms_Sort> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::mju::CSRooms_Sort>() {
+  return ::mju::CSRooms_Sort_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
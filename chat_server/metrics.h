@@ -0,0 +1,474 @@
+/**
+ * @file metrics.h
+ * @brief 쓰레드별로 나눈 카운터, 게이지, 로그 버킷 히스토그램과 Prometheus 텍스트 포맷 출력
+ *
+ * 카운터와 히스토그램은 쓰레드마다 따로 샤드를 둔다. 쓰레드는 처음 기록할 때 고유한 슬롯 번호를 받고,
+ * 그 슬롯의 샤드는 그 쓰레드만 쓰므로 lock 접두사가 붙는 fetch_add 대신 relaxed load + store 로 기록한다.
+ * 샤드는 쓰레드가 그 지표를 처음 기록할 때 할당하고, 읽을 때(스크레이프)만 샤드를 모두 더한다.
+ * 슬롯을 다 쓴 뒤에 생긴 쓰레드는 공유 샤드에 fetch_add 한다.
+ *
+ * 히스토그램은 HDR 히스토그램처럼 2의 거듭제곱 구간(octave)을 다시 HISTOGRAM_SUB_BUCKETS 개로 나눈
+ * 로그-선형 버킷을 쓴다. 버킷 번호는 비트 연산 몇 번으로 구하고, 상대 오차는 1/HISTOGRAM_SUB_BUCKETS 이하이다.
+ * octave 를 32개로 나누므로 분위수 (버킷의 가장 큰 값) 는 실제 값보다 많아야 약 3.1% 크다.
+ * 샤드 하나가 버킷 1280개 (약 10KB) 이지만 그 지표를 기록한 쓰레드에만 할당된다.
+ */
+
+#ifndef CHAT_SERVER_METRICS_H
+#define CHAT_SERVER_METRICS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+static const size_t METRIC_MAX_THREADS = 64; ///< 전용 샤드를 받는 쓰레드 수
+
+/**
+ * @brief 이 쓰레드의 지표 슬롯. 쓰레드마다 처음 부를 때 정해지며 다른 쓰레드와 겹치지 않는다.
+ *
+ * @return METRIC_MAX_THREADS 이상이면 전용 샤드가 없는 쓰레드
+ */
+inline size_t metric_thread_slot() {
+  static std::atomic<size_t> next_slot {0};
+  thread_local size_t slot = next_slot.fetch_add(1, std::memory_order_relaxed);
+  return slot;
+}
+
+/**
+ * @brief 지연 시간을 잴 때 쓰는 단조 시각 (ns)
+ */
+inline uint64_t metric_now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief 생성부터 소멸까지 걸린 시간 (ns) 을 total 에 더한다.
+ */
+class ScopedTimer {
+  private:
+    uint64_t &total;
+    uint64_t start;
+
+  public:
+    explicit ScopedTimer(uint64_t &total) : total(total), start(metric_now_ns()) {}
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    ~ScopedTimer() {
+      total += metric_now_ns() - start;
+    }
+};
+
+/**
+ * @brief 한 쓰레드만 쓰는 값에 더한다. 읽는 쪽과는 relaxed atomic 으로 만난다.
+ */
+inline void add_exclusive(std::atomic<uint64_t> &value, uint64_t n) {
+  value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+/**
+ * @brief 쓰레드 슬롯마다 하나씩, 처음 쓸 때 할당되는 샤드 배열
+ *
+ * @tparam Shard 샤드 타입
+ */
+template <typename Shard>
+class ThreadShards {
+  private:
+    std::atomic<Shard *> shards[METRIC_MAX_THREADS] {};
+    Shard overflow; ///< 슬롯을 다 쓴 뒤에 생긴 쓰레드들이 함께 쓰는 샤드
+
+  public:
+    ThreadShards() {}
+
+    ThreadShards(const ThreadShards &) = delete;
+    ThreadShards &operator=(const ThreadShards &) = delete;
+
+    ~ThreadShards() {
+      for (auto &shard : shards) {
+        delete shard.load(std::memory_order_relaxed);
+      }
+    }
+
+    /**
+     * @brief 이 쓰레드의 샤드와, 그 샤드를 이 쓰레드만 쓰는지 여부
+     */
+    std::pair<Shard *, bool> local() {
+      size_t slot = metric_thread_slot();
+      if (slot >= METRIC_MAX_THREADS) {
+        return {&overflow, false};
+      }
+      Shard *shard = shards[slot].load(std::memory_order_relaxed);
+      if (shard == nullptr) {
+        shard = new Shard();
+        shards[slot].store(shard, std::memory_order_release);
+      }
+      return {shard, true};
+    }
+
+    /**
+     * @brief 할당된 모든 샤드에 fn 을 부른다.
+     */
+    template <typename Fn>
+    void for_each(Fn fn) const {
+      for (auto &shard : shards) {
+        Shard *current = shard.load(std::memory_order_acquire);
+        if (current != nullptr) {
+          fn(*current);
+        }
+      }
+      fn(overflow);
+    }
+};
+
+/**
+ * @brief 늘어나기만 하는 카운터
+ */
+class Counter {
+  private:
+    /**
+     * @brief 캐시 라인 하나를 차지하는 샤드
+     */
+    struct alignas(64) Shard {
+      std::atomic<uint64_t> value {0};
+    };
+
+    ThreadShards<Shard> shards;
+
+  public:
+    void inc(uint64_t n = 1) {
+      auto shard = shards.local();
+      if (shard.second) {
+        add_exclusive(shard.first->value, n);
+      } else {
+        shard.first->value.fetch_add(n, std::memory_order_relaxed);
+      }
+    }
+
+    //getter
+    uint64_t value() const {
+      uint64_t sum = 0;
+      shards.for_each([&sum](const Shard &shard) {sum += shard.value.load(std::memory_order_relaxed);});
+      return sum;
+    }
+};
+
+/**
+ * @brief 오르내리는 값. 자주 바뀌지 않는 값에 쓰므로 샤드를 나누지 않는다.
+ */
+class Gauge {
+  private:
+    std::atomic<int64_t> current {0};
+
+  public:
+    void set(int64_t value) {current.store(value, std::memory_order_relaxed);}
+    void add(int64_t n) {current.fetch_add(n, std::memory_order_relaxed);}
+
+    //getter
+    int64_t value() const {return current.load(std::memory_order_relaxed);}
+};
+
+static const int HISTOGRAM_SUB_BITS = 5; ///< octave 를 2^5 = 32개로 나눈다, 상대 오차 1/32
+static const uint64_t HISTOGRAM_SUB_BUCKETS = uint64_t(1) << HISTOGRAM_SUB_BITS; ///< octave 하나를 나누는 버킷 수
+static const int HISTOGRAM_MAX_EXPONENT = 43; ///< 이보다 큰 값 (ns 로 약 2.4시간) 은 마지막 버킷에 넣는다
+static const size_t HISTOGRAM_BUCKETS = (HISTOGRAM_MAX_EXPONENT - HISTOGRAM_SUB_BITS + 2) * HISTOGRAM_SUB_BUCKETS;
+
+/**
+ * @brief 값이 들어갈 로그-선형 버킷 번호
+ */
+inline size_t histogram_bucket(uint64_t value) {
+  if (value < HISTOGRAM_SUB_BUCKETS) {
+    return static_cast<size_t>(value);
+  }
+  int exponent = 63 - __builtin_clzll(value);
+  if (exponent > HISTOGRAM_MAX_EXPONENT) {
+    return HISTOGRAM_BUCKETS - 1;
+  }
+  uint64_t mantissa = (value >> (exponent - HISTOGRAM_SUB_BITS)) & (HISTOGRAM_SUB_BUCKETS - 1);
+  return (exponent - HISTOGRAM_SUB_BITS + 1) * HISTOGRAM_SUB_BUCKETS + mantissa;
+}
+
+/**
+ * @brief 버킷에 들어가는 가장 큰 값
+ */
+inline uint64_t histogram_bucket_upper(size_t bucket) {
+  if (bucket < HISTOGRAM_SUB_BUCKETS) {
+    return bucket;
+  }
+  int exponent = static_cast<int>(bucket / HISTOGRAM_SUB_BUCKETS) - 1 + HISTOGRAM_SUB_BITS;
+  uint64_t lower = (HISTOGRAM_SUB_BUCKETS + bucket % HISTOGRAM_SUB_BUCKETS) << (exponent - HISTOGRAM_SUB_BITS);
+  return lower + (uint64_t(1) << (exponent - HISTOGRAM_SUB_BITS)) - 1;
+}
+
+/**
+ * @brief 샤드를 모두 더한 히스토그램의 한 시점 값
+ */
+struct HistogramSnapshot {
+  uint64_t count = 0;
+  uint64_t sum = 0;
+  std::vector<uint64_t> buckets = std::vector<uint64_t>(HISTOGRAM_BUCKETS);
+
+  /**
+   * @brief q 분위수의 근사값 (그 분위수가 든 버킷의 가장 큰 값)
+   *
+   * @param q 0 ~ 1
+   */
+  uint64_t quantile(double q) const {
+    if (count == 0) {
+      return 0;
+    }
+    uint64_t rank = static_cast<uint64_t>(q * (count - 1)) + 1;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+      seen += buckets[i];
+      if (seen >= rank) {
+        return histogram_bucket_upper(i);
+      }
+    }
+    return histogram_bucket_upper(buckets.size() - 1);
+  }
+
+  void merge(const HistogramSnapshot &other) {
+    count += other.count;
+    sum += other.sum;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+      buckets[i] += other.buckets[i];
+    }
+  }
+
+  /**
+   * @brief 같은 히스토그램의 이전 스냅샷을 빼서 그 사이에 기록된 값만 남긴다.
+   */
+  void subtract(const HistogramSnapshot &earlier) {
+    count -= earlier.count;
+    sum -= earlier.sum;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+      buckets[i] -= earlier.buckets[i];
+    }
+  }
+};
+
+/**
+ * @brief 0 이상의 정수 값 (ns, 바이트, 인원 등) 의 분포
+ */
+class Histogram {
+  private:
+    /**
+     * @brief 쓰레드 샤드 하나의 버킷들
+     */
+    struct alignas(64) Shard {
+      std::atomic<uint64_t> count {0};
+      std::atomic<uint64_t> sum {0};
+      std::atomic<uint64_t> buckets[HISTOGRAM_BUCKETS] {};
+    };
+
+    ThreadShards<Shard> shards;
+
+  public:
+    void observe(uint64_t value) {
+      auto shard = shards.local();
+      Shard &target = *shard.first;
+      size_t bucket = histogram_bucket(value);
+      if (shard.second) {
+        add_exclusive(target.buckets[bucket], 1);
+        add_exclusive(target.sum, value);
+        add_exclusive(target.count, 1);
+      } else {
+        target.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        target.sum.fetch_add(value, std::memory_order_relaxed);
+        target.count.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    //getter
+    HistogramSnapshot snapshot() const {
+      HistogramSnapshot result;
+      shards.for_each([&result](const Shard &shard) {
+        result.count += shard.count.load(std::memory_order_relaxed);
+        result.sum += shard.sum.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < HISTOGRAM_BUCKETS; ++i) {
+          result.buckets[i] += shard.buckets[i].load(std::memory_order_relaxed);
+        }
+      });
+      return result;
+    }
+};
+
+/**
+ * @brief 이름과 라벨로 지표를 등록하고 Prometheus 텍스트 포맷으로 출력하는 레지스트리
+ *
+ * 등록은 시작할 때나 처음 쓸 때 한 번 하고, 핫패스에서는 돌려받은 참조에 바로 기록한다.
+ * 지표는 프로세스가 끝날 때까지 옮겨지거나 지워지지 않는다.
+ */
+class MetricsRegistry {
+  public:
+    using Collector = std::function<void(std::string &)>;
+
+  private:
+    /**
+     * @brief 같은 이름을 가진 지표들
+     */
+    struct Family {
+      std::string help;
+      std::string type; ///< counter, gauge, histogram
+      double scale = 1; ///< 카운터와 히스토그램 값을 출력할 때 곱할 수 (ns -> 초 등)
+      std::map<std::string, std::unique_ptr<Counter>> counters; ///< 라벨 -> 지표
+      std::map<std::string, std::unique_ptr<Gauge>> gauges;
+      std::map<std::string, std::unique_ptr<Histogram>> histograms;
+    };
+
+    std::mutex registry_mutex;
+    std::map<std::string, Family> families;
+    std::vector<Collector> collectors;
+
+    MetricsRegistry() {}
+
+    Family &family(const std::string &name, const std::string &help, const char *type) {
+      Family &result = families[name];
+      if (result.type.empty()) {
+        result.help = help;
+        result.type = type;
+      }
+      return result;
+    }
+
+    static std::string format_value(double value) {
+      char buffer[32];
+      snprintf(buffer, sizeof(buffer), "%.9g", value);
+      return buffer;
+    }
+
+    static std::string series(const std::string &name, const std::string &labels, const std::string &extra = "") {
+      std::string all = labels;
+      if (!extra.empty()) {
+        all += all.empty() ? extra : "," + extra;
+      }
+      return all.empty() ? name : name + "{" + all + "}";
+    }
+
+  public:
+    static MetricsRegistry &instance() {
+      static MetricsRegistry registry;
+      return registry;
+    }
+
+    /**
+     * @brief 카운터를 찾거나 만든다.
+     *
+     * @param name 지표 이름
+     * @param help 설명
+     * @param labels 라벨, 예) type="CSChat",format="json"
+     * @param scale 출력할 때 값에 곱할 수, ns 를 세고 초로 출력하려면 1e-9
+     */
+    Counter &counter(const std::string &name, const std::string &help, const std::string &labels = "", double scale = 1) {
+      std::unique_lock<std::mutex> lock(registry_mutex);
+      Family &target = family(name, help, "counter");
+      target.scale = scale;
+      auto &slot = target.counters[labels];
+      if (slot == nullptr) {
+        slot.reset(new Counter());
+      }
+      return *slot;
+    }
+
+    /**
+     * @brief 게이지를 찾거나 만든다.
+     */
+    Gauge &gauge(const std::string &name, const std::string &help, const std::string &labels = "") {
+      std::unique_lock<std::mutex> lock(registry_mutex);
+      auto &slot = family(name, help, "gauge").gauges[labels];
+      if (slot == nullptr) {
+        slot.reset(new Gauge());
+      }
+      return *slot;
+    }
+
+    /**
+     * @brief 히스토그램을 찾거나 만든다.
+     *
+     * @param scale 출력할 때 값과 버킷 경계에 곱할 수, ns 로 기록하고 초로 출력하려면 1e-9
+     */
+    Histogram &histogram(const std::string &name, const std::string &help, const std::string &labels = "", double scale = 1) {
+      std::unique_lock<std::mutex> lock(registry_mutex);
+      Family &target = family(name, help, "histogram");
+      target.scale = scale;
+      auto &slot = target.histograms[labels];
+      if (slot == nullptr) {
+        slot.reset(new Histogram());
+      }
+      return *slot;
+    }
+
+    /**
+     * @brief 출력할 때마다 불려 직접 지표 텍스트를 덧붙이는 함수를 등록. 스크레이프 때만 계산하는 값에 쓴다.
+     */
+    void add_collector(Collector collector) {
+      std::unique_lock<std::mutex> lock(registry_mutex);
+      collectors.push_back(std::move(collector));
+    }
+
+    /**
+     * @brief 히스토그램 하나를 Prometheus 텍스트로 덧붙인다. 버킷 경계는 2의 거듭제곱마다 둔다.
+     */
+    static void render_histogram(std::string &out, const std::string &name, const std::string &labels,
+                                 const HistogramSnapshot &snapshot, double scale) {
+      uint64_t cumulative = 0;
+      for (size_t i = 0; i < HISTOGRAM_BUCKETS; ++i) {
+        cumulative += snapshot.buckets[i];
+        uint64_t upper = histogram_bucket_upper(i) + 1;
+        if ((upper & (upper - 1)) == 0 && i + 1 < HISTOGRAM_BUCKETS) {
+          out += series(name + "_bucket", labels, "le=\"" + format_value((upper - 1) * scale) + "\"") + " " + std::to_string(cumulative) + "\n";
+        }
+      }
+      out += series(name + "_bucket", labels, "le=\"+Inf\"") + " " + std::to_string(snapshot.count) + "\n";
+      out += series(name + "_sum", labels) + " " + format_value(snapshot.sum * scale) + "\n";
+      out += series(name + "_count", labels) + " " + std::to_string(snapshot.count) + "\n";
+    }
+
+    /**
+     * @brief 등록된 모든 지표의 Prometheus 텍스트 포맷 (version 0.0.4)
+     */
+    std::string render() {
+      std::string out;
+      std::vector<Collector> extra;
+      {
+        std::unique_lock<std::mutex> lock(registry_mutex);
+        for (auto &entry : families) {
+          const std::string &name = entry.first;
+          Family &metric = entry.second;
+          out += "# HELP " + name + " " + metric.help + "\n";
+          out += "# TYPE " + name + " " + metric.type + "\n";
+          for (auto &counter : metric.counters) {
+            uint64_t value = counter.second->value();
+            out += series(name, counter.first) + " " + (metric.scale == 1 ? std::to_string(value) : format_value(value * metric.scale)) + "\n";
+          }
+          for (auto &gauge : metric.gauges) {
+            out += series(name, gauge.first) + " " + std::to_string(gauge.second->value()) + "\n";
+          }
+          for (auto &histogram : metric.histograms) {
+            // 라벨 조합이 많은 히스토그램은 대부분 비어 있으므로 한 번도 기록되지 않은 것은 건너뛴다
+            HistogramSnapshot snapshot = histogram.second->snapshot();
+            if (snapshot.count > 0) {
+              render_histogram(out, name, histogram.first, snapshot, metric.scale);
+            }
+          }
+        }
+        extra = collectors;
+      }
+      // collector 는 다른 lock 을 잡을 수 있으므로 레지스트리 lock 밖에서 부른다
+      for (auto &collector : extra) {
+        collector(out);
+      }
+      return out;
+    }
+};
+
+#endif
@@ -0,0 +1,980 @@
+/**
+ * @file micro_bench.cpp
+ * @brief chat_server 의 핫패스 구성 요소를 네트워크 없이 측정하는 마이크로벤치마크
+ *
+ * 실행 인자로 이름의 일부를 주면 해당 벤치마크만 실행한다.
+ * 예) ./micro_bench json_scan
+ *
+ * --save=FILE 로 결과를 남기고 다음 실행에 --baseline=FILE 을 주면 느려진 항목을 표시하고 1 로 끝난다.
+ * 예) ./micro_bench --save=before.txt ; (변경) ; ./micro_bench --baseline=before.txt
+ */
+
+#include <fcntl.h>
+#include <math.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+#include "json_scanner.h"
+#include "framing.h"
+#include "room_table.h"
+#include "member_list.h"
+#include "room_search.h"
+#include "fanout.h"
+#include "metrics.h"
+
+// 메시지 핸들러와 방 목록을 서버 코드 그대로 재기 위해 main 을 빼고 포함한다
+#define CHAT_SERVER_NO_MAIN
+#include "chat_server.cpp"
+
+using namespace std;
+using json = nlohmann::json;
+
+static vector<string> filters; ///< 실행할 벤치마크 이름 필터
+
+/**
+ * @brief 이름이 실행 인자로 준 필터 중 하나를 포함하면 true. 필터가 없으면 모두 실행한다.
+ */
+static bool is_selected(const string &name) {
+  if (filters.empty()) {
+    return true;
+  }
+  for (auto &filter : filters) {
+    if (name.find(filter) != string::npos) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static int repetitions = 11; ///< 측정 반복 횟수, 중앙값과 MAD 를 이 표본들로 구한다
+static double repetition_ms = 20; ///< 반복 1회의 목표 시간 (ms)
+static ofstream save_file; ///< --save 로 준 파일, 결과를 baseline 형식으로 남긴다
+static map<string, pair<double, double>> baseline; ///< --baseline 으로 읽은 이름별 (중앙값, MAD) ns/op
+static int regressions = 0; ///< baseline 보다 느려진 벤치마크 수
+
+static const double REGRESSION_MADS = 3; ///< 중앙값 차이가 두 MAD 중 큰 것의 이 배수를 넘어야 회귀로 본다
+static const double REGRESSION_RATIO = 0.05; ///< 그리고 baseline 중앙값의 이 비율도 넘어야 한다
+
+/**
+ * @brief 값들의 중앙값. values 의 순서를 바꾼다.
+ */
+static double median(vector<double> &values) {
+  size_t mid = values.size() / 2;
+  nth_element(values.begin(), values.begin() + mid, values.end());
+  double upper = values[mid];
+  if (values.size() % 2 == 1) {
+    return upper;
+  }
+  return (*max_element(values.begin(), values.begin() + mid) + upper) / 2;
+}
+
+/**
+ * @brief --save 가 남긴 "이름\t중앙값\tMAD" 줄들을 baseline 으로 읽는다.
+ *
+ * @return 파일을 열지 못했으면 false
+ */
+static bool load_baseline(const string &path) {
+  ifstream in(path);
+  if (!in) {
+    return false;
+  }
+  string line;
+  while (getline(in, line)) {
+    size_t first = line.find('\t');
+    size_t second = line.find('\t', first + 1);
+    if (line.empty() || line[0] == '#' || second == string::npos) {
+      continue;
+    }
+    baseline[line.substr(0, first)] = {stod(line.substr(first + 1)), stod(line.substr(second + 1))};
+  }
+  return true;
+}
+
+/**
+ * @brief fn 을 반복 실행하고 1회당 시간의 중앙값과 MAD, 처리량을 출력.
+ *
+ * 반복 1회가 repetition_ms 쯤 걸리도록 횟수를 맞춘 뒤 한 번 더 버리고(warmup), repetitions 번 잰다.
+ * 평균 대신 중앙값과 MAD (중앙값으로부터의 절대 편차의 중앙값) 를 써서 스케줄링이나 인터럽트로
+ * 튄 반복 몇 번이 결과를 흔들지 않게 한다. baseline 이 있으면 차이를 같이 출력하고 회귀를 센다.
+ *
+ * @param name 벤치마크 이름
+ * @param bytes 1회 실행이 처리하는 바이트 수, 0 이면 처리량을 출력하지 않는다
+ * @param fn 측정할 함수
+ */
+static void run_bench(const string &name, size_t bytes, const function<void()> &fn) {
+  if (!is_selected(name)) {
+    return;
+  }
+
+  using clock = chrono::steady_clock;
+  auto run = [&](long iterations) {
+    auto start = clock::now();
+    for (long i = 0; i < iterations; ++i) {
+      fn();
+    }
+    return chrono::duration<double, nano>(clock::now() - start).count();
+  };
+
+  // 반복 1회의 횟수를 맞춘다. 이 과정이 캐시와 분기 예측기를 데우는 warmup 을 겸한다
+  long iterations = 1;
+  double target_ns = repetition_ms * 1e6;
+  while (true) {
+    double elapsed_ns = run(iterations);
+    if (elapsed_ns >= target_ns) {
+      break;
+    }
+    iterations = (elapsed_ns < target_ns / 100) ? iterations * 10 : max(iterations + 1, (long)(iterations * target_ns / elapsed_ns));
+  }
+  run(iterations);
+
+  vector<double> samples;
+  for (int rep = 0; rep < repetitions; ++rep) {
+    samples.push_back(run(iterations) / iterations);
+  }
+  vector<double> sorted = samples;
+  double ns_per_op = median(sorted);
+  vector<double> deviations;
+  for (double sample : samples) {
+    deviations.push_back(fabs(sample - ns_per_op));
+  }
+  double mad = median(deviations);
+
+  cout << left << setw(52) << name << right << setw(12) << fixed << setprecision(1) << ns_per_op << " ns/op"
+       << " ±" << setw(5) << setprecision(1) << mad / ns_per_op * 100 << "%";
+  if (bytes > 0) {
+    cout << setw(10) << setprecision(0) << bytes / ns_per_op * 1e3 << " MB/s";
+  }
+  auto base = baseline.find(name);
+  if (base != baseline.end()) {
+    double delta = ns_per_op - base->second.first;
+    cout << "  " << showpos << setprecision(1) << delta / base->second.first * 100 << "%" << noshowpos;
+    if (delta > REGRESSION_MADS * max(mad, base->second.second) && delta > REGRESSION_RATIO * base->second.first) {
+      cout << " REGRESSION";
+      ++regressions;
+    }
+  }
+  cout << endl;
+
+  if (save_file.is_open()) {
+    save_file << name << '\t' << fixed << setprecision(1) << ns_per_op << '\t' << mad << '\n';
+  }
+}
+
+/**
+ * @brief 대략 size 바이트 길이의 CSChat JSON 프레임을 만든다. 한글, 영문, 이스케이프가 섞여 있다.
+ */
+static string make_cs_chat(size_t size) {
+  static const string words[] = {"안녕하세요", "hello", "오늘", "점심", "\"quoted\"", "뭐", "먹을까요?", "line\nbreak"};
+  string text;
+  for (int i = 0; text.size() < size; ++i) {
+    text += words[i % 8];
+    text += ' ';
+  }
+  return json{{"type", "CSChat"}, {"text", text}}.dump();
+}
+
+static void bench_json_scan() {
+  vector<pair<string, string>> payloads = {
+    {"CSName", json{{"type", "CSName"}, {"name", "홍길동"}}.dump()},
+    {"CSJoinRoom", json{{"type", "CSJoinRoom"}, {"roomId", 42}}.dump()},
+    {"CSChat/64B", make_cs_chat(40)},
+    {"CSChat/1KB", make_cs_chat(1000)},
+    {"CSChat/60KB", make_cs_chat(60000)},
+  };
+
+  vector<pair<string, JsonScanner::Backend>> backends = {
+    {"scalar", JsonScanner::Backend::SCALAR},
+    {"sse4.2", JsonScanner::Backend::SSE42},
+    {"avx2", JsonScanner::Backend::AVX2},
+  };
+
+  cout << "# json_scan (auto backend: " << JsonScanner::backend_name() << ")" << endl;
+  for (auto &payload : payloads) {
+    const string &frame = payload.second;
+    string label = payload.first + " (" + to_string(frame.size()) + "B)";
+
+    run_bench("json_scan/json::parse/" + label, frame.size(), [&]() {
+      json msg = json::parse(frame);
+    });
+
+    vector<uint32_t> structurals;
+    for (auto &backend : backends) {
+      if (!JsonScanner::scan(frame.data(), frame.size(), structurals, backend.second)) {
+        continue; // 이 CPU 가 지원하지 않는 구현
+      }
+      run_bench("json_scan/stage1/" + backend.first + "/" + label, frame.size(), [&]() {
+        JsonScanner::scan(frame.data(), frame.size(), structurals, backend.second);
+      });
+    }
+
+    run_bench("json_scan/parse_flat_object/" + label, frame.size(), [&]() {
+      json msg;
+      JsonScanner::parse_flat_object(frame, msg);
+    });
+  }
+}
+
+/**
+ * @brief 프레임 목록을 U16/U32 길이 prefix 를 붙여 하나의 바이트열로 이어 붙인다.
+ */
+static string make_stream(const vector<string> &frames, FramingMode mode) {
+  string stream;
+  char prefix[MAX_LENGTH_PREFIX];
+  for (auto &frame : frames) {
+    stream.append(prefix, encode_length_prefix(mode, frame.size(), prefix));
+    stream += frame;
+  }
+  return stream;
+}
+
+static void bench_framing() {
+  // 수 MB 짜리 SCRoomsResult 하나와 작은 CSChat 여러 개
+  json rooms = {{"type", "SCRoomsResult"}, {"rooms", json::array()}};
+  for (int i = 0; i < 20000; ++i) {
+    rooms["rooms"].push_back({{"roomId", i}, {"title", "방 " + to_string(i)}, {"members", {"홍길동", "alice", "bob"}}});
+  }
+  vector<pair<string, vector<string>>> workloads = {
+    {"SCRoomsResult/" + to_string(rooms.dump().size() / 1024) + "KB", {rooms.dump()}},
+    {"CSChat/64B x1000", vector<string>(1000, make_cs_chat(40))},
+  };
+
+  const size_t SEGMENT = 1448; // TCP MSS 크기로 잘라서 도착한다고 가정
+  cout << "# framing (" << SEGMENT << "B segments)" << endl;
+  for (auto &workload : workloads) {
+    string stream = make_stream(workload.second, FramingMode::U32);
+    size_t expected = workload.second.size();
+
+    // 기존 방식: 하나의 string 에 이어 붙이고 프레임마다 substr + erase
+    run_bench("framing/string_append_erase/" + workload.first, stream.size(), [&]() {
+      string buffer;
+      size_t frames = 0;
+      for (size_t offset = 0; offset < stream.size(); offset += SEGMENT) {
+        buffer.append(stream, offset, SEGMENT);
+        while (buffer.size() >= 4) {
+          uint32_t len;
+          memcpy(&len, buffer.data(), 4);
+          len = ntohl(len);
+          if (buffer.size() < 4 + len) {
+            break;
+          }
+          string frame = buffer.substr(4, len);
+          buffer.erase(0, 4 + len);
+          ++frames;
+        }
+      }
+      if (frames != expected) abort();
+    });
+
+    run_bench("framing/FrameReader/" + workload.first, stream.size(), [&]() {
+      FrameReader reader(FramingMode::U32, 0xFFFFFFFFu);
+      size_t frames = 0;
+      for (size_t offset = 0; offset < stream.size(); offset += SEGMENT) {
+        reader.append(stream.data() + offset, min(SEGMENT, stream.size() - offset));
+        string_view frame;
+        while (reader.next(frame) == FrameReader::Status::READY) {
+          reader.consume();
+          ++frames;
+        }
+      }
+      if (frames != expected) abort();
+    });
+  }
+}
+
+static void bench_batch() {
+  const int BATCH_SIZE = 100;
+  vector<string> singles;
+  json batch = {{"type", "CSBatch"}, {"messages", json::array()}};
+  size_t single_bytes = 0;
+  for (int i = 0; i < BATCH_SIZE; ++i) {
+    json chat = {{"type", "CSChat"}, {"text", "bot message " + to_string(i)}};
+    singles.push_back(chat.dump());
+    single_bytes += singles.back().size();
+    batch["messages"].push_back(chat);
+  }
+  string batch_frame = batch.dump();
+
+  cout << "# batch (" << BATCH_SIZE << " CSChat)" << endl;
+  run_bench("batch/single_frames/parse_flat_object", single_bytes, [&]() {
+    for (auto &frame : singles) {
+      json msg;
+      JsonScanner::parse_flat_object(frame, msg);
+    }
+  });
+
+  run_bench("batch/CSBatch/json::parse", batch_frame.size(), [&]() {
+    json msg = json::parse(batch_frame);
+  });
+
+  vector<string_view> entries;
+  run_bench("batch/CSBatch/split_batch+parse_flat_object", batch_frame.size(), [&]() {
+    JsonScanner::split_batch(batch_frame, entries);
+    for (auto &entry : entries) {
+      json msg;
+      JsonScanner::parse_flat_object(entry, msg);
+    }
+  });
+}
+
+/**
+ * @brief chat_server 의 Room 과 같은 모양의 값. 제목과 멤버 맵을 가진다.
+ */
+struct BenchRoom {
+  int room_id;
+  string title;
+  map<int, void *> members;
+
+  BenchRoom() {}
+  BenchRoom(int room_id, const string &title) : room_id(room_id), title(title) {}
+};
+
+static void bench_room_map() {
+  const int NUM_ROOMS = 1000000;
+  const int NUM_LOOKUPS = 1000000;
+  vector<int> lookups(NUM_LOOKUPS);
+  mt19937 rng(42);
+  for (auto &id : lookups) {
+    id = rng() % NUM_ROOMS + 1;
+  }
+
+  cout << "# room_map (" << NUM_ROOMS << " rooms, " << NUM_LOOKUPS << " random lookups per op)" << endl;
+
+  // 기존 RoomMap: 임시 Room 을 만든 뒤 operator[] 로 복사
+  {
+    map<int, BenchRoom> rooms;
+    run_bench("room_map/std::map/create", 0, [&]() {
+      map<int, BenchRoom>().swap(rooms);
+      for (int id = 1; id <= NUM_ROOMS; ++id) {
+        BenchRoom room(id, "방");
+        rooms[id] = room;
+      }
+    });
+    run_bench("room_map/std::map/lookup", 0, [&]() {
+      long sum = 0;
+      for (int id : lookups) {
+        sum += rooms.find(id)->second.room_id;
+      }
+      if (sum == 0) abort();
+    });
+  }
+
+  {
+    unordered_map<int, BenchRoom> rooms;
+    run_bench("room_map/std::unordered_map/create", 0, [&]() {
+      unordered_map<int, BenchRoom>().swap(rooms);
+      for (int id = 1; id <= NUM_ROOMS; ++id) {
+        rooms.emplace(piecewise_construct, forward_as_tuple(id), forward_as_tuple(id, "방"));
+      }
+    });
+    run_bench("room_map/std::unordered_map/lookup", 0, [&]() {
+      long sum = 0;
+      for (int id : lookups) {
+        sum += rooms.find(id)->second.room_id;
+      }
+      if (sum == 0) abort();
+    });
+  }
+
+  // 방 ID 를 할당기에서 받으므로 지웠다 다시 만들면 ID 가 바뀐다. 조회할 ID 는 만들 때 받은 것으로 바꿔 둔다
+  {
+    RoomTable<BenchRoom> rooms;
+    vector<int> ids(NUM_ROOMS + 1);
+    run_bench("room_map/RoomTable/create", 0, [&]() {
+      rooms.clear();
+      for (int i = 1; i <= NUM_ROOMS; ++i) {
+        ids[i] = rooms.allocate_key();
+        rooms.emplace(ids[i], ids[i], "방");
+      }
+    });
+    vector<int> keys(NUM_LOOKUPS);
+    for (int i = 0; i < NUM_LOOKUPS; ++i) {
+      keys[i] = ids[lookups[i]];
+    }
+    run_bench("room_map/RoomTable/lookup", 0, [&]() {
+      long sum = 0;
+      for (int id : keys) {
+        sum += rooms.find(id)->room_id;
+      }
+      if (sum == 0) abort();
+    });
+    int next = 1;
+    run_bench("room_map/RoomTable/erase+create", 0, [&]() {
+      for (int i = 0; i < 1000; ++i) {
+        rooms.erase(ids[next]);
+        ids[next] = rooms.allocate_key();
+        rooms.emplace(ids[next], ids[next], "방");
+        next = next % NUM_ROOMS + 1;
+      }
+    });
+  }
+}
+
+/**
+ * @brief 브로드캐스트가 멤버마다 읽는 값만 가진 Client 대역. 실제 Client 처럼 수신 버퍼 등이 함께 있어 크기가 크다.
+ */
+struct BenchClient {
+  int client_fd;
+  int format;
+  int framing;
+  char rest[200];
+};
+
+/**
+ * @brief Room::Member 와 같은 배치의 멤버
+ */
+struct BenchMember {
+  int fd;
+  int format;
+  int framing;
+  BenchClient *client;
+};
+
+static void bench_members() {
+  const int NUM_MEMBERS = 10000;
+
+  // 클라이언트는 접속 순서대로 따로 할당되고, 사이사이 다른 할당이 끼어 힙에 흩어진다
+  vector<unique_ptr<BenchClient>> clients;
+  vector<unique_ptr<string>> noise;
+  mt19937 rng(42);
+  for (int i = 0; i < NUM_MEMBERS; ++i) {
+    clients.emplace_back(new BenchClient {i + 4, i % 3, 0, {}});
+    noise.emplace_back(new string(rng() % 512, 'x'));
+  }
+  vector<int> join_order(NUM_MEMBERS);
+  for (int i = 0; i < NUM_MEMBERS; ++i) {
+    join_order[i] = i;
+  }
+  shuffle(join_order.begin(), join_order.end(), rng);
+
+  cout << "# members (" << NUM_MEMBERS << " members, one op = one broadcast scan)" << endl;
+
+  // 기존 Room::members: map<Index, Client*>, Client 를 거쳐 소켓과 포맷을 읽는다
+  {
+    map<int, BenchClient *> members;
+    for (int i : join_order) {
+      members.insert({clients[i]->client_fd, clients[i].get()});
+    }
+    run_bench("members/std::map/broadcast", 0, [&]() {
+      long sum = 0;
+      for (auto it = members.begin(); it != members.end(); ++it) {
+        auto &member = it->second;
+        sum += member->client_fd + member->format + member->framing;
+      }
+      if (sum == 0) abort();
+    });
+    run_bench("members/std::map/leave+join", 0, [&]() {
+      for (int i = 0; i < 100; ++i) {
+        int fd = clients[join_order[i]]->client_fd;
+        members.erase(fd);
+        members.insert({fd, clients[join_order[i]].get()});
+      }
+    });
+  }
+
+  {
+    DenseMemberList<BenchMember> members;
+    for (int i : join_order) {
+      BenchClient *client = clients[i].get();
+      members.insert(client->client_fd, BenchMember {client->client_fd, client->format, client->framing, client});
+    }
+    run_bench("members/DenseMemberList/broadcast", 0, [&]() {
+      long sum = 0;
+      for (auto it = members.begin(); it != members.end(); ++it) {
+        sum += it->fd + it->format + it->framing;
+      }
+      if (sum == 0) abort();
+    });
+    run_bench("members/DenseMemberList/leave+join", 0, [&]() {
+      for (int i = 0; i < 100; ++i) {
+        BenchClient *client = clients[join_order[i]].get();
+        members.erase(client->client_fd);
+        members.insert(client->client_fd, BenchMember {client->client_fd, client->format, client->framing, client});
+      }
+    });
+  }
+}
+
+static void bench_room_search() {
+  const int NUM_ROOMS = 1000000;
+  static const string words[] = {"점심", "저녁", "스터디", "게임", "hello", "random", "chat", "모임", "운동", "music", "coffee", "여행"};
+  const size_t NUM_WORDS = sizeof(words) / sizeof(words[0]);
+
+  // 인덱스를 만드는 데 몇 초 걸리므로 실행하지 않을 때는 만들지 않는다
+  if (!is_selected("room_search/")) {
+    return;
+  }
+
+  // "단어 단어 번호" 형태의 제목 100만 개
+  RoomSearchIndex index;
+  mt19937 rng(42);
+  auto start = chrono::steady_clock::now();
+  for (int id = 1; id <= NUM_ROOMS; ++id) {
+    index.add(id, words[rng() % NUM_WORDS] + " " + words[rng() % NUM_WORDS] + " " + to_string(rng() % 10000000));
+  }
+  double build_ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+  RoomSearchIndex::Stats stats = index.get_stats();
+  cout << "# room_search (" << NUM_ROOMS << " rooms, build " << fixed << setprecision(0) << build_ms << " ms, index "
+       << stats.memory_bytes / (1024 * 1024) << " MiB, limit 100)" << endl;
+
+  vector<int> room_ids;
+  run_bench("room_search/substring/common", 0, [&]() {
+    index.search("스터디 게임", 100, room_ids);
+  });
+  run_bench("room_search/substring/rare", 0, [&]() {
+    index.search("1234567", 100, room_ids);
+  });
+  run_bench("room_search/substring/miss", 0, [&]() {
+    index.search("없는 제목", 100, room_ids);
+  });
+  run_bench("room_search/prefix/2B", 0, [&]() {
+    index.search("he", 100, room_ids);
+  });
+  // 서버처럼 오래된 방이 사라지고 새 ID 의 방이 생긴다
+  int next_id = NUM_ROOMS + 1;
+  run_bench("room_search/remove+add", 0, [&]() {
+    for (int i = 0; i < 100; ++i) {
+      index.remove(next_id - NUM_ROOMS);
+      index.add(next_id, words[rng() % NUM_WORDS] + " " + words[rng() % NUM_WORDS] + " " + to_string(rng() % 10000000));
+      ++next_id;
+    }
+  });
+}
+
+static void bench_fanout() {
+  const int ROOM_SIZES[] = {1000, 10000, 50000, 100000};
+  const size_t NUM_SHARDS = 4;
+  const string frame(100, 'x');
+
+  if (!is_selected("fanout/")) {
+    return;
+  }
+
+  // 멤버마다 /dev/null 에 write 한 번으로 sendmsg 를 대신한다
+  int devnull = open("/dev/null", O_WRONLY);
+  if (devnull < 0) {
+    cerr << "open(/dev/null) failed" << endl;
+    return;
+  }
+  auto deliver = [&](int members) {
+    for (int i = 0; i < members; ++i) {
+      if (write(devnull, frame.data(), frame.size()) < 0) abort();
+    }
+  };
+
+  FanoutPool pool(NUM_SHARDS);
+  cout << "# fanout (" << frame.size() << "B frame, one op = delivery to the whole room, " << NUM_SHARDS << " shards, "
+       << thread::hardware_concurrency() << " cpus)" << endl;
+  for (int room_size : ROOM_SIZES) {
+    // 기존 broadcast: 워커 하나가 멤버 전체에 보낸다
+    run_bench("fanout/inline/" + to_string(room_size), 0, [&]() {
+      deliver(room_size);
+    });
+
+    // 샤드마다 하나씩 넘기고 마지막 샤드가 끝날 때까지 기다린다
+    run_bench("fanout/pool/" + to_string(room_size), 0, [&]() {
+      mutex done_mutex;
+      condition_variable done_cv;
+      size_t remaining = NUM_SHARDS;
+      for (size_t shard = 0; shard < NUM_SHARDS; ++shard) {
+        int members = room_size / NUM_SHARDS + (shard < room_size % NUM_SHARDS ? 1 : 0);
+        pool.post(shard, [&, members]() {
+          deliver(members);
+          unique_lock<mutex> lock(done_mutex);
+          if (--remaining == 0) {
+            done_cv.notify_one();
+          }
+        });
+      }
+      unique_lock<mutex> lock(done_mutex);
+      done_cv.wait(lock, [&]() {return remaining == 0;});
+    });
+  }
+  pool.stop();
+  close(devnull);
+}
+
+static void bench_metrics() {
+  Counter &counter = MetricsRegistry::instance().counter("bench_counter_total", "bench");
+  Histogram &histogram = MetricsRegistry::instance().histogram("bench_latency_seconds", "bench", "", 1e-9);
+  atomic<uint64_t> shared {0};
+  uint64_t value = 12345;
+
+  cout << "# metrics (one op = one recorded event)" << endl;
+  // 비교용: 샤드 없이 모든 쓰레드가 같은 캐시 라인에 fetch_add
+  run_bench("metrics/atomic::fetch_add", 0, [&]() {
+    shared.fetch_add(1, memory_order_relaxed);
+  });
+  run_bench("metrics/Counter::inc", 0, [&]() {
+    counter.inc();
+  });
+  run_bench("metrics/Histogram::observe", 0, [&]() {
+    histogram.observe(value);
+    value = value * 6364136223846793005ull + 1442695040888963407ull;
+    value >>= 40;
+  });
+  // 핸들러 지연을 나눠 재는 데 메시지마다 시각을 네 번 이상 읽는다
+  uint64_t elapsed = 0;
+  run_bench("metrics/ScopedTimer", 0, [&]() {
+    ScopedTimer timer(elapsed);
+  });
+  // 경합 없는 락 한 번. 프로파일을 켜면 시각을 두 번 읽고 위치별 통계를 센다
+  mutex plain;
+  ProfiledMutex profiled("bench");
+  run_bench("metrics/std::mutex", 0, [&]() {
+    unique_lock<mutex> lock(plain);
+  });
+  run_bench("metrics/ProfiledLock/disabled", 0, [&]() {
+    ProfiledLock lock(profiled);
+  });
+  ProfiledMutex::set_enabled(true);
+  run_bench("metrics/ProfiledLock/enabled", 0, [&]() {
+    ProfiledLock lock(profiled);
+  });
+  ProfiledMutex::set_enabled(false);
+  run_bench("metrics/MetricsRegistry::render", 0, [&]() {
+    string text = MetricsRegistry::instance().render();
+    if (text.empty()) abort();
+  });
+}
+
+/**
+ * @brief 출력을 버리는 동안 cout 을 막는다. 방 생성 로그가 결과를 덮지 않게 한다.
+ */
+class QuietCout {
+  private:
+    streambuf *saved;
+
+  public:
+    QuietCout() : saved(cout.rdbuf(nullptr)) {}
+    ~QuietCout() {
+      cout.rdbuf(saved);
+    }
+};
+
+static void bench_serialize() {
+  NameTable names;
+  NamePtr member = names.bind(1, "홍길동");
+  string text = "오늘 점심 뭐 먹을까요? hello";
+  string cs_chat_json = json{{"type", "CSChat"}, {"text", text}}.dump();
+  json sc_chat = {{"type", "SCChat"}, {"member", member->get()}, {"text", text}, {"roomId", 1}};
+
+  CSChat cs_chat;
+  cs_chat.set_text(text);
+  string cs_chat_pb = cs_chat.SerializeAsString();
+  SCChat sc_chat_pb;
+  sc_chat_pb.set_member(member->get());
+  sc_chat_pb.set_text(text);
+  sc_chat_pb.set_roomid(1);
+  string sc_chat_pb_bytes = sc_chat_pb.SerializeAsString();
+
+  // 방 100개, 방마다 8명
+  vector<RoomInfo> room_infos;
+  for (int i = 0; i < 100; ++i) {
+    RoomInfo info {i + 1, "방 " + to_string(i + 1), {}};
+    for (int j = 0; j < 8; ++j) {
+      info.members.push_back(names.bind(100 + j, "member" + to_string(j)));
+    }
+    room_infos.push_back(info);
+  }
+  SCRoomsResult rooms_pb;
+  for (auto &info : room_infos) {
+    SCRoomsResult::RoomInfo *room = rooms_pb.add_rooms();
+    room->set_roomid(info.room_id);
+    room->set_title(info.title);
+    for (auto &name : info.members) {
+      room->add_members(name->get());
+    }
+  }
+  string rooms_pb_bytes = rooms_pb.SerializeAsString();
+
+  cout << "# serialize (CSChat/SCChat " << text.size() << "B text, SCRoomsResult 100 rooms x 8 members)" << endl;
+  run_bench("serialize/json/CSChat/json::parse", cs_chat_json.size(), [&]() {
+    json msg = json::parse(cs_chat_json);
+  });
+  run_bench("serialize/json/SCChat/json::dump", 0, [&]() {
+    string frame = sc_chat.dump();
+  });
+  run_bench("serialize/protobuf/CSChat/ParseFromString", cs_chat_pb.size(), [&]() {
+    CSChat msg;
+    msg.ParseFromString(cs_chat_pb);
+  });
+  run_bench("serialize/protobuf/SCChat/SerializeAsString", sc_chat_pb_bytes.size(), [&]() {
+    string frame = sc_chat_pb.SerializeAsString();
+  });
+  run_bench("serialize/protobuf/SCRoomsResult/SerializeAsString", rooms_pb_bytes.size(), [&]() {
+    string frame = rooms_pb.SerializeAsString();
+  });
+  run_bench("serialize/protobuf/SCRoomsResult/ParseFromString", rooms_pb_bytes.size(), [&]() {
+    SCRoomsResult msg;
+    msg.ParseFromString(rooms_pb_bytes);
+  });
+
+  // 서버가 실제로 쓰는 경로: 메시지마다 새 ServerMessage 를 만들어 포맷별로 한 번 인코딩한다
+  vector<pair<string, MessageFormat>> formats = {
+    {"json", MessageFormat::JSON},
+    {"protobuf", MessageFormat::PROTOBUF},
+    {"flat", MessageFormat::FLAT},
+  };
+  for (auto &format : formats) {
+    run_bench("serialize/ServerMessage::encode/SCChat/" + format.first, 0, [&]() {
+      ServerMessagePtr message = ServerMessage::chat(member, text, 1);
+      message->encode(format.second);
+    });
+    run_bench("serialize/ServerMessage::encode/SCRoomsResult/" + format.first, 0, [&]() {
+      ServerMessagePtr message = ServerMessage::rooms_result(room_infos);
+      message->encode(format.second);
+    });
+  }
+}
+
+/**
+ * @brief 방 멤버들의 소켓 반대편을 읽어 버리는 쓰레드. 서버의 메인 루프처럼 송신 큐에 쌓인 것도 보낸다.
+ */
+class SocketDrain {
+  private:
+    vector<int> peers;
+    OutboundQueues *outbound;
+    thread reader;
+
+  public:
+    /**
+     * @brief count 개의 socketpair 를 만들고 반대편을 읽기 시작한다.
+     *
+     * @param count 소켓 수
+     * @param socks 핸들러가 쓸 쪽의 소켓들이 담긴다
+     * @param outbound 핸들러가 쓰는 송신 큐
+     */
+    SocketDrain(size_t count, vector<int> &socks, OutboundQueues *outbound) : outbound(outbound) {
+      for (size_t i = 0; i < count; ++i) {
+        int pair[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, pair) < 0) {
+          cerr << "socketpair() failed: " << strerror(errno) << endl;
+          exit(1);
+        }
+        int size = 4 * 1024 * 1024;
+        setsockopt(pair[0], SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+        socks.push_back(pair[0]);
+        peers.push_back(pair[1]);
+      }
+      reader = thread([this]() {
+        vector<pollfd> fds;
+        for (int peer : peers) {
+          fds.push_back({peer, POLLIN, 0});
+        }
+        char buffer[65536];
+        size_t open = fds.size();
+        while (open > 0) {
+          for (int sock : this->outbound->get_pending_sockets()) {
+            this->outbound->flush(sock);
+          }
+          if (poll(fds.data(), fds.size(), 1) <= 0) {
+            continue;
+          }
+          for (auto &fd : fds) {
+            if (fd.fd >= 0 && fd.revents != 0 && read(fd.fd, buffer, sizeof(buffer)) <= 0) {
+              fd.fd = -1;
+              --open;
+            }
+          }
+        }
+      });
+    }
+
+    /**
+     * @brief socks 를 닫은 뒤에 불러서 쓰레드가 끝나기를 기다린다.
+     */
+    void join() {
+      reader.join();
+      for (int peer : peers) {
+        close(peer);
+      }
+    }
+};
+
+static void bench_dispatch() {
+  const size_t MEMBERS = 8;
+  ClientMap clients;
+  RoomMap rooms;
+  RoomListing listing;
+  NameTable names;
+  RoomSearchIndex search_index;
+  FanoutPool fanout(0);
+  PresenceScheduler presence;
+  OutboundQueues outbound(max_outbound_bytes);
+  MessageHandlers<json> json_handlers(&clients, &rooms, &listing, &names, &search_index, &fanout, &presence, &outbound);
+  MessageHandlers<string> protobuf_handlers(&clients, &rooms, &listing, &names, &search_index, &fanout, &presence, &outbound);
+
+  // 혼자 있는 방 하나(JSON)와 MEMBERS 명이 있는 방 하나(protobuf). 채팅은 보낸 사람에게도 돌아온다
+  vector<int> socks;
+  SocketDrain drain(1 + MEMBERS, socks, &outbound);
+  {
+    QuietCout quiet;
+    clients[socks[0]] = Client(socks[0], socks[0], names.bind(socks[0], "alone"), MessageFormat::JSON, max_frame_size);
+    outbound.open(socks[0], socks[0]);
+    json_handlers.handle_message(socks[0], "CSCreateRoom", json{{"type", "CSCreateRoom"}, {"title", "alone"}});
+    CSCreateRoom create;
+    create.set_title("crowd");
+    CSJoinRoom join;
+    for (size_t i = 1; i < socks.size(); ++i) {
+      int sock = socks[i];
+      clients[sock] = Client(sock, sock, names.bind(sock, "member" + to_string(i)), MessageFormat::PROTOBUF, max_frame_size);
+      outbound.open(sock, sock);
+      if (i == 1) {
+        protobuf_handlers.handle_message(sock, to_string(Type_MessageType_CS_CREATE_ROOM), create.SerializeAsString());
+        join.set_roomid(clients[sock].get_entered_room_id());
+      } else {
+        protobuf_handlers.handle_message(sock, to_string(Type_MessageType_CS_JOIN_ROOM), join.SerializeAsString());
+      }
+    }
+  }
+
+  string text = "오늘 점심 뭐 먹을까요? hello";
+  string cs_chat_json = json{{"type", "CSChat"}, {"text", text}}.dump();
+  CSChat cs_chat;
+  cs_chat.set_text(text);
+  string cs_chat_pb = cs_chat.SerializeAsString();
+  string cs_rooms_json = json{{"type", "CSRooms"}}.dump();
+
+  cout << "# dispatch (frame -> handler -> sendmsg on a socketpair)" << endl;
+  // process_socket 처럼 프레임을 파싱한 뒤 handle_message 로 넘긴다
+  run_bench("dispatch/json/CSChat/1 member", 0, [&]() {
+    json msg;
+    if (!JsonScanner::parse_flat_object(cs_chat_json, msg)) abort();
+    json_handlers.handle_message(socks[0], msg["type"], msg);
+  });
+  run_bench("dispatch/protobuf/CSChat/" + to_string(MEMBERS) + " members", 0, [&]() {
+    protobuf_handlers.handle_message(socks[1], to_string(Type_MessageType_CS_CHAT), cs_chat_pb);
+  });
+  run_bench("dispatch/json/CSRooms/2 rooms", 0, [&]() {
+    json msg;
+    if (!JsonScanner::parse_flat_object(cs_rooms_json, msg)) abort();
+    json_handlers.handle_message(socks[0], msg["type"], msg);
+  });
+
+  for (int sock : socks) {
+    close(sock);
+  }
+  drain.join();
+}
+
+static void bench_room_listing() {
+  const int ROOMS = 1000;
+  const int MEMBERS = 8;
+  ClientMap clients;
+  RoomMap rooms;
+  RoomListing listing;
+  NameTable names;
+  vector<Room *> created;
+  {
+    QuietCout quiet;
+    for (int i = 0; i < ROOMS * MEMBERS; ++i) {
+      clients[i] = Client(i, i, names.bind(i, "member" + to_string(i)), MessageFormat::JSON, max_frame_size);
+    }
+    for (int i = 0; i < ROOMS; ++i) {
+      int room_id = rooms.allocate_key();
+      Room *room = &rooms.get(rooms.emplace(room_id, room_id, "방 " + to_string(i)));
+      for (int j = 0; j < MEMBERS; ++j) {
+        int sock = i * MEMBERS + j;
+        room->join_client(sock, &clients[sock], room_id);
+      }
+      listing.update(*room);
+      created.push_back(room);
+    }
+  }
+
+  RoomQuery query;
+  query.sort = RoomSort::MEMBERS;
+
+  cout << "# room_listing (" << ROOMS << " rooms x " << MEMBERS << " members)" << endl;
+  // 비교용: 요청마다 모든 방에서 목록을 새로 만든다
+  run_bench("room_listing/rebuild_from_rooms+encode/json", 0, [&]() {
+    vector<RoomInfo> infos;
+    {
+      ProfiledLock lock(room_mutex);
+      for (auto &room : rooms) {
+        infos.push_back(room.get_room_info());
+      }
+    }
+    ServerMessage::rooms_result(move(infos))->encode(MessageFormat::JSON);
+  });
+  run_bench("room_listing/RoomListing::update", 0, [&]() {
+    listing.update(*created[0]);
+  });
+  run_bench("room_listing/get+encode/json/cached", 0, [&]() {
+    listing.get()->encode(MessageFormat::JSON);
+  });
+  run_bench("room_listing/get+encode/json/after_update", 0, [&]() {
+    listing.update(*created[0]);
+    listing.get()->encode(MessageFormat::JSON);
+  });
+  run_bench("room_listing/get+encode/protobuf/after_update", 0, [&]() {
+    listing.update(*created[0]);
+    listing.get()->encode(MessageFormat::PROTOBUF);
+  });
+  run_bench("room_listing/page(100,members)+encode/json", 0, [&]() {
+    listing.page(query)->encode(MessageFormat::JSON);
+  });
+}
+
+int main(int argc, char *argv[]) {
+  for (int i = 1; i < argc; ++i) {
+    string arg = argv[i];
+    if (arg.rfind("--reps=", 0) == 0) { // "--reps=" 로 시작하는지 확인
+      repetitions = max(1, stoi(arg.substr(7)));
+    } else if (arg.rfind("--rep-ms=", 0) == 0) { // "--rep-ms=" 로 시작하는지 확인
+      repetition_ms = stod(arg.substr(9));
+    } else if (arg.rfind("--save=", 0) == 0) { // "--save=" 로 시작하는지 확인
+      save_file.open(arg.substr(7));
+      if (!save_file) {
+        cerr << "cannot open " << arg.substr(7) << endl;
+        exit(1);
+      }
+    } else if (arg.rfind("--baseline=", 0) == 0) { // "--baseline=" 로 시작하는지 확인
+      if (!load_baseline(arg.substr(11))) {
+        cerr << "cannot open " << arg.substr(11) << endl;
+        exit(1);
+      }
+    } else {
+      filters.push_back(arg);
+    }
+  }
+
+  cout << "# median ns/op ± MAD over " << repetitions << " repetitions of ~" << repetition_ms << " ms" << endl;
+
+  bench_json_scan();
+  bench_framing();
+  bench_batch();
+  bench_room_map();
+  bench_members();
+  bench_room_search();
+  bench_fanout();
+  bench_metrics();
+  bench_serialize();
+  bench_dispatch();
+  bench_room_listing();
+
+  if (regressions > 0) {
+    cout << regressions << " regression(s) against baseline" << endl;
+    return 1;
+  }
+  return 0;
+}
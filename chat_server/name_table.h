@@ -0,0 +1,169 @@
+/**
+ * @file name_table.h
+ * @brief 클라이언트 이름의 intern 테이블
+ *
+ * 같은 이름은 하나의 불변 InternedName 을 공유한다. 이름을 처음 intern 할 때 JSON 문자열 리터럴과
+ * protobuf length-delimited 필드 값을 미리 만들어 두므로, SCChat.member 나 SCRoomsResult 의 members 를
+ * 인코딩할 때는 이스케이프나 직렬화 없이 이 바이트를 그대로 이어 붙인다.
+ *
+ * 테이블은 이름마다 그 이름을 쓰는 클라이언트 소켓들도 기록하므로 이름으로 클라이언트를 O(1) 에 찾을 수 있다.
+ */
+
+#ifndef CHAT_SERVER_NAME_TABLE_H
+#define CHAT_SERVER_NAME_TABLE_H
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+/**
+ * @brief 클라이언트가 보낸 문자열을 따옴표와 이스케이프를 포함한 JSON 문자열로 만든다.
+ *
+ * flat 과 protobuf 연결은 UTF-8 이 아닌 바이트도 보낼 수 있다. dump() 는 그런 바이트에서 예외를 던지므로
+ * U+FFFD 로 바꿔 JSON 연결에도 메시지가 가도록 한다.
+ */
+inline std::string json_string(std::string_view value) {
+  return nlohmann::json(value).dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+}
+
+/**
+ * @brief protobuf base 128 varint 를 out 뒤에 붙인다.
+ */
+inline void append_varint(std::string &out, uint64_t value) {
+  while (value >= 0x80) {
+    out += static_cast<char>((value & 0x7F) | 0x80);
+    value >>= 7;
+  }
+  out += static_cast<char>(value);
+}
+
+/**
+ * @brief protobuf length-delimited 필드 (태그, 길이, 바이트) 를 out 뒤에 붙인다.
+ *
+ * @param out 출력
+ * @param field 필드 번호
+ * @param bytes 필드 값
+ */
+inline void append_bytes_field(std::string &out, int field, std::string_view bytes) {
+  append_varint(out, (static_cast<uint64_t>(field) << 3) | 2);
+  append_varint(out, bytes.size());
+  out.append(bytes);
+}
+
+/**
+ * @brief intern 된 불변 이름과 포맷별로 미리 인코딩한 바이트
+ */
+class InternedName {
+  private:
+    std::string name;
+    std::string json; ///< 따옴표와 이스케이프를 포함한 JSON 문자열
+    std::string protobuf; ///< length-delimited 필드의 길이 + 바이트, 앞에 태그만 붙이면 된다
+
+  public:
+    explicit InternedName(std::string name) : name(std::move(name)) {
+      json = json_string(this->name);
+      append_varint(protobuf, this->name.size());
+      protobuf += this->name;
+    }
+
+    InternedName(const InternedName &) = delete;
+    InternedName &operator=(const InternedName &) = delete;
+
+    //getter
+    const std::string &get() const {return name;}
+    const std::string &get_json() const {return json;}
+    const std::string &get_protobuf() const {return protobuf;}
+};
+
+using NamePtr = std::shared_ptr<const InternedName>;
+
+/**
+ * @brief 이름 -> InternedName 과 그 이름을 쓰는 클라이언트들의 테이블
+ *
+ * 이름은 그 이름을 쓰는 클라이언트가 하나라도 있는 동안 테이블에 남는다.
+ * 메시지가 아직 들고 있는 NamePtr 은 테이블에서 빠진 뒤에도 유효하다.
+ */
+class NameTable {
+  private:
+    /**
+     * @brief 이름 하나와 그 이름을 쓰는 클라이언트 소켓들
+     */
+    struct Entry {
+      NamePtr name;
+      std::vector<int> clients;
+    };
+
+    std::mutex table_mutex;
+    std::unordered_map<std::string_view, Entry> entries; ///< 키는 Entry.name 이 가진 문자열을 가리킨다
+
+  public:
+    /**
+     * @brief sock 이 name 을 쓰기 시작한다. 같은 이름이 이미 있으면 그 InternedName 을 돌려준다.
+     *
+     * @param sock 클라이언트 소켓
+     * @param name 이름
+     */
+    NamePtr bind(int sock, const std::string &name) {
+      std::unique_lock<std::mutex> lock(table_mutex);
+      auto it = entries.find(name);
+      if (it == entries.end()) {
+        NamePtr interned = std::make_shared<const InternedName>(name);
+        it = entries.emplace(interned->get(), Entry {interned, {}}).first;
+      }
+      it->second.clients.push_back(sock);
+      return it->second.name;
+    }
+
+    /**
+     * @brief sock 이 name 을 더 이상 쓰지 않는다. 쓰는 클라이언트가 없으면 테이블에서 뺀다.
+     *
+     * @param sock 클라이언트 소켓
+     * @param name bind() 가 돌려준 이름
+     */
+    void unbind(int sock, const NamePtr &name) {
+      if (name == nullptr) {
+        return;
+      }
+      std::unique_lock<std::mutex> lock(table_mutex);
+      auto it = entries.find(name->get());
+      if (it == entries.end() || it->second.name != name) {
+        return;
+      }
+      auto &clients = it->second.clients;
+      auto client = std::find(clients.begin(), clients.end(), sock);
+      if (client != clients.end()) {
+        *client = clients.back();
+        clients.pop_back();
+      }
+      if (clients.empty()) {
+        entries.erase(it);
+      }
+    }
+
+    /**
+     * @brief name 을 쓰는 클라이언트 소켓들
+     *
+     * @param name 이름
+     */
+    std::vector<int> find_clients(std::string_view name) {
+      std::unique_lock<std::mutex> lock(table_mutex);
+      auto it = entries.find(name);
+      return it == entries.end() ? std::vector<int>() : it->second.clients;
+    }
+
+    //getter
+    size_t size() {
+      std::unique_lock<std::mutex> lock(table_mutex);
+      return entries.size();
+    }
+};
+
+#endif
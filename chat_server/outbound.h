@@ -0,0 +1,319 @@
+/**
+ * @file outbound.h
+ * @brief 클라이언트마다 아직 보내지 못한 바이트를 쌓아 두는 송신 큐
+ *
+ * 전송은 MSG_DONTWAIT 로 하고, 소켓 버퍼가 차서 다 보내지 못한 나머지는 그 클라이언트의 큐에 복사해 둔다.
+ * 큐가 비어 있지 않은 동안 오는 전송은 순서를 지키도록 소켓에 쓰지 않고 큐 뒤에 붙인다.
+ * 큐는 메인 루프가 소켓에 쓸 수 있게 될 때 flush() 로 비운다.
+ *
+ * 그래서 읽지 않는 클라이언트가 있어도 room_mutex 를 잡고 있는 브로드캐스트나 fan-out 쓰레드가 send() 에서 막히지 않는다.
+ * 큐가 한도를 넘도록 읽지 않는 클라이언트는 느린 소비자로 보고 큐를 버린 뒤 소켓을 shutdown 한다.
+ * 그러면 그 소켓이 읽을 수 있게 되어 (EOF) 메인 루프의 평소 연결 종료 경로로 정리된다.
+ *
+ * 소켓 번호는 닫힌 뒤 새 연결에 다시 쓰이므로 전송은 연결 번호도 함께 넘긴다. fan-out 큐에 남아 있던 작업처럼
+ * 닫힌 연결로 가던 전송은 같은 소켓 번호의 새 연결에 가지 않고 버려진다.
+ */
+
+#ifndef CHAT_SERVER_OUTBOUND_H
+#define CHAT_SERVER_OUTBOUND_H
+
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+/**
+ * @brief 소켓 번호로 바로 찾는 클라이언트별 송신 큐
+ *
+ * 큐는 소켓 번호를 인덱스로 하는 고정 크기 청크에 있고 처음 쓰일 때 청크를 만든다.
+ * 찾기에 테이블 lock 이 없으므로 큰 방의 브로드캐스트가 멤버마다 치르는 비용은 큐 하나의 mutex 뿐이다.
+ * 같은 소켓으로의 전송은 그 mutex 로 직렬화되어 여러 쓰레드의 writev 가 섞이지 않는다.
+ */
+class OutboundQueues {
+  public:
+    /**
+     * @brief send() 의 결과
+     */
+    enum class Result {
+      SENT,   ///< 모두 소켓에 썼다
+      QUEUED, ///< 일부 또는 전부를 큐에 넣었다
+      CLOSED, ///< 소켓 오류나 느린 소비자로 닫는 중이라 버렸다
+    };
+
+    /**
+     * @brief 지표용 통계
+     */
+    struct Stats {
+      size_t pending_bytes;    ///< 모든 큐에 쌓인 바이트 수
+      size_t pending_sockets;  ///< 큐가 비어 있지 않은 소켓 수
+      uint64_t queued;         ///< 소켓 버퍼가 차서 큐에 넣은 전송 수
+      uint64_t slow_consumers; ///< 큐가 한도를 넘어 끊은 연결 수
+    };
+
+    static const size_t CHUNK_SHIFT = 10;
+    static const size_t CHUNK_SIZE = size_t(1) << CHUNK_SHIFT; ///< 청크 하나의 소켓 수
+    static const size_t MAX_SOCKETS = size_t(1) << 20; ///< 다룰 수 있는 가장 큰 소켓 번호 + 1
+
+  private:
+    /**
+     * @brief 소켓 하나의 큐
+     */
+    struct Queue {
+      std::mutex mutex;
+      std::string pending; ///< 보내지 못한 바이트
+      size_t offset = 0; ///< pending 앞쪽에서 이미 보낸 바이트 수
+      bool closed = false; ///< 더 보내지 않는다, open() 까지 유지된다
+      uint32_t connection = 0; ///< 이 소켓 번호를 지금 쓰는 연결 번호, 0 이면 열린 연결이 없다
+
+      size_t backlog() const {return pending.size() - offset;}
+    };
+
+    std::unique_ptr<std::atomic<Queue *>[]> chunks;
+    size_t max_bytes;
+    std::mutex pending_mutex;
+    std::set<int> pending_sockets; ///< 큐가 비어 있지 않은 소켓들
+    std::atomic<size_t> pending_bytes {0};
+    std::atomic<uint64_t> queued {0};
+    std::atomic<uint64_t> slow_consumers {0};
+
+    Queue *queue(int sock) {
+      if (sock < 0 || static_cast<size_t>(sock) >= MAX_SOCKETS) {
+        return nullptr;
+      }
+      std::atomic<Queue *> &chunk = chunks[sock >> CHUNK_SHIFT];
+      Queue *queues = chunk.load(std::memory_order_acquire);
+      if (queues == nullptr) {
+        Queue *created = new Queue[CHUNK_SIZE];
+        if (chunk.compare_exchange_strong(queues, created, std::memory_order_acq_rel)) {
+          queues = created;
+        } else {
+          delete[] created;
+        }
+      }
+      return &queues[sock & (CHUNK_SIZE - 1)];
+    }
+
+    /**
+     * @brief 큐를 비우고 pending_sockets 에서 뺀다. 큐의 mutex 를 잡은 채로 부른다.
+     */
+    void clear_locked(int sock, Queue &q) {
+      if (q.backlog() > 0) {
+        pending_bytes.fetch_sub(q.backlog(), std::memory_order_relaxed);
+        std::unique_lock<std::mutex> lock(pending_mutex);
+        pending_sockets.erase(sock);
+      }
+      q.pending.clear();
+      q.offset = 0;
+      // 느린 소비자의 큰 버퍼를 붙잡고 있지 않는다
+      if (q.pending.capacity() > 64 * 1024) {
+        q.pending.shrink_to_fit();
+      }
+    }
+
+    /**
+     * @brief 전송 오류로 큐를 닫는다. 큐의 mutex 를 잡은 채로 부른다.
+     */
+    void fail_locked(int sock, Queue &q) {
+      std::cerr << "sendmsg() failed: " << strerror(errno) << ", clientSock: " << sock << std::endl;
+      clear_locked(sock, q);
+      q.closed = true;
+    }
+
+  public:
+    /**
+     * @brief 생성자
+     *
+     * @param max_bytes 소켓 하나의 큐에 쌓일 수 있는 바이트 수. 이미 이만큼 쌓인 큐에 더 보내려 하면 연결을 끊는다.
+     */
+    explicit OutboundQueues(size_t max_bytes) : chunks(new std::atomic<Queue *>[MAX_SOCKETS / CHUNK_SIZE]), max_bytes(max_bytes) {
+      for (size_t i = 0; i < MAX_SOCKETS / CHUNK_SIZE; ++i) {
+        chunks[i].store(nullptr, std::memory_order_relaxed);
+      }
+    }
+
+    OutboundQueues(const OutboundQueues &) = delete;
+    OutboundQueues &operator=(const OutboundQueues &) = delete;
+
+    ~OutboundQueues() {
+      for (size_t i = 0; i < MAX_SOCKETS / CHUNK_SIZE; ++i) {
+        delete[] chunks[i].load(std::memory_order_relaxed);
+      }
+    }
+
+    /**
+     * @brief iov 를 막히지 않고 보낸다. 큐가 비어 있으면 소켓에 바로 쓰고, 다 쓰지 못한 나머지와
+     *        큐가 비어 있지 않을 때의 전송은 큐에 넣는다.
+     *
+     * @param sock 클라이언트 소켓 번호
+     * @param connection 받을 연결의 번호, 소켓을 지금 쓰는 연결이 아니면 버린다
+     * @param iov 보낼 버퍼들, 바뀔 수 있다
+     * @param count iov 의 개수
+     */
+    Result send(int sock, uint32_t connection, iovec *iov, size_t count) {
+      Queue *q = queue(sock);
+      if (q == nullptr) {
+        return Result::CLOSED;
+      }
+      std::unique_lock<std::mutex> lock(q->mutex);
+      if (q->closed || q->connection != connection) {
+        return Result::CLOSED;
+      }
+
+      size_t index = 0;
+      if (q->backlog() == 0) {
+        while (index < count) {
+          msghdr msg = {};
+          msg.msg_iov = &iov[index];
+          msg.msg_iovlen = std::min(count - index, (size_t)IOV_MAX);
+          ssize_t num_sent = sendmsg(sock, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+          if (num_sent < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+              break;
+            }
+            fail_locked(sock, *q);
+            return Result::CLOSED;
+          }
+          // 보낸 만큼 iovec 을 앞으로 민다
+          while (num_sent > 0 && index < count) {
+            if ((size_t)num_sent >= iov[index].iov_len) {
+              num_sent -= iov[index].iov_len;
+              ++index;
+            } else {
+              iov[index].iov_base = (char *)iov[index].iov_base + num_sent;
+              iov[index].iov_len -= num_sent;
+              num_sent = 0;
+            }
+          }
+        }
+        if (index == count) {
+          return Result::SENT;
+        }
+      }
+
+      size_t remaining = 0;
+      for (size_t i = index; i < count; ++i) {
+        remaining += iov[i].iov_len;
+      }
+      size_t backlog = q->backlog();
+      if (backlog > 0 && backlog + remaining > max_bytes) {
+        std::cerr << "slow consumer: clientSock " << sock << " 에 " << backlog << " bytes 가 쌓여 연결을 끊습니다" << std::endl;
+        clear_locked(sock, *q);
+        q->closed = true;
+        slow_consumers.fetch_add(1, std::memory_order_relaxed);
+        shutdown(sock, SHUT_RDWR);
+        return Result::CLOSED;
+      }
+
+      for (size_t i = index; i < count; ++i) {
+        q->pending.append(static_cast<const char *>(iov[i].iov_base), iov[i].iov_len);
+      }
+      pending_bytes.fetch_add(remaining, std::memory_order_relaxed);
+      queued.fetch_add(1, std::memory_order_relaxed);
+      if (backlog == 0) {
+        std::unique_lock<std::mutex> pending_lock(pending_mutex);
+        pending_sockets.insert(sock);
+      }
+      return Result::QUEUED;
+    }
+
+    /**
+     * @brief 큐에 쌓인 바이트를 소켓 버퍼가 받는 만큼 보낸다. 소켓에 쓸 수 있게 되었을 때 부른다.
+     *
+     * @param sock 클라이언트 소켓 번호
+     * @return 전송 오류로 큐를 닫았으면 false
+     */
+    bool flush(int sock) {
+      Queue *q = queue(sock);
+      if (q == nullptr) {
+        return false;
+      }
+      std::unique_lock<std::mutex> lock(q->mutex);
+      while (q->backlog() > 0) {
+        ssize_t num_sent = ::send(sock, q->pending.data() + q->offset, q->backlog(), MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (num_sent < 0) {
+          if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            break;
+          }
+          fail_locked(sock, *q);
+          return false;
+        }
+        q->offset += num_sent;
+        pending_bytes.fetch_sub(num_sent, std::memory_order_relaxed);
+      }
+
+      if (q->backlog() == 0) {
+        clear_locked(sock, *q);
+      } else if (q->offset > q->pending.size() / 2) {
+        // 보낸 앞부분을 가끔 지워 큐가 계속 자라지 않게 한다
+        q->pending.erase(0, q->offset);
+        q->offset = 0;
+      }
+      return !q->closed;
+    }
+
+    /**
+     * @brief 새 연결이 소켓을 쓰기 시작할 때 큐를 비우고 그 연결로의 전송을 받기 시작한다.
+     *
+     * @param sock 클라이언트 소켓 번호
+     * @param connection 새 연결의 번호, 0 이 아니어야 한다
+     */
+    void open(int sock, uint32_t connection) {
+      Queue *q = queue(sock);
+      if (q == nullptr) {
+        return;
+      }
+      std::unique_lock<std::mutex> lock(q->mutex);
+      clear_locked(sock, *q);
+      q->closed = false;
+      q->connection = connection;
+    }
+
+    /**
+     * @brief 연결을 닫을 때 큐를 비우고 그 뒤의 전송을 버린다.
+     *
+     * 소켓을 close() 하기 전에 부른다. 큐의 mutex 를 거치므로 이 뒤로는 어느 쓰레드도 이 소켓 번호에 쓰지 않고,
+     * 그래서 닫힌 소켓 번호를 새 연결이 받아도 이전 연결로 가던 전송이 섞이지 않는다.
+     */
+    void close(int sock) {
+      Queue *q = queue(sock);
+      if (q == nullptr) {
+        return;
+      }
+      std::unique_lock<std::mutex> lock(q->mutex);
+      clear_locked(sock, *q);
+      q->closed = true;
+      q->connection = 0;
+    }
+
+    /**
+     * @brief 큐가 비어 있지 않은 소켓들. 메인 루프가 이 소켓들에 쓸 수 있게 되기를 기다린다.
+     */
+    std::vector<int> get_pending_sockets() {
+      std::unique_lock<std::mutex> lock(pending_mutex);
+      return std::vector<int>(pending_sockets.begin(), pending_sockets.end());
+    }
+
+    //getter
+    Stats get_stats() {
+      size_t sockets;
+      {
+        std::unique_lock<std::mutex> lock(pending_mutex);
+        sockets = pending_sockets.size();
+      }
+      return Stats {pending_bytes.load(std::memory_order_relaxed), sockets, queued.load(std::memory_order_relaxed),
+                    slow_consumers.load(std::memory_order_relaxed)};
+    }
+    size_t get_max_bytes() const {return max_bytes;}
+};
+
+#endif
@@ -0,0 +1,246 @@
+/**
+ * @file presence.h
+ * @brief 방의 입장/퇴장 알림을 모아서 보내는 coalescing 창과 그 창을 닫는 타이머
+ *
+ * 입장과 퇴장마다 방 멤버 전체에 알림을 보내면, 방에 n 명이 몰려 들어올 때 O(n^2) 개의 메시지가 나간다.
+ * 방마다 변화율(churn)을 지수 이동 평균으로 재고, 방 크기 x 변화율 이 한 방에 허용한 초당 전달 수를
+ * 넘으면 창을 열어 그동안의 입장/퇴장을 모았다가 요약 알림 하나로 보낸다.
+ * 창의 길이는 요약 알림의 전달 수가 허용치 안에 들도록 방 크기에 비례해 정한다.
+ * 조용한 작은 방은 창을 열지 않고 예전처럼 바로 보낸다.
+ */
+
+#ifndef CHAT_SERVER_PRESENCE_H
+#define CHAT_SERVER_PRESENCE_H
+
+#include <math.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "name_table.h"
+
+/**
+ * @brief 방 하나의 입장/퇴장 coalescing 상태. 방의 lock 안에서 쓴다.
+ */
+class PresenceCoalescer {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr double DELIVERY_BUDGET = 10000; ///< 한 방의 알림이 초당 멤버에게 전달될 수 있는 수
+    static constexpr double CHURN_TAU = 1.0; ///< 변화율 이동 평균의 시간 상수 (초)
+    static constexpr std::chrono::milliseconds MIN_WINDOW {50};
+    static constexpr std::chrono::milliseconds MAX_WINDOW {2000};
+    static constexpr size_t MAX_LISTED_NAMES = 3; ///< 요약에 이름을 적는 최대 인원, 나머지는 "외 N명"
+
+    /**
+     * @brief record() 의 결과
+     */
+    struct Decision {
+      bool immediate; ///< 모으지 않고 바로 보내야 한다
+      bool schedule; ///< 새 창이 열렸으므로 deadline 에 flush 를 예약해야 한다
+      Clock::time_point deadline; ///< 창이 닫히는 시각
+    };
+
+  private:
+    double churn = 0; ///< 초당 입장/퇴장 수의 이동 평균
+    Clock::time_point last_event;
+    bool window_open = false;
+    Clock::time_point deadline;
+    std::vector<NamePtr> joined;
+    std::vector<NamePtr> left;
+
+    /**
+     * @brief 이름들을 "[a], [b], [c] 님 외 N명이" 꼴로 적는다.
+     */
+    static std::string list_names(const std::vector<NamePtr> &names) {
+      std::string text;
+      size_t listed = std::min(names.size(), MAX_LISTED_NAMES);
+      for (size_t i = 0; i < listed; ++i) {
+        if (i > 0) {
+          text += ", ";
+        }
+        text += "[" + names[i]->get() + "]";
+      }
+      if (names.size() > listed) {
+        text += " 님 외 " + std::to_string(names.size() - listed) + "명이";
+      } else {
+        text += " 님이";
+      }
+      return text;
+    }
+
+  public:
+    /**
+     * @brief 방 크기와 변화율에 맞는 창의 길이. 0 이면 모으지 않는다.
+     *
+     * @param members 방 멤버 수
+     * @param churn 초당 입장/퇴장 수
+     */
+    static std::chrono::milliseconds window_for(size_t members, double churn) {
+      if (members * churn <= DELIVERY_BUDGET) {
+        return std::chrono::milliseconds(0);
+      }
+      // 창마다 요약 하나가 멤버 전체에 가므로 초당 전달 수는 members / window 이다
+      auto window = std::chrono::milliseconds(static_cast<long>(members * 1000 / DELIVERY_BUDGET));
+      return std::max(MIN_WINDOW, std::min(MAX_WINDOW, window));
+    }
+
+    /**
+     * @brief 입장 또는 퇴장을 기록.
+     *
+     * 창이 열려 있으면 요약에 모은다. 창이 닫혀 있고 변화율이 낮으면 바로 보내라고 알려주고,
+     * 변화율이 높으면 새 창을 연다. 창 안에서 들어왔다 나간 사람과 나갔다 다시 들어온 사람은 요약에서 빠진다.
+     *
+     * @param name 입장하거나 퇴장한 사람
+     * @param is_join 입장이면 true
+     * @param members 기록 후의 방 멤버 수
+     * @param now 현재 시각
+     */
+    Decision record(const NamePtr &name, bool is_join, size_t members, Clock::time_point now) {
+      double elapsed = std::chrono::duration<double>(now - last_event).count();
+      churn = churn * exp(-elapsed / CHURN_TAU) + 1 / CHURN_TAU;
+      last_event = now;
+
+      if (!window_open) {
+        auto window = window_for(members, churn);
+        if (window.count() == 0) {
+          return Decision {true, false, now};
+        }
+        window_open = true;
+        deadline = now + window;
+        (is_join ? joined : left).push_back(name);
+        return Decision {false, true, deadline};
+      }
+
+      // 반대쪽 목록에 있으면 서로 지운다
+      std::vector<NamePtr> &opposite = is_join ? left : joined;
+      auto it = std::find(opposite.begin(), opposite.end(), name);
+      if (it != opposite.end()) {
+        opposite.erase(it);
+        return Decision {false, false, deadline};
+      }
+      (is_join ? joined : left).push_back(name);
+      return Decision {false, false, deadline};
+    }
+
+    /**
+     * @brief 창을 닫고 모인 입장/퇴장의 요약을 돌려준다.
+     *
+     * @return 요약 알림 내용, 보낼 것이 없으면 빈 문자열
+     */
+    std::string flush() {
+      std::string text;
+      if (!joined.empty()) {
+        text = list_names(joined) + " 입장했습니다.";
+      }
+      if (!left.empty()) {
+        if (!text.empty()) {
+          text += " ";
+        }
+        text += list_names(left) + " 퇴장했습니다.";
+      }
+      joined.clear();
+      left.clear();
+      window_open = false;
+      return text;
+    }
+
+    /**
+     * @brief 한 사람의 입장 또는 퇴장 알림 내용.
+     */
+    static std::string single(const NamePtr &name, bool is_join) {
+      return "[" + name->get() + "] 님이 " + (is_join ? "입장했습니다." : "퇴장했습니다.");
+    }
+};
+
+/**
+ * @brief 방의 coalescing 창이 닫힐 시각에 콜백을 부르는 타이머 쓰레드
+ */
+class PresenceScheduler {
+  public:
+    using Clock = PresenceCoalescer::Clock;
+
+  private:
+    using Timer = std::pair<Clock::time_point, int>;
+
+    std::mutex timer_mutex;
+    std::condition_variable timer_cv;
+    std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> timers; ///< (시각, 방 ID), 이른 것부터
+    bool stopping = false;
+    std::function<void(int)> on_due;
+    std::thread thread;
+
+    void run() {
+      std::unique_lock<std::mutex> lock(timer_mutex);
+      while (!stopping) {
+        if (timers.empty()) {
+          timer_cv.wait(lock);
+          continue;
+        }
+        Timer next = timers.top();
+        if (Clock::now() < next.first) {
+          timer_cv.wait_until(lock, next.first);
+          continue;
+        }
+        timers.pop();
+        lock.unlock();
+        on_due(next.second);
+        lock.lock();
+      }
+    }
+
+  public:
+    PresenceScheduler() {}
+
+    PresenceScheduler(const PresenceScheduler &) = delete;
+    PresenceScheduler &operator=(const PresenceScheduler &) = delete;
+
+    ~PresenceScheduler() {
+      stop();
+    }
+
+    /**
+     * @brief 타이머 쓰레드를 띄운다.
+     *
+     * @param callback 창이 닫힐 때 방 ID 로 불린다
+     */
+    void start(std::function<void(int)> callback) {
+      on_due = std::move(callback);
+      thread = std::thread([this]() {run();});
+    }
+
+    /**
+     * @brief room_id 의 창을 deadline 에 닫도록 예약.
+     */
+    void schedule(int room_id, Clock::time_point deadline) {
+      {
+        std::unique_lock<std::mutex> lock(timer_mutex);
+        timers.emplace(deadline, room_id);
+      }
+      timer_cv.notify_one();
+    }
+
+    /**
+     * @brief 쓰레드를 멈춘다. 아직 닫히지 않은 창은 버린다. 여러 번 불러도 된다.
+     */
+    void stop() {
+      {
+        std::unique_lock<std::mutex> lock(timer_mutex);
+        stopping = true;
+      }
+      timer_cv.notify_one();
+      if (thread.joinable()) {
+        thread.join();
+      }
+    }
+};
+
+#endif
@@ -0,0 +1,244 @@
+/**
+ * @file room_search.h
+ * @brief 방 제목 검색용 trigram 인덱스
+ *
+ * 제목의 연속된 3바이트(trigram)마다 그 trigram 을 가진 방 ID 의 정렬된 목록(posting list)을 둔다.
+ * 3바이트 이상인 검색어는 검색어의 trigram 목록들 중 가장 짧은 것을 훑으며 나머지 목록에 있는지
+ * 이진 탐색으로 확인하고, 후보의 제목에 검색어가 실제로 들어 있는지 확인해 부분 문자열 검색을 한다.
+ * 바이트 단위라 UTF-8 한글 제목도 그대로 검색된다.
+ *
+ * 3바이트보다 짧은 검색어는 trigram 이 없으므로 제목 순으로 정렬된 집합에서 접두사 검색을 한다.
+ *
+ * 방을 지울 때는 posting list 를 바로 고치지 않는다. 지운 방은 제목 확인에서 걸러지고,
+ * 지운 항목이 살아 있는 항목보다 많아지면 posting list 전체를 다시 만든다.
+ */
+
+#ifndef CHAT_SERVER_ROOM_SEARCH_H
+#define CHAT_SERVER_ROOM_SEARCH_H
+
+#include <limits.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief 방 제목의 부분 문자열, 접두사 검색 인덱스
+ */
+class RoomSearchIndex {
+  public:
+    static const size_t MIN_SUBSTRING_QUERY = 3; ///< 이보다 짧은 검색어는 접두사 검색
+
+    /**
+     * @brief 검색 지표
+     */
+    struct Stats {
+      size_t rooms; ///< 인덱스에 있는 방 수
+      size_t memory_bytes; ///< 인덱스가 쓰는 메모리 추정치
+      uint64_t queries; ///< 검색 횟수
+      uint64_t total_query_ns; ///< 검색에 쓴 시간의 합
+      uint64_t max_query_ns; ///< 가장 오래 걸린 검색
+    };
+
+  private:
+    std::mutex index_mutex;
+    std::unordered_map<int, std::string> titles; ///< 방 ID -> 제목
+    std::set<std::pair<std::string, int>> by_title; ///< (제목, 방 ID), 짧은 검색어의 접두사 검색용
+    std::unordered_map<uint32_t, std::vector<int>> postings; ///< trigram -> 방 ID 오름차순 목록
+    size_t posting_entries = 0; ///< posting list 항목 수의 합
+    size_t stale_entries = 0; ///< 그 중 지운 방의 항목 수
+
+    std::atomic<uint64_t> queries {0};
+    std::atomic<uint64_t> total_query_ns {0};
+    std::atomic<uint64_t> max_query_ns {0};
+
+    static uint32_t trigram(const char *p) {
+      return (static_cast<uint32_t>(static_cast<uint8_t>(p[0])) << 16)
+        | (static_cast<uint32_t>(static_cast<uint8_t>(p[1])) << 8)
+        | static_cast<uint8_t>(p[2]);
+    }
+
+    /**
+     * @brief 문자열의 서로 다른 trigram 들
+     */
+    static std::vector<uint32_t> trigrams(std::string_view text) {
+      std::vector<uint32_t> result;
+      for (size_t i = 0; i + 3 <= text.size(); ++i) {
+        result.push_back(trigram(text.data() + i));
+      }
+      std::sort(result.begin(), result.end());
+      result.erase(std::unique(result.begin(), result.end()), result.end());
+      return result;
+    }
+
+    void add_postings(int room_id, const std::string &title) {
+      for (uint32_t t : trigrams(title)) {
+        auto &list = postings[t];
+        // 새 방의 ID 는 대개 가장 크지만, 다시 쓰인 슬롯이나 다른 쓰레드의 생성 때문에 더 작을 수 있다
+        if (list.empty() || list.back() < room_id) {
+          list.push_back(room_id);
+        } else {
+          list.insert(std::upper_bound(list.begin(), list.end(), room_id), room_id);
+        }
+        ++posting_entries;
+      }
+    }
+
+    void rebuild_postings() {
+      std::vector<std::pair<int, const std::string *>> rooms;
+      rooms.reserve(titles.size());
+      for (auto &entry : titles) {
+        rooms.emplace_back(entry.first, &entry.second);
+      }
+      std::sort(rooms.begin(), rooms.end());
+
+      postings.clear();
+      posting_entries = 0;
+      stale_entries = 0;
+      for (auto &room : rooms) {
+        add_postings(room.first, *room.second);
+      }
+    }
+
+    void record_query(std::chrono::steady_clock::time_point start) {
+      uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+      queries.fetch_add(1, std::memory_order_relaxed);
+      total_query_ns.fetch_add(ns, std::memory_order_relaxed);
+      uint64_t max = max_query_ns.load(std::memory_order_relaxed);
+      while (ns > max && !max_query_ns.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {}
+    }
+
+  public:
+    /**
+     * @brief 새 방을 인덱스에 추가.
+     *
+     * @param room_id 방 ID
+     * @param title 방 제목
+     */
+    void add(int room_id, const std::string &title) {
+      std::unique_lock<std::mutex> lock(index_mutex);
+      if (!titles.emplace(room_id, title).second) {
+        return;
+      }
+      by_title.emplace(title, room_id);
+      add_postings(room_id, title);
+    }
+
+    /**
+     * @brief 사라진 방을 인덱스에서 뺀다.
+     *
+     * @param room_id 방 ID
+     */
+    void remove(int room_id) {
+      std::unique_lock<std::mutex> lock(index_mutex);
+      auto it = titles.find(room_id);
+      if (it == titles.end()) {
+        return;
+      }
+      by_title.erase({it->second, room_id});
+      stale_entries += trigrams(it->second).size();
+      titles.erase(it);
+
+      if (stale_entries > 1024 && stale_entries * 2 > posting_entries) {
+        rebuild_postings();
+      }
+    }
+
+    /**
+     * @brief 제목에 query 가 들어 있는 방을 찾는다.
+     *
+     * query 가 MIN_SUBSTRING_QUERY 바이트 이상이면 부분 문자열 검색으로 방 ID 순서,
+     * 그보다 짧으면 접두사 검색으로 제목 순서의 결과를 돌려준다.
+     *
+     * @param query 검색어, 비어 있으면 안 된다
+     * @param limit 최대 결과 수
+     * @param room_ids 결과
+     */
+    void search(std::string_view query, size_t limit, std::vector<int> &room_ids) {
+      auto start = std::chrono::steady_clock::now();
+      room_ids.clear();
+      {
+        std::unique_lock<std::mutex> lock(index_mutex);
+        if (query.size() < MIN_SUBSTRING_QUERY) {
+          for (auto it = by_title.lower_bound({std::string(query), INT_MIN});
+               it != by_title.end() && room_ids.size() < limit && it->first.compare(0, query.size(), query) == 0; ++it) {
+            room_ids.push_back(it->second);
+          }
+        } else {
+          std::vector<const std::vector<int> *> lists;
+          bool missing = false;
+          for (uint32_t t : trigrams(query)) {
+            auto it = postings.find(t);
+            if (it == postings.end()) {
+              missing = true;
+              break;
+            }
+            lists.push_back(&it->second);
+          }
+          if (!missing) {
+            std::sort(lists.begin(), lists.end(), [](auto *a, auto *b) {return a->size() < b->size();});
+            // 목록이 모두 정렬되어 있으므로 다른 목록에서는 지난번 위치부터 찾는다
+            std::vector<std::vector<int>::const_iterator> cursors;
+            for (auto *list : lists) {
+              cursors.push_back(list->begin());
+            }
+            for (int room_id : *lists[0]) {
+              if (room_ids.size() == limit) {
+                break;
+              }
+              bool in_all = true;
+              for (size_t i = 1; i < lists.size() && in_all; ++i) {
+                cursors[i] = std::lower_bound(cursors[i], lists[i]->end(), room_id);
+                in_all = cursors[i] != lists[i]->end() && *cursors[i] == room_id;
+              }
+              if (!in_all) {
+                continue;
+              }
+              // trigram 이 모두 있어도 붙어 있지 않을 수 있고, 지운 방일 수도 있다
+              auto title = titles.find(room_id);
+              if (title != titles.end() && title->second.find(query) != std::string::npos) {
+                room_ids.push_back(room_id);
+              }
+            }
+          }
+        }
+      }
+      record_query(start);
+    }
+
+    /**
+     * @brief 인덱스 크기와 검색 지표.
+     */
+    Stats get_stats() {
+      std::unique_lock<std::mutex> lock(index_mutex);
+      // 노드 기반 컨테이너는 노드마다 포인터와 할당 헤더 정도의 오버헤드를 더해 추정한다
+      const size_t NODE_OVERHEAD = 32;
+      size_t memory = postings.bucket_count() * sizeof(void *) + titles.bucket_count() * sizeof(void *);
+      for (auto &entry : postings) {
+        memory += NODE_OVERHEAD + sizeof(entry) + entry.second.capacity() * sizeof(int);
+      }
+      for (auto &entry : titles) {
+        memory += NODE_OVERHEAD + sizeof(entry) + entry.second.capacity();
+      }
+      for (auto &entry : by_title) {
+        memory += NODE_OVERHEAD + sizeof(entry) + entry.first.capacity();
+      }
+      return Stats {
+        titles.size(),
+        memory,
+        queries.load(std::memory_order_relaxed),
+        total_query_ns.load(std::memory_order_relaxed),
+        max_query_ns.load(std::memory_order_relaxed),
+      };
+    }
+};
+
+#endif
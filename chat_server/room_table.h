@@ -0,0 +1,277 @@
+/**
+ * @file room_table.h
+ * @brief 세대(generation) 태그가 붙은 방 ID 의 lock-free 할당기와, 방 ID 의 슬롯으로 바로 찾는 방 테이블
+ *
+ * 방 ID 는 (세대 << SLOT_BITS) | 슬롯 이다. 슬롯은 테이블 배열의 위치라 방은 해시 없이 배열 인덱스로 찾는다.
+ * 방이 사라지면 그 슬롯의 세대를 올리고 슬롯을 free list 에 돌려놓는다. 다시 쓰인 슬롯은 다른 ID 를 가지므로,
+ * 사라진 방의 ID 로 보낸 CSJoinRoom 은 새 방이 아니라 "없는 방" 으로 처리된다.
+ *
+ * free list 는 Treiber stack 이다. head 에 슬롯과 함께 바뀔 때마다 늘어나는 태그를 담아 ABA 를 막는다.
+ * 슬롯 0 은 쓰지 않으므로 ID 0 은 "방 없음" 으로 남고, 처음 만들어지는 방들은 예전처럼 1, 2, 3 ... 을 받는다.
+ */
+
+#ifndef CHAT_SERVER_ROOM_TABLE_H
+#define CHAT_SERVER_ROOM_TABLE_H
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**
+ * @brief 슬롯을 재사용하고 세대를 붙여 방 ID 를 나눠주는 lock-free 할당기
+ */
+class RoomIdAllocator {
+  public:
+    static const int SLOT_BITS = 21;
+    static const uint32_t MAX_SLOTS = uint32_t(1) << SLOT_BITS; ///< 동시에 있을 수 있는 방 수 + 1 (슬롯 0)
+    static const uint32_t GENERATION_MASK = (uint32_t(1) << (31 - SLOT_BITS)) - 1; ///< ID 가 양의 int 에 들어가도록 세대는 10비트에서 돈다
+
+    static uint32_t slot_of(int id) {return static_cast<uint32_t>(id) & (MAX_SLOTS - 1);}
+    static uint32_t generation_of(int id) {return static_cast<uint32_t>(id) >> SLOT_BITS;}
+
+  private:
+    static const uint32_t NIL = UINT32_MAX;
+
+    // 쓰기 전에 항상 값을 쓰므로 초기화하지 않는다. 안 쓰인 슬롯의 페이지는 메모리를 차지하지 않는다.
+    std::unique_ptr<std::atomic<uint32_t>[]> next; ///< free list 에서 다음 슬롯
+    std::unique_ptr<std::atomic<uint16_t>[]> generations; ///< 슬롯의 현재 세대
+    std::atomic<uint64_t> head {NIL}; ///< (태그 << 32) | free list 의 첫 슬롯
+    std::atomic<uint32_t> unused {1}; ///< 아직 한 번도 쓰지 않은 첫 슬롯
+
+    int make_id(uint32_t slot) const {
+      return static_cast<int>((static_cast<uint32_t>(generations[slot].load(std::memory_order_relaxed)) << SLOT_BITS) | slot);
+    }
+
+  public:
+    RoomIdAllocator() : next(new std::atomic<uint32_t>[MAX_SLOTS]), generations(new std::atomic<uint16_t>[MAX_SLOTS]) {}
+
+    RoomIdAllocator(const RoomIdAllocator &) = delete;
+    RoomIdAllocator &operator=(const RoomIdAllocator &) = delete;
+
+    /**
+     * @brief 새 방 ID. 돌려받은 슬롯이 있으면 그 슬롯을 다음 세대로 다시 쓴다.
+     *
+     * @return 방 ID, 슬롯이 모두 쓰이고 있으면 0
+     */
+    int allocate() {
+      uint64_t old = head.load(std::memory_order_acquire);
+      while (static_cast<uint32_t>(old) != NIL) {
+        uint32_t slot = static_cast<uint32_t>(old);
+        uint64_t desired = (((old >> 32) + 1) << 32) | next[slot].load(std::memory_order_relaxed);
+        if (head.compare_exchange_weak(old, desired, std::memory_order_acquire, std::memory_order_acquire)) {
+          return make_id(slot);
+        }
+      }
+
+      uint32_t slot = unused.load(std::memory_order_relaxed);
+      do {
+        if (slot >= MAX_SLOTS) {
+          return 0;
+        }
+      } while (!unused.compare_exchange_weak(slot, slot + 1, std::memory_order_relaxed));
+      generations[slot].store(0, std::memory_order_relaxed);
+      return make_id(slot);
+    }
+
+    /**
+     * @brief 사라진 방의 ID 를 돌려준다. 슬롯의 세대가 올라가 같은 ID 는 다시 나오지 않는다 (세대가 한 바퀴 돌 때까지).
+     *
+     * @param id allocate() 가 돌려준 방 ID
+     */
+    void release(int id) {
+      uint32_t slot = slot_of(id);
+      generations[slot].store(static_cast<uint16_t>((generation_of(id) + 1) & GENERATION_MASK), std::memory_order_relaxed);
+
+      uint64_t old = head.load(std::memory_order_relaxed);
+      uint64_t desired;
+      do {
+        next[slot].store(static_cast<uint32_t>(old), std::memory_order_relaxed);
+        desired = (((old >> 32) + 1) << 32) | slot;
+      } while (!head.compare_exchange_weak(old, desired, std::memory_order_release, std::memory_order_relaxed));
+    }
+};
+
+/**
+ * @brief 방 ID 의 슬롯을 배열 인덱스로 쓰는 테이블. 저장된 ID 와 세대까지 같아야 찾은 것으로 본다.
+ *
+ * 값은 고정 크기 청크에 제자리 생성되고 옮겨지지 않는다. 청크 포인터 배열은 처음부터 최대 크기로 잡아
+ * 늘어나지 않으므로, 찾기는 재할당과 겹칠 걱정 없이 배열 두 번을 읽고 끝난다.
+ * 값을 만들고 지우는 쪽은 서로 배제되어야 한다 (chat_server 에서는 room_mutex).
+ *
+ * @tparam Value 저장할 값 타입
+ */
+template <typename Value>
+class RoomTable {
+  public:
+    using Handle = uint32_t; ///< 값의 슬롯
+
+  private:
+    static const size_t CHUNK_SHIFT = 10;
+    static const size_t CHUNK_SIZE = size_t(1) << CHUNK_SHIFT; ///< 청크 하나의 슬롯 수
+    static const size_t NUM_CHUNKS = RoomIdAllocator::MAX_SLOTS / CHUNK_SIZE;
+
+    /**
+     * @brief 테이블의 칸 하나
+     */
+    struct Slot {
+      int key = 0; ///< 슬롯에 든 값의 방 ID, 세대 포함
+      bool live = false;
+      alignas(Value) unsigned char storage[sizeof(Value)];
+
+      Value *value() {return std::launder(reinterpret_cast<Value *>(storage));}
+    };
+
+    RoomIdAllocator ids;
+    std::unique_ptr<std::atomic<Slot *>[]> chunks; ///< 청크들, 처음 쓰일 때 할당한다
+    std::atomic<uint32_t> slot_limit {0}; ///< 한 번이라도 쓰인 가장 큰 슬롯 + 1
+    size_t count = 0;
+
+    Slot *slot(Handle handle) const {
+      Slot *chunk = chunks[handle >> CHUNK_SHIFT].load(std::memory_order_acquire);
+      return chunk == nullptr ? nullptr : &chunk[handle & (CHUNK_SIZE - 1)];
+    }
+
+  public:
+    /**
+     * @brief 살아 있는 값을 슬롯 순서로 도는 반복자
+     */
+    class iterator {
+      private:
+        const RoomTable *table;
+        Handle handle;
+
+        void skip_dead() {
+          Handle limit = table->slot_limit.load(std::memory_order_acquire);
+          while (handle < limit) {
+            Slot *s = table->slot(handle);
+            if (s != nullptr && s->live) {
+              break;
+            }
+            ++handle;
+          }
+        }
+
+      public:
+        iterator(const RoomTable *table, Handle handle) : table(table), handle(handle) {skip_dead();}
+
+        Value &operator*() const {return *table->slot(handle)->value();}
+        Value *operator->() const {return table->slot(handle)->value();}
+        iterator &operator++() {++handle; skip_dead(); return *this;}
+        bool operator==(const iterator &other) const {return handle == other.handle;}
+        bool operator!=(const iterator &other) const {return handle != other.handle;}
+        Handle get_handle() const {return handle;}
+    };
+
+    /**
+     * @brief 생성자
+     */
+    RoomTable() : chunks(new std::atomic<Slot *>[NUM_CHUNKS]) {
+      for (size_t i = 0; i < NUM_CHUNKS; ++i) {
+        chunks[i].store(nullptr, std::memory_order_relaxed);
+      }
+    }
+
+    RoomTable(const RoomTable &) = delete;
+    RoomTable &operator=(const RoomTable &) = delete;
+
+    ~RoomTable() {
+      clear();
+      for (size_t i = 0; i < NUM_CHUNKS; ++i) {
+        delete[] chunks[i].load(std::memory_order_relaxed);
+      }
+    }
+
+    /**
+     * @brief 새 방 ID 를 받는다. lock 없이 여러 쓰레드에서 불러도 된다.
+     *
+     * @return 방 ID, 테이블이 가득 찼으면 0
+     */
+    int allocate_key() {
+      return ids.allocate();
+    }
+
+    /**
+     * @brief allocate_key() 로 받은 key 의 슬롯에 값을 제자리 생성.
+     *
+     * @param key allocate_key() 가 돌려준 방 ID
+     * @param args Value 생성자 인자
+     * @return 값의 Handle
+     */
+    template <typename... Args>
+    Handle emplace(int key, Args &&... args) {
+      Handle handle = RoomIdAllocator::slot_of(key);
+      std::atomic<Slot *> &chunk = chunks[handle >> CHUNK_SHIFT];
+      if (chunk.load(std::memory_order_relaxed) == nullptr) {
+        chunk.store(new Slot[CHUNK_SIZE], std::memory_order_release);
+      }
+
+      Slot *s = slot(handle);
+      new (s->storage) Value(std::forward<Args>(args)...);
+      s->key = key;
+      s->live = true;
+      ++count;
+      if (handle >= slot_limit.load(std::memory_order_relaxed)) {
+        slot_limit.store(handle + 1, std::memory_order_release);
+      }
+      return handle;
+    }
+
+    /**
+     * @brief key 의 값, 없거나 세대가 다르면 nullptr
+     */
+    Value *find(int key) const {
+      if (key <= 0) {
+        return nullptr;
+      }
+      Slot *s = slot(RoomIdAllocator::slot_of(key));
+      return (s != nullptr && s->live && s->key == key) ? s->value() : nullptr;
+    }
+
+    /**
+     * @brief Handle 이 가리키는 값. Handle 은 살아 있는 값이어야 한다.
+     */
+    Value &get(Handle handle) const {
+      return *slot(handle)->value();
+    }
+
+    /**
+     * @brief key 의 값을 지우고 ID 를 할당기에 돌려준다.
+     *
+     * @return 지웠으면 true
+     */
+    bool erase(int key) {
+      if (find(key) == nullptr) {
+        return false;
+      }
+      Slot *s = slot(RoomIdAllocator::slot_of(key));
+      s->value()->~Value();
+      s->live = false;
+      --count;
+      ids.release(key);
+      return true;
+    }
+
+    /**
+     * @brief 모든 값을 지운다. 청크는 남겨 둔다.
+     */
+    void clear() {
+      Handle limit = slot_limit.load(std::memory_order_relaxed);
+      for (Handle handle = 0; handle < limit; ++handle) {
+        Slot *s = slot(handle);
+        if (s != nullptr && s->live) {
+          erase(s->key);
+        }
+      }
+    }
+
+    //getter
+    size_t size() const {return count;}
+    bool empty() const {return count == 0;}
+    iterator begin() const {return iterator(this, 0);}
+    iterator end() const {return iterator(this, slot_limit.load(std::memory_order_acquire));}
+};
+
+#endif
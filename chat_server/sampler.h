@@ -0,0 +1,497 @@
+/**
+ * @file sampler.h
+ * @brief 등록한 쓰레드의 스택을 SIGPROF 로 주기적으로 떠서 flame graph 용 folded stack 으로 내는 샘플링 프로파일러
+ *
+ * 운영 중에는 외부 프로파일러를 붙일 수 없으므로 서버 안에서 계속 샘플을 모으고, 필요할 때 최근 몇 초 분을 꺼내 본다.
+ *
+ * 쓰레드마다 CLOCK_THREAD_CPUTIME_ID 타이머를 두어 그 쓰레드가 CPU 를 쓴 시간에 비례해 SIGPROF 를 받는다. 그래서
+ * select() 나 condition variable 에서 쉬는 시간은 샘플에 들지 않고, 샘플 수가 곧 CPU 시간이다. 시그널 핸들러는
+ * backtrace() 로 스택의 주소만 떠서 그 쓰레드의 링에 넣고, 모으는 쓰레드가 링을 비워 1초 단위 묶음으로 센다.
+ * 주소를 함수 이름으로 바꾸는 것은 꺼낼 때 한다. 실행 파일의 함수는 /proc/self/exe 의 .symtab 에서, 공유 라이브러리의
+ * 함수는 dladdr() 로 찾는다. 인라인된 함수는 부른 함수에 합쳐진다.
+ */
+
+#ifndef CHAT_SERVER_SAMPLER_H
+#define CHAT_SERVER_SAMPLER_H
+
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <elf.h>
+#include <errno.h>
+#include <execinfo.h>
+#include <link.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "metrics.h"
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+/**
+ * @brief 실행 파일의 .symtab 에 있는 함수들. -rdynamic 없이 빌드하면 dladdr() 가 실행 파일의 함수를 찾지 못해서 직접 읽는다.
+ */
+class ExecutableSymbols {
+  private:
+    struct Symbol {
+      uintptr_t start; ///< 로드된 주소
+      uintptr_t end;
+      std::string name;
+    };
+
+    std::vector<Symbol> symbols; ///< start 순
+    std::vector<std::pair<uintptr_t, uintptr_t>> segments; ///< 실행 파일이 올라간 주소 범위들
+
+  public:
+    /**
+     * @brief 실행 파일이 올라간 위치와 함수 심볼을 읽는다.
+     *
+     * @return 심볼을 하나도 못 읽었으면 false (strip 된 실행 파일 등)
+     */
+    bool load() {
+      // dl_iterate_phdr 의 첫 항목이 실행 파일이다
+      uintptr_t bias = 0;
+      std::pair<uintptr_t *, std::vector<std::pair<uintptr_t, uintptr_t>> *> out(&bias, &segments);
+      dl_iterate_phdr([](dl_phdr_info *info, size_t, void *data) {
+        auto *out = static_cast<std::pair<uintptr_t *, std::vector<std::pair<uintptr_t, uintptr_t>> *> *>(data);
+        *out->first = info->dlpi_addr;
+        for (int i = 0; i < info->dlpi_phnum; ++i) {
+          if (info->dlpi_phdr[i].p_type == PT_LOAD) {
+            uintptr_t start = info->dlpi_addr + info->dlpi_phdr[i].p_vaddr;
+            out->second->emplace_back(start, start + info->dlpi_phdr[i].p_memsz);
+          }
+        }
+        return 1;
+      }, &out);
+
+      std::ifstream file("/proc/self/exe", std::ios::binary);
+      std::string image((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+      if (image.size() < sizeof(Elf64_Ehdr) || memcmp(image.data(), ELFMAG, SELFMAG) != 0 || image[EI_CLASS] != ELFCLASS64) {
+        return false;
+      }
+      const Elf64_Ehdr *header = reinterpret_cast<const Elf64_Ehdr *>(image.data());
+      if (header->e_shoff == 0 || header->e_shoff + header->e_shnum * sizeof(Elf64_Shdr) > image.size()) {
+        return false;
+      }
+      const Elf64_Shdr *sections = reinterpret_cast<const Elf64_Shdr *>(image.data() + header->e_shoff);
+      for (int i = 0; i < header->e_shnum; ++i) {
+        if (sections[i].sh_type != SHT_SYMTAB || sections[i].sh_link >= header->e_shnum) {
+          continue;
+        }
+        const Elf64_Shdr &strings = sections[sections[i].sh_link];
+        if (sections[i].sh_offset + sections[i].sh_size > image.size() || strings.sh_offset + strings.sh_size > image.size()) {
+          continue;
+        }
+        const Elf64_Sym *entries = reinterpret_cast<const Elf64_Sym *>(image.data() + sections[i].sh_offset);
+        size_t count = sections[i].sh_size / sizeof(Elf64_Sym);
+        for (size_t j = 0; j < count; ++j) {
+          if (ELF64_ST_TYPE(entries[j].st_info) != STT_FUNC || entries[j].st_value == 0 || entries[j].st_name >= strings.sh_size) {
+            continue;
+          }
+          const char *name = image.data() + strings.sh_offset + entries[j].st_name;
+          uintptr_t start = bias + entries[j].st_value;
+          symbols.push_back(Symbol {start, start + std::max<uint64_t>(entries[j].st_size, 1), demangle(name)});
+        }
+      }
+      std::sort(symbols.begin(), symbols.end(), [](const Symbol &a, const Symbol &b) {return a.start < b.start;});
+      return !symbols.empty();
+    }
+
+    bool contains(uintptr_t pc) const {
+      for (auto &segment : segments) {
+        if (pc >= segment.first && pc < segment.second) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    /**
+     * @brief pc 가 든 함수의 이름. 없으면 nullptr.
+     */
+    const std::string *find(uintptr_t pc) const {
+      auto it = std::upper_bound(symbols.begin(), symbols.end(), pc, [](uintptr_t pc, const Symbol &symbol) {return pc < symbol.start;});
+      if (it == symbols.begin() || pc >= (--it)->end) {
+        return nullptr;
+      }
+      return &it->name;
+    }
+
+    static std::string demangle(const char *name) {
+      int status = 0;
+      char *demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+      if (demangled == nullptr) {
+        return name;
+      }
+      std::string result(demangled);
+      free(demangled);
+      return result;
+    }
+};
+
+/**
+ * @brief 전역 샘플링 프로파일러
+ */
+class Sampler {
+  public:
+    static const int MAX_DEPTH = 64; ///< 샘플 하나에 남기는 가장 깊은 프레임 수
+
+  private:
+    // backtrace() 의 처음 두 프레임은 시그널 핸들러와 시그널 trampoline 이다
+    static const int SKIP_FRAMES = 2;
+
+    struct Sample {
+      int depth;
+      void *pcs[MAX_DEPTH];
+    };
+
+    /**
+     * @brief 쓰레드 하나의 샘플 링. 그 쓰레드의 시그널 핸들러가 넣고 모으는 쓰레드가 꺼낸다.
+     */
+    struct ThreadSlot {
+      static const size_t CAPACITY = 64; ///< 2의 거듭제곱, 모으는 주기 동안 쌓이는 샘플보다 넉넉해야 한다
+      std::string name;
+      Sample samples[CAPACITY];
+      std::atomic<uint64_t> head {0}; ///< 넣은 샘플 수, 시그널 핸들러만 쓴다
+      std::atomic<uint64_t> tail {0}; ///< 꺼낸 샘플 수, 모으는 쓰레드만 쓴다
+      std::atomic<uint64_t> dropped {0}; ///< 링이 차서 버린 샘플 수, 시그널 핸들러만 쓴다
+      uint64_t reported_dropped = 0; ///< 지표에 더한 dropped, 모으는 쓰레드만 쓴다
+    };
+
+    /**
+     * @brief 쓰레드가 끝날 때 그 쓰레드의 타이머를 지운다.
+     */
+    struct ThreadTimer {
+      timer_t timer;
+      bool created = false;
+
+      ~ThreadTimer() {
+        if (created) {
+          current_slot() = nullptr;
+          timer_delete(timer);
+        }
+      }
+    };
+
+    /**
+     * @brief 1초 동안 모은 샘플. 키는 쓰레드 번호 (4바이트) 뒤에 바깥 프레임부터의 주소들이다.
+     */
+    struct Bucket {
+      uint64_t second;
+      std::unordered_map<std::string, uint64_t> stacks;
+    };
+
+    std::atomic<bool> running {false};
+    int hz = 0;
+    int window_seconds = 0;
+    Counter &samples_total;
+    Counter &dropped_total;
+
+    std::mutex slots_mutex; ///< slots 에 쓰레드를 더할 때와 링을 비울 때 잡는다
+    std::vector<std::unique_ptr<ThreadSlot>> slots;
+
+    std::mutex buckets_mutex; ///< buckets 와 symbol_cache
+    std::deque<Bucket> buckets;
+    ExecutableSymbols executable;
+    std::unordered_map<uintptr_t, std::string> symbol_cache;
+
+    std::mutex collector_mutex;
+    std::condition_variable collector_cv;
+    std::thread collector;
+    std::string dump_path;
+    std::atomic<bool> dump_requested {false};
+
+    Sampler()
+      : samples_total(MetricsRegistry::instance().counter("chat_profile_samples_total", "샘플링 프로파일러가 모은 스택 수")),
+        dropped_total(MetricsRegistry::instance().counter("chat_profile_dropped_total", "링이 차서 버린 스택 수")) {}
+
+    static ThreadSlot *&current_slot() {
+      thread_local ThreadSlot *slot = nullptr;
+      return slot;
+    }
+
+    static void on_signal(int, siginfo_t *, void *) {
+      int saved_errno = errno;
+      ThreadSlot *slot = current_slot();
+      if (slot != nullptr) {
+        uint64_t head = slot->head.load(std::memory_order_relaxed);
+        if (head - slot->tail.load(std::memory_order_acquire) >= ThreadSlot::CAPACITY) {
+          slot->dropped.store(slot->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        } else {
+          Sample &sample = slot->samples[head & (ThreadSlot::CAPACITY - 1)];
+          sample.depth = backtrace(sample.pcs, MAX_DEPTH);
+          slot->head.store(head + 1, std::memory_order_release);
+        }
+      }
+      errno = saved_errno;
+    }
+
+    /**
+     * @brief 링들을 비워 이번 초의 묶음에 더하고 창보다 오래된 묶음을 버린다.
+     */
+    void collect() {
+      uint64_t second = metric_now_ns() / 1000000000ULL;
+      std::vector<std::string> keys;
+      {
+        std::unique_lock<std::mutex> lock(slots_mutex);
+        for (uint32_t i = 0; i < slots.size(); ++i) {
+          ThreadSlot &slot = *slots[i];
+          uint64_t tail = slot.tail.load(std::memory_order_relaxed);
+          uint64_t head = slot.head.load(std::memory_order_acquire);
+          for (; tail < head; ++tail) {
+            const Sample &sample = slot.samples[tail & (ThreadSlot::CAPACITY - 1)];
+            std::string key(reinterpret_cast<const char *>(&i), sizeof(i));
+            for (int j = sample.depth - 1; j >= SKIP_FRAMES; --j) {
+              key.append(reinterpret_cast<const char *>(&sample.pcs[j]), sizeof(void *));
+            }
+            keys.push_back(std::move(key));
+          }
+          slot.tail.store(tail, std::memory_order_release);
+          uint64_t dropped = slot.dropped.load(std::memory_order_relaxed);
+          dropped_total.inc(dropped - slot.reported_dropped);
+          slot.reported_dropped = dropped;
+        }
+      }
+      samples_total.inc(keys.size());
+
+      std::unique_lock<std::mutex> lock(buckets_mutex);
+      if (buckets.empty() || buckets.back().second != second) {
+        buckets.push_back(Bucket {second, {}});
+      }
+      for (auto &key : keys) {
+        buckets.back().stacks[key]++;
+      }
+      while (buckets.front().second + window_seconds <= second) {
+        buckets.pop_front();
+      }
+    }
+
+    /**
+     * @brief 주소 하나를 프레임 이름으로. buckets_mutex 를 잡은 채 부른다.
+     */
+    const std::string &symbolize(uintptr_t pc) {
+      auto cached = symbol_cache.find(pc);
+      if (cached != symbol_cache.end()) {
+        return cached->second;
+      }
+      std::string name;
+      const std::string *found = executable.contains(pc) ? executable.find(pc) : nullptr;
+      Dl_info info;
+      if (found != nullptr) {
+        name = *found;
+      } else if (dladdr(reinterpret_cast<void *>(pc), &info) != 0 && info.dli_sname != nullptr) {
+        name = ExecutableSymbols::demangle(info.dli_sname);
+      } else if (dladdr(reinterpret_cast<void *>(pc), &info) != 0 && info.dli_fname != nullptr) {
+        const char *base = strrchr(info.dli_fname, '/');
+        char offset[32];
+        snprintf(offset, sizeof(offset), "+0x%lx", static_cast<unsigned long>(pc - reinterpret_cast<uintptr_t>(info.dli_fbase)));
+        name = std::string(base != nullptr ? base + 1 : info.dli_fname) + offset;
+      } else {
+        name = "[unknown]";
+      }
+      // folded stack 은 ';' 로 프레임을, 마지막 ' ' 로 횟수를 나눈다
+      std::replace(name.begin(), name.end(), ';', ':');
+      return symbol_cache.emplace(pc, std::move(name)).first->second;
+    }
+
+    void write_dump() {
+      std::string path;
+      {
+        std::unique_lock<std::mutex> lock(collector_mutex);
+        path = dump_path;
+      }
+      std::string stacks = folded();
+      std::ofstream file(path, std::ios::out | std::ios::trunc);
+      file << stacks;
+      if (!file) {
+        std::cerr << "profile: " << path << " 에 쓰지 못했습니다" << std::endl;
+        return;
+      }
+      std::cout << "profile: " << std::count(stacks.begin(), stacks.end(), '\n') << " stacks written to " << path << std::endl;
+    }
+
+    void run() {
+      std::unique_lock<std::mutex> lock(collector_mutex);
+      while (running.load()) {
+        collector_cv.wait_for(lock, std::chrono::milliseconds(100));
+        lock.unlock();
+        collect();
+        if (dump_requested.exchange(false)) {
+          write_dump();
+        }
+        lock.lock();
+      }
+    }
+
+  public:
+    Sampler(const Sampler &) = delete;
+    Sampler &operator=(const Sampler &) = delete;
+
+    static Sampler &instance() {
+      static Sampler sampler;
+      return sampler;
+    }
+
+    /**
+     * @brief 샘플링을 시작한다. 이 뒤에 register_thread() 를 부른 쓰레드부터 샘플을 뜬다.
+     *
+     * @param hz 쓰레드마다 CPU 시간 1초에 뜰 샘플 수
+     * @param window_seconds folded() 가 돌려줄 최근 샘플의 기간 (초)
+     * @return 시그널 핸들러를 걸지 못했으면 false
+     */
+    bool start(int hz, int window_seconds) {
+      this->hz = hz;
+      this->window_seconds = std::max(window_seconds, 1);
+
+      // 처음 부를 때 libgcc 를 올리며 malloc 하므로 시그널 핸들러 밖에서 한 번 불러 둔다
+      void *warmup[1];
+      backtrace(warmup, 1);
+      if (!executable.load()) {
+        std::cerr << "profile: 실행 파일의 심볼을 읽지 못했습니다, 실행 파일의 함수는 주소로 나옵니다" << std::endl;
+      }
+
+      struct sigaction action;
+      memset(&action, 0, sizeof(action));
+      action.sa_sigaction = on_signal;
+      action.sa_flags = SA_SIGINFO | SA_RESTART;
+      sigemptyset(&action.sa_mask);
+      if (sigaction(SIGPROF, &action, nullptr) != 0) {
+        std::cerr << "profile: sigaction() failed: " << strerror(errno) << std::endl;
+        return false;
+      }
+      running.store(true);
+      collector = std::thread([this]() {run();});
+      return true;
+    }
+
+    /**
+     * @brief 모으는 쓰레드를 멈춘다. 등록한 쓰레드들의 타이머는 그 쓰레드가 끝날 때 지워진다.
+     */
+    void stop() {
+      if (!collector.joinable()) {
+        return;
+      }
+      running.store(false);
+      collector_cv.notify_all();
+      collector.join();
+    }
+
+    bool enabled() const {return running.load(std::memory_order_relaxed);}
+
+    /**
+     * @brief 부른 쓰레드를 샘플링 대상으로 등록한다. 샘플링 중이 아니거나 이미 등록한 쓰레드면 아무것도 하지 않는다.
+     *
+     * @param name folded stack 의 맨 바깥 프레임으로 쓸 쓰레드 이름, 예) "worker 0"
+     */
+    void register_thread(const std::string &name) {
+      if (!enabled() || current_slot() != nullptr) {
+        return;
+      }
+      ThreadSlot *slot;
+      {
+        std::unique_lock<std::mutex> lock(slots_mutex);
+        slots.emplace_back(new ThreadSlot());
+        slot = slots.back().get();
+        slot->name = name;
+      }
+      current_slot() = slot;
+
+      thread_local ThreadTimer thread_timer;
+      sigevent event;
+      memset(&event, 0, sizeof(event));
+      event.sigev_notify = SIGEV_THREAD_ID;
+      event.sigev_signo = SIGPROF;
+      event.sigev_notify_thread_id = static_cast<pid_t>(syscall(SYS_gettid));
+      if (timer_create(CLOCK_THREAD_CPUTIME_ID, &event, &thread_timer.timer) != 0) {
+        std::cerr << "profile: timer_create() failed: " << strerror(errno) << std::endl;
+        return;
+      }
+      thread_timer.created = true;
+      long interval_ns = 1000000000L / std::max(hz, 1);
+      itimerspec spec;
+      spec.it_interval.tv_sec = interval_ns / 1000000000L;
+      spec.it_interval.tv_nsec = interval_ns % 1000000000L;
+      spec.it_value = spec.it_interval;
+      timer_settime(thread_timer.timer, 0, &spec, nullptr);
+    }
+
+    /**
+     * @brief 최근 window_seconds 동안의 샘플을 folded stack 으로. 한 줄이 "쓰레드;바깥 함수;...;안쪽 함수 샘플 수" 이다.
+     *
+     * flamegraph.pl 이나 speedscope 에 그대로 넣을 수 있다.
+     */
+    std::string folded() {
+      collect();
+      std::map<std::string, uint64_t> lines;
+      std::unique_lock<std::mutex> lock(buckets_mutex);
+      std::vector<std::string> names;
+      {
+        std::unique_lock<std::mutex> slots_lock(slots_mutex);
+        for (auto &slot : slots) {
+          names.push_back(slot->name);
+        }
+      }
+      for (auto &bucket : buckets) {
+        for (auto &entry : bucket.stacks) {
+          const std::string &key = entry.first;
+          uint32_t thread;
+          memcpy(&thread, key.data(), sizeof(thread));
+          std::string line = thread < names.size() ? names[thread] : "[thread]";
+          size_t frames = (key.size() - sizeof(thread)) / sizeof(void *);
+          for (size_t i = 0; i < frames; ++i) {
+            uintptr_t pc;
+            memcpy(&pc, key.data() + sizeof(thread) + i * sizeof(void *), sizeof(pc));
+            // 안쪽 프레임을 빼면 주소는 돌아갈 곳이라 호출한 명령을 가리키도록 1을 뺀다
+            line += ";" + symbolize(i + 1 == frames ? pc : pc - 1);
+          }
+          lines[line] += entry.second;
+        }
+      }
+
+      std::string out;
+      for (auto &line : lines) {
+        out += line.first + " " + std::to_string(line.second) + "\n";
+      }
+      return out;
+    }
+
+    /**
+     * @brief 모으는 쓰레드가 다음 주기에 folded() 를 set_dump_path() 의 파일에 쓰게 한다. 시그널 핸들러에서 불러도 된다.
+     */
+    void request_dump() {
+      dump_requested.store(true);
+    }
+
+    /**
+     * @brief request_dump() 로 쓸 파일. start() 전에 정한다.
+     */
+    void set_dump_path(const std::string &path) {
+      std::unique_lock<std::mutex> lock(collector_mutex);
+      dump_path = path;
+    }
+};
+
+#endif
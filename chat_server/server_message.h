@@ -0,0 +1,430 @@
+/**
+ * @file server_message.h
+ * @brief 포맷에 독립적인 서버 -> 클라이언트 메시지와 포맷별 인코딩 캐시
+ *
+ * 핸들러는 SCChat, SCSystemMessage, SCRoomsResult 를 포맷과 상관없이 한 번만 만들고,
+ * 실제 바이트는 그 메시지를 받을 클라이언트가 쓰는 포맷으로 처음 필요할 때 한 번만 인코딩된다.
+ * 같은 메시지를 받는 멤버들은 shared_ptr 로 메시지와 인코딩 결과를 공유하므로,
+ * 브로드캐스트 비용은 멤버 수가 아니라 방 안에 섞인 포맷 수에 비례한다.
+ *
+ * 멤버 이름은 NameTable 이 intern 한 InternedName 을 가리키며, JSON 과 protobuf 인코딩은
+ * 이름마다 미리 만들어 둔 바이트를 이어 붙여 만든다.
+ */
+
+#ifndef CHAT_SERVER_SERVER_MESSAGE_H
+#define CHAT_SERVER_SERVER_MESSAGE_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "message.pb.h"
+#include "nlohmann/json.hpp"
+#include "flat_message.h"
+#include "name_table.h"
+
+/**
+ * @brief 연결마다 고를 수 있는 메시지 포맷
+ */
+enum class MessageFormat {
+  JSON = 0,
+  PROTOBUF = 1,
+  FLAT = 2,
+};
+
+static const int MESSAGE_FORMAT_COUNT = 3; ///< MessageFormat 값의 개수
+
+/**
+ * @brief 포맷 이름("json", "protobuf", "flat")을 MessageFormat 으로 바꾼다.
+ *
+ * @param name 포맷 이름
+ * @param format 결과
+ * @return 알려진 이름이면 true
+ */
+inline bool parse_message_format(const std::string &name, MessageFormat &format) {
+  if (name == "json") {
+    format = MessageFormat::JSON;
+  } else if (name == "protobuf") {
+    format = MessageFormat::PROTOBUF;
+  } else if (name == "flat") {
+    format = MessageFormat::FLAT;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief 한 포맷으로 인코딩한 메시지. 길이 prefix 는 받는 연결의 프레이밍에 맞춰 보낼 때 붙인다.
+ */
+struct EncodedFrame {
+  std::vector<std::string> frames; ///< 프레임 본문들 (protobuf 는 타입 프레임과 본문 프레임)
+  std::string_view tail;           ///< 마지막 프레임 본문 뒤에 이어 보낼 빌린 바이트
+
+  /**
+   * @brief i 번째 프레임의 전체 길이 (마지막 프레임은 tail 포함)
+   */
+  size_t frame_size(size_t i) const {
+    return frames[i].size() + (i + 1 == frames.size() ? tail.size() : 0);
+  }
+};
+
+/**
+ * @brief SCRoomsResult 에 담기는 방 하나의 정보
+ */
+struct RoomInfo {
+  int room_id;
+  std::string title;
+  std::vector<NamePtr> members;
+};
+
+/**
+ * @brief SCRoomsResult 안의 방 하나. 포맷별 인코딩을 처음 필요할 때 한 번만 만들어 두고,
+ *        방 목록을 인코딩할 때는 방마다 이 조각을 이어 붙이기만 한다.
+ *
+ * 방이 바뀌면 조각을 고치지 않고 새 조각을 만들어 바꿔 끼운다.
+ */
+class RoomFragment {
+  private:
+    RoomInfo info;
+
+    mutable std::once_flag encoded_once[MESSAGE_FORMAT_COUNT];
+    mutable std::string encoded[MESSAGE_FORMAT_COUNT];
+
+  public:
+    explicit RoomFragment(RoomInfo info) : info(std::move(info)) {}
+
+    RoomFragment(const RoomFragment &) = delete;
+    RoomFragment &operator=(const RoomFragment &) = delete;
+
+    /**
+     * @brief format 으로 인코딩한 방 조각.
+     *
+     * - json: {"members":[...],"roomId":..,"title":".."} 객체
+     * - protobuf: SCRoomsResult.rooms 필드 하나 (태그, 길이, RoomInfo). 이어 붙이면 repeated 필드가 된다.
+     * - flat: 방 레코드
+     *
+     * @param format 받는 클라이언트의 포맷
+     */
+    const std::string &encode(MessageFormat format) const {
+      int index = static_cast<int>(format);
+      std::call_once(encoded_once[index], [this, format, index]() {
+        if (format == MessageFormat::JSON) {
+          // 키 순서는 dump() 와 같다
+          std::string &out = encoded[index];
+          out = "{\"members\":[";
+          for (size_t i = 0; i < info.members.size(); ++i) {
+            if (i > 0) {
+              out += ',';
+            }
+            out += info.members[i]->get_json();
+          }
+          out += "],\"roomId\":" + std::to_string(info.room_id) + ",\"title\":" + json_string(info.title) + "}";
+        } else if (format == MessageFormat::PROTOBUF) {
+          // RoomInfo { roomId = 1, title = 2, repeated members = 3 }
+          std::string room_info;
+          append_varint(room_info, 1 << 3);
+          append_varint(room_info, static_cast<uint64_t>(static_cast<int64_t>(info.room_id)));
+          append_bytes_field(room_info, 2, info.title);
+          for (auto &name : info.members) {
+            room_info += static_cast<char>((3 << 3) | 2);
+            room_info += name->get_protobuf();
+          }
+          append_bytes_field(encoded[index], 1, room_info);
+        } else {
+          std::vector<std::string_view> members;
+          for (auto &name : info.members) {
+            members.push_back(name->get());
+          }
+          encoded[index] = FlatMessage::room_record(info.room_id, info.title, members);
+        }
+      });
+      return encoded[index];
+    }
+
+    //getter
+    const RoomInfo &get_info() const {return info;}
+};
+
+using RoomFragmentPtr = std::shared_ptr<const RoomFragment>;
+
+/**
+ * @brief 포맷에 독립적인 서버 -> 클라이언트 메시지
+ */
+class ServerMessage {
+  private:
+    int type; ///< mju::Type::MessageType 의 SC_ 값
+    NamePtr member; ///< SCChat 을 보낸 사람
+    int room_id = 0; ///< SCChat 이 오간 방
+    std::string text;
+    std::string_view text_view; ///< text 또는 빌려온 채팅 내용
+    std::vector<RoomFragmentPtr> rooms;
+    std::string next_cursor; ///< SCRoomsResult 의 다음 페이지 커서, 마지막 페이지이면 비어 있다
+
+    mutable std::once_flag encoded_once[MESSAGE_FORMAT_COUNT];
+    mutable EncodedFrame encoded[MESSAGE_FORMAT_COUNT];
+
+    explicit ServerMessage(int type) : type(type) {}
+
+    EncodedFrame encode_json() const {
+      nlohmann::json message;
+      if (type == mju::Type_MessageType_SC_CHAT) {
+        // 이름은 미리 이스케이프해 둔 바이트를 쓴다. 키 순서는 dump() 와 같다.
+        EncodedFrame frame;
+        std::string body = "{\"member\":" + member->get_json();
+        if (room_id != 0) {
+          body += ",\"roomId\":" + std::to_string(room_id);
+        }
+        body += ",\"text\":" + json_string(text_view) + ",\"type\":\"SCChat\"}";
+        frame.frames.push_back(std::move(body));
+        return frame;
+      } else if (type == mju::Type_MessageType_SC_ROOMS_RESULT) {
+        // 방 조각을 이어 붙인다. 키 순서는 dump() 와 같다.
+        std::string body = "{";
+        if (!next_cursor.empty()) {
+          body += "\"nextCursor\":" + json_string(next_cursor) + ",";
+        }
+        body += "\"rooms\":[";
+        for (size_t i = 0; i < rooms.size(); ++i) {
+          if (i > 0) {
+            body += ',';
+          }
+          body += rooms[i]->encode(MessageFormat::JSON);
+        }
+        body += "],\"type\":\"SCRoomsResult\"}";
+
+        EncodedFrame frame;
+        frame.frames.push_back(std::move(body));
+        return frame;
+      } else {
+        message = {
+          {"type", "SCSystemMessage"},
+          {"text", text},
+        };
+      }
+
+      EncodedFrame frame;
+      // SCSystemMessage 의 text 에는 flat/protobuf 연결이 보낸 이름이 들어갈 수 있다
+      frame.frames.push_back(message.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace));
+      return frame;
+    }
+
+    EncodedFrame encode_protobuf() const {
+      mju::Type message_type;
+      message_type.set_type(static_cast<mju::Type_MessageType>(type));
+
+      std::string body;
+      if (type == mju::Type_MessageType_SC_CHAT) {
+        // SCChat { member = 1, text = 2, roomId = 3 }
+        body.reserve(member->get_protobuf().size() + text_view.size() + 24);
+        body += static_cast<char>((1 << 3) | 2);
+        body += member->get_protobuf();
+        append_bytes_field(body, 2, text_view);
+        if (room_id != 0) {
+          append_varint(body, 3 << 3);
+          append_varint(body, static_cast<uint64_t>(static_cast<int64_t>(room_id)));
+        }
+      } else if (type == mju::Type_MessageType_SC_ROOMS_RESULT) {
+        for (auto &room : rooms) {
+          body += room->encode(MessageFormat::PROTOBUF);
+        }
+        if (!next_cursor.empty()) {
+          mju::SCRoomsResult cursor;
+          cursor.set_nextcursor(next_cursor);
+          body += cursor.SerializeAsString();
+        }
+      } else {
+        mju::SCSystemMessage message_sys;
+        message_sys.set_text(text);
+        body = message_sys.SerializeAsString();
+      }
+
+      EncodedFrame frame;
+      frame.frames.push_back(message_type.SerializeAsString());
+      frame.frames.push_back(std::move(body));
+      return frame;
+    }
+
+    EncodedFrame encode_flat() const {
+      FlatMessage message;
+      if (type == mju::Type_MessageType_SC_CHAT) {
+        message = FlatMessage::chat(member->get(), text_view, room_id);
+      } else if (type == mju::Type_MessageType_SC_ROOMS_RESULT) {
+        message = FlatMessage::rooms_result(next_cursor);
+        for (auto &room : rooms) {
+          message.add_room_record(room->encode(MessageFormat::FLAT));
+        }
+      } else {
+        message = FlatMessage::system_message(text);
+      }
+
+      EncodedFrame frame;
+      frame.frames.push_back(message.get_head());
+      frame.tail = message.get_tail();
+      return frame;
+    }
+
+  public:
+    ServerMessage(const ServerMessage &) = delete;
+    ServerMessage &operator=(const ServerMessage &) = delete;
+
+    /**
+     * @brief SCSystemMessage 를 만든다.
+     *
+     * @param text 시스템 메시지 내용
+     */
+    static std::shared_ptr<ServerMessage> system_message(std::string text) {
+      std::shared_ptr<ServerMessage> message(new ServerMessage(mju::Type_MessageType_SC_SYSTEM_MESSAGE));
+      message->text = std::move(text);
+      message->text_view = message->text;
+      return message;
+    }
+
+    /**
+     * @brief SCChat 을 만든다.
+     *
+     * @param member 채팅을 보낸 사람
+     * @param text 채팅 내용
+     * @param room_id 채팅이 오간 방
+     */
+    static std::shared_ptr<ServerMessage> chat(NamePtr member, std::string text, int room_id) {
+      std::shared_ptr<ServerMessage> message(new ServerMessage(mju::Type_MessageType_SC_CHAT));
+      message->member = std::move(member);
+      message->room_id = room_id;
+      message->text = std::move(text);
+      message->text_view = message->text;
+      return message;
+    }
+
+    /**
+     * @brief text 를 복사하지 않고 빌려오는 SCChat 을 만든다.
+     *
+     * flat 포맷은 수신 버퍼를 그대로 가리키므로, 버퍼는 메시지의 모든 전송이 끝날 때까지 유지되어야 한다.
+     *
+     * @param member 채팅을 보낸 사람
+     * @param text 채팅 내용
+     * @param room_id 채팅이 오간 방
+     */
+    static std::shared_ptr<ServerMessage> borrowed_chat(NamePtr member, std::string_view text, int room_id) {
+      std::shared_ptr<ServerMessage> message(new ServerMessage(mju::Type_MessageType_SC_CHAT));
+      message->member = std::move(member);
+      message->room_id = room_id;
+      message->text_view = text;
+      return message;
+    }
+
+    /**
+     * @brief 빌려온 내용을 복사해 가진 메시지. 빌려오지 않은 메시지는 그대로 돌려준다.
+     *
+     * 수신 버퍼가 사라진 뒤에 전송될 수 있는 메시지(다른 쓰레드로 넘기는 메시지)에 쓴다.
+     *
+     * @param message 메시지
+     */
+    static std::shared_ptr<const ServerMessage> owning(const std::shared_ptr<const ServerMessage> &message) {
+      if (message->text_view.data() == message->text.data()) {
+        return message;
+      }
+      return chat(message->member, std::string(message->text_view), message->room_id);
+    }
+
+    /**
+     * @brief SCRoomsResult 를 만든다.
+     *
+     * @param rooms 방 목록
+     */
+    static std::shared_ptr<ServerMessage> rooms_result(std::vector<RoomInfo> rooms) {
+      std::vector<RoomFragmentPtr> fragments;
+      for (auto &room : rooms) {
+        fragments.push_back(std::make_shared<const RoomFragment>(std::move(room)));
+      }
+      return rooms_result(std::move(fragments));
+    }
+
+    /**
+     * @brief 이미 만들어 둔 방 조각들로 SCRoomsResult 를 만든다. 조각의 인코딩 캐시를 그대로 쓴다.
+     *
+     * @param rooms 방 조각 목록
+     * @param next_cursor 다음 페이지 커서, 마지막 페이지이면 빈 문자열
+     */
+    static std::shared_ptr<ServerMessage> rooms_result(std::vector<RoomFragmentPtr> rooms, std::string next_cursor = "") {
+      std::shared_ptr<ServerMessage> message(new ServerMessage(mju::Type_MessageType_SC_ROOMS_RESULT));
+      message->rooms = std::move(rooms);
+      message->next_cursor = std::move(next_cursor);
+      return message;
+    }
+
+    /**
+     * @brief format 으로 인코딩한 바이트. 포맷마다 처음 호출될 때 한 번만 인코딩하고 이후에는 캐시를 돌려준다.
+     *
+     * @param format 받는 클라이언트의 포맷
+     */
+    const EncodedFrame &encode(MessageFormat format) const {
+      int index = static_cast<int>(format);
+      std::call_once(encoded_once[index], [this, format, index]() {
+        switch (format) {
+          case MessageFormat::JSON: encoded[index] = encode_json(); break;
+          case MessageFormat::PROTOBUF: encoded[index] = encode_protobuf(); break;
+          case MessageFormat::FLAT: encoded[index] = encode_flat(); break;
+        }
+      });
+      return encoded[index];
+    }
+
+    //getter
+    int get_type() const {return type;}
+};
+
+using ServerMessagePtr = std::shared_ptr<const ServerMessage>;
+
+/**
+ * @brief 한 클라이언트에게 갈 메시지들을 SCBatch 프레임 하나로 인코딩.
+ *
+ * 각 메시지의 캐시된 인코딩을 그대로 이어 붙이므로 안쪽 메시지를 다시 직렬화하지 않는다.
+ * JSON 은 DOM 을 만들지 않고 문자열로 {"messages":[...],"type":"SCBatch"} 를 조립한다.
+ *
+ * @param format 받는 클라이언트의 포맷
+ * @param messages 배치에 담을 메시지들
+ */
+inline EncodedFrame encode_batch(MessageFormat format, const std::vector<ServerMessagePtr> &messages) {
+  EncodedFrame batch;
+  if (format == MessageFormat::JSON) {
+    std::string body = "{\"messages\":[";
+    for (size_t i = 0; i < messages.size(); ++i) {
+      const EncodedFrame &frame = messages[i]->encode(format);
+      if (i > 0) {
+        body += ',';
+      }
+      body += frame.frames[0];
+      body.append(frame.tail);
+    }
+    body += "],\"type\":\"SCBatch\"}";
+    batch.frames.push_back(std::move(body));
+
+  } else if (format == MessageFormat::PROTOBUF) {
+    mju::Type message_type;
+    message_type.set_type(mju::Type_MessageType_SC_BATCH);
+
+    mju::SCBatch sc_batch;
+    for (auto &message : messages) {
+      const EncodedFrame &frame = message->encode(format);
+      auto *entry = sc_batch.add_messages();
+      entry->set_type(static_cast<mju::Type_MessageType>(message->get_type()));
+      entry->set_body(frame.frames[1]);
+    }
+    batch.frames.push_back(message_type.SerializeAsString());
+    batch.frames.push_back(sc_batch.SerializeAsString());
+
+  } else {
+    FlatMessage sc_batch = FlatMessage::batch();
+    for (auto &message : messages) {
+      const EncodedFrame &frame = message->encode(format);
+      sc_batch.add_entry(frame.frames[0], frame.tail);
+    }
+    batch.frames.push_back(sc_batch.get_head());
+  }
+  return batch;
+}
+
+#endif
@@ -0,0 +1,347 @@
+/**
+ * @file trace.h
+ * @brief 뽑힌 메시지 하나가 서버 안에서 거치는 단계를 Chrome trace-event JSON 으로 남기는 추적기
+ *
+ * 메시지 N 개 중 하나를 뽑아 trace id 를 붙이고, 그 메시지의 recv, 큐 대기, 파싱, 핸들러, 직렬화, 받는 멤버마다의 전송을
+ * span 으로 기록한다. 뽑히지 않은 메시지가 치르는 비용은 카운터 하나를 올리는 것과 thread_local 하나를 읽는 것뿐이다.
+ *
+ * 이벤트는 버퍼에 모였다가 쓰기 쓰레드가 주기적으로 파일에 쓴다. 파일이 rotate_bytes 를 넘으면
+ * path -> path.1 -> path.2 로 밀어내고 새 파일을 연다. 각 파일은 그대로 chrome://tracing 이나 Perfetto 에서 열 수 있다.
+ */
+
+#ifndef CHAT_SERVER_TRACE_H
+#define CHAT_SERVER_TRACE_H
+
+#include <stdio.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "metrics.h"
+
+/**
+ * @brief 추적 이벤트를 모아 회전하는 파일에 쓰는 전역 추적기
+ */
+class Tracer {
+  public:
+    static const size_t MAX_BUFFERED_BYTES = 8 * 1024 * 1024; ///< 쓰기 쓰레드가 따라오지 못할 때 모아 둘 수 있는 바이트 수, 넘으면 이벤트를 버린다
+    static const int ROTATED_FILES = 2; ///< 남겨 두는 지난 파일 수 (path.1, path.2)
+
+  private:
+    std::atomic<bool> running {false};
+    std::string path;
+    uint64_t sample_every = 0;
+    size_t rotate_bytes = 0;
+    uint64_t origin_ns = 0; ///< ts 0 으로 쓰는 시각, metric_now_ns()
+
+    std::atomic<uint64_t> sample_counter {0};
+    std::atomic<uint64_t> next_trace_id {1};
+    std::atomic<uint64_t> next_flow_id {1};
+    std::atomic<uint64_t> dropped_events {0};
+    uint64_t written_events = 0;
+
+    std::mutex buffer_mutex;
+    std::string buffer; ///< 아직 파일에 쓰지 않은 이벤트들, 이벤트마다 ",\n" 으로 시작한다
+    uint64_t buffered_events = 0;
+    std::map<uint32_t, std::string> thread_names;
+
+    std::mutex writer_mutex;
+    std::condition_variable writer_cv;
+    std::thread writer;
+    std::ofstream file;
+    size_t file_bytes = 0;
+
+    Tracer() {}
+
+    double to_us(uint64_t ns) const {
+      return (static_cast<double>(ns) - static_cast<double>(origin_ns)) / 1000.0;
+    }
+
+    static std::string thread_name_event(uint32_t tid, const std::string &name) {
+      return "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(tid) + ",\"args\":{\"name\":\"" + name + "\"}}";
+    }
+
+    void append(const std::string &event) {
+      std::unique_lock<std::mutex> lock(buffer_mutex);
+      if (buffer.size() + event.size() > MAX_BUFFERED_BYTES) {
+        dropped_events.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      buffer += ",\n";
+      buffer += event;
+      buffered_events++;
+    }
+
+    /**
+     * @brief 새 파일을 열고 프로세스와 쓰레드 이름 메타데이터를 먼저 쓴다. 이름은 파일마다 있어야 회전된 파일도 혼자 읽힌다.
+     */
+    bool open_file() {
+      file.open(path, std::ios::out | std::ios::trunc);
+      if (!file) {
+        return false;
+      }
+      std::string header = "[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"chat_server\"}}";
+      {
+        std::unique_lock<std::mutex> lock(buffer_mutex);
+        for (auto &name : thread_names) {
+          header += ",\n" + thread_name_event(name.first, name.second);
+        }
+      }
+      file << header;
+      file.flush();
+      file_bytes = header.size();
+      return true;
+    }
+
+    void close_file() {
+      file << "\n]\n";
+      file.close();
+    }
+
+    void rotate() {
+      close_file();
+      for (int i = ROTATED_FILES; i > 1; --i) {
+        ::rename((path + "." + std::to_string(i - 1)).c_str(), (path + "." + std::to_string(i)).c_str());
+      }
+      ::rename(path.c_str(), (path + ".1").c_str());
+      if (!open_file()) {
+        std::cerr << "trace: " << path << " 을 다시 열지 못해 추적을 멈춥니다" << std::endl;
+        running.store(false);
+      }
+    }
+
+    void write_pending() {
+      std::string pending;
+      uint64_t events;
+      {
+        std::unique_lock<std::mutex> lock(buffer_mutex);
+        pending.swap(buffer);
+        events = buffered_events;
+        buffered_events = 0;
+      }
+      if (pending.empty() || !file.is_open()) {
+        return;
+      }
+      file << pending;
+      file.flush();
+      file_bytes += pending.size();
+      written_events += events;
+      if (rotate_bytes != 0 && file_bytes >= rotate_bytes) {
+        rotate();
+      }
+    }
+
+    void run() {
+      std::unique_lock<std::mutex> lock(writer_mutex);
+      while (running.load()) {
+        writer_cv.wait_for(lock, std::chrono::milliseconds(200));
+        write_pending();
+      }
+    }
+
+  public:
+    Tracer(const Tracer &) = delete;
+    Tracer &operator=(const Tracer &) = delete;
+
+    static Tracer &instance() {
+      static Tracer tracer;
+      return tracer;
+    }
+
+    /**
+     * @brief 이 쓰레드의 추적용 번호. 쓰레드가 처음 부를 때 1 부터 차례로 정해진다.
+     */
+    static uint32_t thread_id() {
+      static std::atomic<uint32_t> next_id {1};
+      thread_local uint32_t id = next_id.fetch_add(1, std::memory_order_relaxed);
+      return id;
+    }
+
+    /**
+     * @brief path 에 추적을 쓰기 시작한다.
+     *
+     * @param path 추적 파일 경로
+     * @param sample_every 메시지 이만큼에 하나를 뽑는다, 1 이면 모두
+     * @param rotate_bytes 파일이 이만큼 커지면 회전한다, 0 이면 회전하지 않는다
+     * @return 파일을 열지 못했으면 false
+     */
+    bool start(const std::string &path, uint64_t sample_every, size_t rotate_bytes) {
+      this->path = path;
+      this->sample_every = sample_every == 0 ? 1 : sample_every;
+      this->rotate_bytes = rotate_bytes;
+      origin_ns = metric_now_ns();
+      if (!open_file()) {
+        std::cerr << "trace: " << path << " 을 열지 못했습니다" << std::endl;
+        return false;
+      }
+      running.store(true);
+      writer = std::thread([this]() {run();});
+      return true;
+    }
+
+    /**
+     * @brief 남은 이벤트를 쓰고 파일을 닫는다. 여러 번 불러도 된다.
+     */
+    void stop() {
+      if (!writer.joinable()) {
+        return;
+      }
+      running.store(false);
+      writer_cv.notify_all();
+      writer.join();
+      write_pending();
+      if (file.is_open()) {
+        close_file();
+      }
+      std::cout << "trace: " << next_trace_id.load() - 1 << " traces, " << written_events << " events written, "
+                << dropped_events.load() << " dropped" << std::endl;
+    }
+
+    bool enabled() const {return running.load(std::memory_order_relaxed);}
+
+    /**
+     * @brief 메시지 하나를 뽑을지 정한다.
+     *
+     * @return 뽑혔으면 새 trace id, 아니면 0
+     */
+    uint64_t sample() {
+      if (!enabled() || sample_counter.fetch_add(1, std::memory_order_relaxed) % sample_every != 0) {
+        return 0;
+      }
+      return next_trace_id.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 이 쓰레드의 이름을 남긴다. 같은 이름이 이미 있으면 아무것도 하지 않는다.
+     */
+    void name_thread(const std::string &name) {
+      uint32_t tid = thread_id();
+      {
+        std::unique_lock<std::mutex> lock(buffer_mutex);
+        auto it = thread_names.find(tid);
+        if (it != thread_names.end() && it->second == name) {
+          return;
+        }
+        thread_names[tid] = name;
+      }
+      if (enabled()) {
+        append(thread_name_event(tid, name));
+      }
+    }
+
+    /**
+     * @brief 시작과 끝이 있는 span ("ph":"X") 을 남긴다.
+     *
+     * @param trace trace id
+     * @param name 단계 이름
+     * @param start_ns 시작 시각, metric_now_ns()
+     * @param end_ns 끝 시각, metric_now_ns()
+     * @param args args 에 trace 뒤로 덧붙일 JSON 필드들, 예) "\"sock\":7"
+     * @param tid 이벤트를 놓을 쓰레드, 0 이면 부른 쓰레드
+     */
+    void complete(uint64_t trace, const char *name, uint64_t start_ns, uint64_t end_ns, const std::string &args = std::string(), uint32_t tid = 0) {
+      char event[256];
+      snprintf(event, sizeof(event), "{\"name\":\"%s\",\"cat\":\"chat\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"trace\":%llu",
+               name, to_us(start_ns), end_ns > start_ns ? (end_ns - start_ns) / 1000.0 : 0.0, tid == 0 ? thread_id() : tid, (unsigned long long) trace);
+      append(std::string(event) + (args.empty() ? "" : ",") + args + "}}");
+    }
+
+    /**
+     * @brief 한 시점의 이벤트 ("ph":"i") 를 남긴다. 인자는 complete() 와 같다.
+     */
+    void instant(uint64_t trace, const char *name, uint64_t at_ns, const std::string &args = std::string(), uint32_t tid = 0) {
+      char event[256];
+      snprintf(event, sizeof(event), "{\"name\":\"%s\",\"cat\":\"chat\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"trace\":%llu",
+               name, to_us(at_ns), tid == 0 ? thread_id() : tid, (unsigned long long) trace);
+      append(std::string(event) + (args.empty() ? "" : ",") + args + "}}");
+    }
+
+    /**
+     * @brief 다른 쓰레드로 넘어가는 화살표를 지금 이 쓰레드의 span 에서 시작한다.
+     *
+     * @return flow_end() 에 넘길 flow id
+     */
+    uint64_t flow_start(uint64_t trace, uint64_t at_ns) {
+      uint64_t flow = next_flow_id.fetch_add(1, std::memory_order_relaxed);
+      char event[192];
+      snprintf(event, sizeof(event), "{\"name\":\"trace %llu\",\"cat\":\"chat\",\"ph\":\"s\",\"id\":%llu,\"ts\":%.3f,\"pid\":1,\"tid\":%u}",
+               (unsigned long long) trace, (unsigned long long) flow, to_us(at_ns), thread_id());
+      append(event);
+      return flow;
+    }
+
+    /**
+     * @brief flow_start() 의 화살표를 이 쓰레드에서 at_ns 를 감싸는 span 에 잇는다.
+     */
+    void flow_end(uint64_t trace, uint64_t flow, uint64_t at_ns) {
+      char event[192];
+      snprintf(event, sizeof(event), "{\"name\":\"trace %llu\",\"cat\":\"chat\",\"ph\":\"f\",\"bp\":\"e\",\"id\":%llu,\"ts\":%.3f,\"pid\":1,\"tid\":%u}",
+               (unsigned long long) trace, (unsigned long long) flow, to_us(at_ns), thread_id());
+      append(event);
+    }
+};
+
+/**
+ * @brief 이 쓰레드가 처리 중인 trace id 를 정해 두는 RAII 범위
+ *
+ * 범위 안의 코드는 current() 로 trace id 를 얻어 span 을 남긴다. 큰 방의 브로드캐스트가 추적 파일을 채우지 않도록
+ * 범위 하나에서 남기는 전송 span 은 MAX_SPANS 개까지이고, 넘친 개수는 범위를 나갈 때 한 번에 남긴다.
+ */
+class TraceScope {
+  public:
+    static const size_t MAX_SPANS = 256; ///< 범위 하나에서 남기는 전송/직렬화 span 수
+
+  private:
+    static inline thread_local uint64_t current_trace = 0;
+    static inline thread_local size_t spans = 0;
+    static inline thread_local size_t dropped = 0;
+
+    uint64_t saved_trace;
+    size_t saved_spans;
+    size_t saved_dropped;
+
+  public:
+    explicit TraceScope(uint64_t trace) : saved_trace(current_trace), saved_spans(spans), saved_dropped(dropped) {
+      current_trace = trace;
+      spans = 0;
+      dropped = 0;
+    }
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+
+    ~TraceScope() {
+      if (current_trace != 0 && dropped > 0) {
+        Tracer::instance().instant(current_trace, "spans_dropped", metric_now_ns(), "\"count\":" + std::to_string(dropped));
+      }
+      current_trace = saved_trace;
+      spans = saved_spans;
+      dropped = saved_dropped;
+    }
+
+    /**
+     * @brief 이 쓰레드가 처리 중인 trace id, 추적 중이 아니면 0
+     */
+    static uint64_t current() {return current_trace;}
+
+    /**
+     * @brief span 을 하나 더 남겨도 되는지. 한도를 넘었으면 버린 개수를 세고 false.
+     */
+    static bool take_span() {
+      if (spans >= MAX_SPANS) {
+        dropped++;
+        return false;
+      }
+      spans++;
+      return true;
+    }
+};
+
+#endif